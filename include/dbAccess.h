@@ -0,0 +1,30 @@
+/*************************************************************************\
+* Copyright (c) 2002 The University of Chicago, as Operator of Argonne
+*     National Laboratory.
+* Copyright (c) 2002 The Regents of the University of California, as
+*     Operator of Los Alamos National Laboratory.
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* dbAccess.h   */
+
+#ifndef INCdbAccessh
+#define INCdbAccessh
+
+#include "dbDefs.h"
+#include "epicsTime.h"
+#include "caeventmask.h"
+#include "dbFldTypes.h"
+#include "link.h"
+#include "dbBase.h"
+#include "dbCoreAPI.h"
+#include "dbAddr.h"
+#include "dbLock.h"
+#include "dbAccessDefs.h"
+#include "dbLink.h"
+#include "dbCa.h"
+#include "dbCommon.h"
+#include "db_field_log.h"
+
+#endif /*INCdbAccessh*/
@@ -0,0 +1,71 @@
+/** @file dbCommon.h
+ * @brief Declarations for the @ref dbCommon "dbCommon" record type.
+ *
+ * This header was generated from dbCommonRecord.dbd
+ */
+
+#ifndef INC_dbCommon_H
+#define INC_dbCommon_H
+
+#include "epicsTypes.h"
+#include "link.h"
+#include "epicsMutex.h"
+#include "ellLib.h"
+#include "devSup.h"
+#include "epicsTime.h"
+
+/** @brief Declaration of dbCommon */
+typedef struct dbCommon {
+    char                name[61];   /**< @brief Record Name */
+    char                desc[41];   /**< @brief Descriptor */
+    char                asg[29];    /**< @brief Access Security Group */
+    epicsEnum16         scan;       /**< @brief Scan Mechanism */
+    epicsEnum16         pini;       /**< @brief Process at iocInit */
+    epicsInt16          phas;       /**< @brief Scan Phase */
+    char                evnt[40];   /**< @brief Event Name */
+    epicsInt16          tse;        /**< @brief Time Stamp Event */
+    DBLINK              tsel;       /**< @brief Time Stamp Link */
+    epicsEnum16         dtyp;       /**< @brief Device Type */
+    epicsInt16          disv;       /**< @brief Disable Value */
+    epicsInt16          disa;       /**< @brief Disable */
+    DBLINK              sdis;       /**< @brief Scanning Disable */
+    epicsMutexId        mlok;       /**< @brief Monitor lock */
+    ELLLIST             mlis;       /**< @brief Monitor List */
+    struct dbMonitorIndex *midx;    /**< @brief Monitor Field Index */
+    ELLLIST             bklnk;      /**< @brief Backwards link tracking */
+    epicsUInt8          disp;       /**< @brief Disable putField */
+    epicsUInt8          proc;       /**< @brief Force Processing */
+    epicsEnum16         stat;       /**< @brief Alarm Status */
+    epicsEnum16         sevr;       /**< @brief Alarm Severity */
+    char                amsg[40];   /**< @brief Alarm Message */
+    epicsEnum16         nsta;       /**< @brief New Alarm Status */
+    epicsEnum16         nsev;       /**< @brief New Alarm Severity */
+    char                namsg[40];  /**< @brief New Alarm Message */
+    epicsEnum16         acks;       /**< @brief Alarm Ack Severity */
+    epicsEnum16         ackt;       /**< @brief Alarm Ack Transient */
+    epicsEnum16         diss;       /**< @brief Disable Alarm Sevrty */
+    epicsUInt8          lcnt;       /**< @brief Lock Count */
+    epicsUInt8          pact;       /**< @brief Record active */
+    epicsUInt8          putf;       /**< @brief dbPutField process */
+    epicsUInt8          rpro;       /**< @brief Reprocess  */
+    struct asgMember    *asp;       /**< @brief Access Security Pvt */
+    struct processNotify *ppn;      /**< @brief pprocessNotify */
+    struct processNotifyRecord *ppnr; /**< @brief pprocessNotifyRecord */
+    struct scan_element *spvt;      /**< @brief Scan Private */
+    struct typed_rset   *rset;      /**< @brief Address of RSET */
+    unambiguous_dset    *dset;      /**< @brief DSET address */
+    void                *dpvt;      /**< @brief Device Private */
+    struct dbRecordType *rdes;      /**< @brief Address of dbRecordType */
+    struct lockRecord   *lset;      /**< @brief Lock Set */
+    epicsEnum16         prio;       /**< @brief Scheduling Priority */
+    epicsUInt8          tpro;       /**< @brief Trace Processing */
+    epicsUInt8          bkpt;       /**< @brief Break Point */
+    epicsUInt8          udf;        /**< @brief Undefined */
+    epicsEnum16         udfs;       /**< @brief Undefined Alarm Sevrty */
+    epicsTimeStamp      time;       /**< @brief Time */
+    epicsUInt64         utag;       /**< @brief Time Tag */
+    DBLINK              flnk;       /**< @brief Forward Process Link */
+} dbCommon;
+
+
+#endif /* INC_dbCommon_H */
@@ -183,7 +183,7 @@ int epicsStdCall ca_context_create (
 
         pcac = ( ca_client_context * ) epicsThreadPrivateGet ( caClientContextId );
         if ( pcac ) {
-            if ( premptiveCallbackSelect == ca_enable_preemptive_callback &&
+            if ( premptiveCallbackSelect != ca_disable_preemptive_callback &&
                 ! pcac->preemptiveCallbakIsEnabled() ) {
                 return ECA_NOTTHREADED;
             }
@@ -191,7 +191,8 @@ int epicsStdCall ca_context_create (
         }
 
         pcac = new ca_client_context (
-            premptiveCallbackSelect == ca_enable_preemptive_callback );
+            premptiveCallbackSelect != ca_disable_preemptive_callback,
+            premptiveCallbackSelect == ca_enable_concurrent_callback );
         if ( ! pcac ) {
             return ECA_ALLOCMEM;
         }
@@ -285,6 +286,40 @@ int epicsStdCall ca_search_and_connect (
         puser, CA_PRIORITY_DEFAULT, chanptr );
 }
 
+//
+// map the exception being handled by the caller
+// to a channel create status
+//
+static int caCreateChannelStatus (
+    ca_client_context * pcac, const char * pContext )
+{
+    try {
+        throw;
+    }
+    catch ( cacChannel::badString & ) {
+        return ECA_BADSTR;
+    }
+    catch ( std::bad_alloc & ) {
+        return ECA_ALLOCMEM;
+    }
+    catch ( cacChannel::badPriority & ) {
+        return ECA_BADPRIORITY;
+    }
+    catch ( cacChannel::unsupportedByService & ) {
+        return ECA_UNAVAILINSERV;
+    }
+    catch ( std :: exception & except ) {
+        pcac->printFormated (
+            "%s: "
+            "unexpected exception was \"%s\"",
+            pContext, except.what () );
+        return ECA_INTERNAL;
+    }
+    catch ( ... ) {
+        return ECA_INTERNAL;
+    }
+}
+
 // extern "C"
 int epicsStdCall ca_create_channel (
      const char * name_str, caCh * conn_func, void * puser,
@@ -296,22 +331,7 @@ int epicsStdCall ca_create_channel (
         return caStatus;
     }
 
-    {
-        CAFDHANDLER * pFunc = 0;
-        void * pArg = 0;
-        {
-            epicsGuard < epicsMutex >
-                guard ( pcac->mutex );
-            if ( pcac->fdRegFuncNeedsToBeCalled ) {
-                pFunc = pcac->fdRegFunc;
-                pArg = pcac->fdRegArg;
-                pcac->fdRegFuncNeedsToBeCalled = false;
-            }
-        }
-        if ( pFunc ) {
-            ( *pFunc ) ( pArg, pcac->sock, true );
-        }
-    }
+    pcac->fileDescriptorRegister ();
 
     try {
         epicsGuard < epicsMutex > guard ( pcac->mutex );
@@ -327,27 +347,51 @@ int epicsStdCall ca_create_channel (
         // the connect sequence will not start until initiateConnect()
         // is called
     }
-    catch ( cacChannel::badString & ) {
-        return ECA_BADSTR;
-    }
-    catch ( std::bad_alloc & ) {
-        return ECA_ALLOCMEM;
-    }
-    catch ( cacChannel::badPriority & ) {
-        return ECA_BADPRIORITY;
+    catch ( ... ) {
+        return caCreateChannelStatus ( pcac, "ca_create_channel" );
     }
-    catch ( cacChannel::unsupportedByService & ) {
-        return ECA_UNAVAILINSERV;
+
+    return ECA_NORMAL;
+}
+
+// extern "C"
+int epicsStdCall ca_create_channels (
+     unsigned nChannels, const char * const * pNames, caCh * conn_func,
+     void * const * pUserPrivates, capri priority, chid * pChanIDs )
+{
+    ca_client_context * pcac;
+    int caStatus = fetchClientContext ( & pcac );
+    if ( caStatus != ECA_NORMAL ) {
+        return caStatus;
     }
-    catch ( std :: exception & except ) {
-        pcac->printFormated (
-            "ca_create_channel: "
-            "unexpected exception was \"%s\"",
-            except.what () );
-        return ECA_INTERNAL;
+
+    pcac->fileDescriptorRegister ();
+
+    unsigned nCreated = 0u;
+    try {
+        epicsGuard < epicsMutex > guard ( pcac->mutex );
+        pcac->reserveChannels ( guard, nChannels );
+        while ( nCreated < nChannels ) {
+            void * puser = pUserPrivates ? pUserPrivates[nCreated] : 0;
+            pChanIDs[nCreated] =
+                new ( pcac->oldChannelNotifyFreeList )
+                    oldChannelNotify ( guard, *pcac, pNames[nCreated],
+                        conn_func, puser, priority );
+            nCreated++;
+        }
+        // none of them connect until all of them exist, so
+        // that a failure above is undone without any callbacks
+        for ( unsigned i = 0u; i < nChannels; i++ ) {
+            pChanIDs[i]->initiateConnect ( guard );
+        }
+        pcac->startSearches ( guard );
     }
     catch ( ... ) {
-        return ECA_INTERNAL;
+        caStatus = caCreateChannelStatus ( pcac, "ca_create_channels" );
+        while ( nCreated > 0u ) {
+            ca_clear_channel ( pChanIDs[--nCreated] );
+        }
+        return caStatus;
     }
 
     return ECA_NORMAL;
@@ -679,6 +723,23 @@ unsigned epicsStdCall ca_get_ioc_connection_count ()
     return pcac->circuitCount ();
 }
 
+/*
+ * ca_connection_progress()
+ */
+// extern "C"
+int epicsStdCall ca_connection_progress (
+    unsigned * pChannels, unsigned * pConnected )
+{
+    ca_client_context * pcac;
+    int caStatus = fetchClientContext ( & pcac );
+    if ( caStatus != ECA_NORMAL ) {
+        return caStatus;
+    }
+
+    pcac->connectionProgress ( *pChannels, *pConnected );
+    return ECA_NORMAL;
+}
+
 unsigned epicsStdCall ca_beacon_anomaly_count ()
 {
     ca_client_context * pcac;
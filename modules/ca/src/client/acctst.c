@@ -2076,6 +2076,125 @@ void arrayTest ( chid chan, unsigned maxArrayBytes, unsigned interestLevel )
     showProgressEnd ( interestLevel );
 }
 
+typedef struct {
+    const void * volatile pDbr;
+    volatile int status;
+    volatile unsigned count;
+} bufferTestState;
+
+static void bufferTestEvent ( struct event_handler_args args )
+{
+    bufferTestState * pState = ( bufferTestState * ) args.usr;
+    pState->pDbr = args.dbr;
+    pState->status = args.status;
+    pState->count++;
+}
+
+static void bufferTestWait ( bufferTestState * pState, unsigned count )
+{
+    ca_flush_io ();
+    while ( pState->count < count ) {
+        epicsThreadSleep ( 0.01 );
+        ca_poll (); /* emulate typical GUI */
+    }
+}
+
+/*
+ * verify that subscription updates are placed in the buffers
+ * supplied with ca_set_subscription_buffers ()
+ */
+void subscriptionBufferTest ( chid chan, unsigned interestLevel )
+{
+    dbr_long_t ring[2], small, value;
+    void * pRing[2];
+    void * pSmall;
+    unsigned char * pBytes;
+    bufferTestState state;
+    unsigned i;
+    int status;
+    evid id;
+
+    if ( ! ca_write_access ( chan ) ) {
+        printf ( "skipped subscriptionBufferTest - no write access\n" );
+        return;
+    }
+    if ( dbr_value_class[ca_field_type ( chan )] != dbr_class_float &&
+            dbr_value_class[ca_field_type ( chan )] != dbr_class_int ) {
+        printf ( "skipped subscriptionBufferTest - not a numeric type\n" );
+        return;
+    }
+
+    showProgressBegin ( "subscriptionBufferTest", interestLevel );
+
+    value = 1;
+    SEVCHK ( ca_put ( DBR_LONG, chan, &value ), NULL );
+
+    pRing[0] = &ring[0];
+    pRing[1] = &ring[1];
+    state.count = 0u;
+    status = ca_create_subscription ( DBR_LONG, 1, chan, DBE_VALUE,
+        bufferTestEvent, &state, &id );
+    SEVCHK ( status, NULL );
+    status = ca_set_subscription_buffers ( id, 2u, pRing,
+        sizeof ( ring[0] ), 0u );
+    SEVCHK ( status, NULL );
+
+    /* the updates go round the ring */
+    bufferTestWait ( &state, 1u );
+    verify ( state.status == ECA_NORMAL );
+    verify ( state.pDbr == &ring[0] );
+    verify ( ring[0] == 1 );
+    for ( i = 2u; i < 6u; i++ ) {
+        value = i;
+        SEVCHK ( ca_put ( DBR_LONG, chan, &value ), NULL );
+        bufferTestWait ( &state, i );
+        verify ( state.status == ECA_NORMAL );
+        verify ( state.pDbr == pRing[(i-1u)%2u] );
+        verify ( ring[(i-1u)%2u] == value );
+    }
+
+    /* network byte order */
+    status = ca_set_subscription_buffers ( id, 2u, pRing,
+        sizeof ( ring[0] ), CA_BUFFER_NETWORK_ORDER );
+    SEVCHK ( status, NULL );
+    value = 0x1234;
+    SEVCHK ( ca_put ( DBR_LONG, chan, &value ), NULL );
+    bufferTestWait ( &state, 6u );
+    verify ( state.status == ECA_NORMAL );
+    verify ( state.pDbr == &ring[0] );
+    pBytes = ( unsigned char * ) &ring[0];
+    verify ( pBytes[0] == 0 && pBytes[1] == 0 &&
+        pBytes[2] == 0x12 && pBytes[3] == 0x34 );
+
+    /* an update which doesn't fit */
+    pSmall = &small;
+    status = ca_set_subscription_buffers ( id, 1u, &pSmall,
+        sizeof ( small ) - 1u, 0u );
+    SEVCHK ( status, NULL );
+    value = 7;
+    SEVCHK ( ca_put ( DBR_LONG, chan, &value ), NULL );
+    bufferTestWait ( &state, 7u );
+    verify ( state.status == ECA_TOLARGE );
+    verify ( state.pDbr == NULL );
+
+    /* back to normal delivery */
+    status = ca_set_subscription_buffers ( id, 0u, NULL, 0u, 0u );
+    SEVCHK ( status, NULL );
+    value = 8;
+    SEVCHK ( ca_put ( DBR_LONG, chan, &value ), NULL );
+    bufferTestWait ( &state, 8u );
+    verify ( state.status == ECA_NORMAL );
+    verify ( state.pDbr != &small && state.pDbr != &ring[0] &&
+        state.pDbr != &ring[1] );
+
+    status = ca_set_subscription_buffers ( id, 1u, NULL, 4u, 0u );
+    verify ( status == ECA_BADCOUNT );
+
+    SEVCHK ( ca_clear_subscription ( id ), NULL );
+
+    showProgressEnd ( interestLevel );
+}
+
 /*
  * verify that unequal send/recv buffer sizes work
  * (a bug related to this test was detected in early R3.14)
@@ -3411,6 +3530,9 @@ int acctst ( const char * pName, unsigned interestLevel, unsigned channelCount,
     if ( select == ca_enable_preemptive_callback ) {
         printf ( "Preemptive call back is enabled.\n" );
     }
+    else if ( select == ca_enable_concurrent_callback ) {
+        printf ( "Concurrent call back is enabled.\n" );
+    }
 
     {
         char tmpString[32];
@@ -3467,6 +3589,7 @@ int acctst ( const char * pName, unsigned interestLevel, unsigned channelCount,
     exceptionTest ( chan, interestLevel );
     arrayTest ( chan, maxArrayBytes, interestLevel );
     verifyMonitorSubscriptionFlushIO ( chan, interestLevel );
+    subscriptionBufferTest ( chan, interestLevel );
     monitorSubscriptionFirstUpdateTest ( pName, chan, interestLevel );
     ctrlDoubleTest ( chan, interestLevel );
     verifyBlockInPendIO ( chan, interestLevel );
@@ -3486,7 +3609,7 @@ int acctst ( const char * pName, unsigned interestLevel, unsigned channelCount,
     verifyHighThroughputWriteCallback ( chan, interestLevel );
     verifyBadString ( chan, interestLevel );
     verifyMultithreadSubscr ( pName, interestLevel );
-    if ( select != ca_enable_preemptive_callback ) {
+    if ( select == ca_disable_preemptive_callback ) {
         fdManagerVerify ( pName, interestLevel );
     }
 
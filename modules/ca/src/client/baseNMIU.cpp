@@ -34,6 +34,12 @@ void baseNMIU::forceSubscriptionUpdate (
 {
 }
 
+void * baseNMIU::updateBuffer (
+        epicsGuard < epicsMutex > &, arrayElementCount, bool & )
+{
+    return 0;
+}
+
 
 
 
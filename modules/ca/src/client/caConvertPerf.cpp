@@ -0,0 +1,152 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Measure the speed of the CA wire format conversions of arrays, and
+ * compare it with converting one element at a time.
+ *
+ *   caConvertPerf [element count ...]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "epicsTime.h"
+#include "osiWireFormat.h"
+
+#include "net_convert.h"
+
+namespace {
+
+// one element at a time, as the library did before
+template < class T >
+void elementConvert ( const void * pSrc, void * pDest,
+    int hton, arrayElementCount count )
+{
+    const T * pS = static_cast < const T * > ( pSrc );
+    T * pD = static_cast < T * > ( pDest );
+    for ( arrayElementCount i = 0; i < count; i++ ) {
+        if ( hton ) {
+            AlignedWireRef < T > tmp ( pD[i] );
+            tmp = pS[i];
+        }
+        else {
+            pD[i] = AlignedWireRef < const T > ( pS[i] );
+        }
+    }
+}
+
+struct convertTest {
+    const char * pName;
+    unsigned type;
+    size_t elementSize;
+    void ( * pElementConvert ) ( const void *, void *,
+        int, arrayElementCount );
+};
+
+const convertTest tests[] = {
+    { "DBR_SHORT", DBR_SHORT, sizeof ( dbr_short_t ),
+        elementConvert < epicsUInt16 > },
+    { "DBR_ENUM", DBR_ENUM, sizeof ( dbr_enum_t ),
+        elementConvert < epicsUInt16 > },
+    { "DBR_LONG", DBR_LONG, sizeof ( dbr_long_t ),
+        elementConvert < epicsUInt32 > },
+    { "DBR_FLOAT", DBR_FLOAT, sizeof ( dbr_float_t ),
+        elementConvert < epicsFloat32 > },
+    { "DBR_DOUBLE", DBR_DOUBLE, sizeof ( dbr_double_t ),
+        elementConvert < epicsFloat64 > },
+};
+
+// MB/s of converting the array for about half a second
+double rate ( const convertTest & test, bool library, bool inPlace,
+    char * pSrc, char * pDest, arrayElementCount count )
+{
+    if ( inPlace ) {
+        pDest = pSrc;
+    }
+    epicsTime begin = epicsTime::getCurrent ();
+    unsigned long passes = 0;
+    double elapsed;
+    do {
+        for ( unsigned i = 0; i < 16; i++ ) {
+            if ( library ) {
+                caNetConvert ( test.type, pSrc, pDest, i & 1, count );
+            }
+            else {
+                ( *test.pElementConvert ) ( pSrc, pDest, i & 1, count );
+            }
+        }
+        passes += 16;
+        elapsed = epicsTime::getCurrent () - begin;
+    } while ( elapsed < 0.5 );
+    return passes * count * test.elementSize / elapsed / 1e6;
+}
+
+int runTests ( arrayElementCount count )
+{
+    int failures = 0;
+
+    printf ( "%lu elements\n", count );
+    printf ( "%-12s %14s %14s %14s %14s\n", "MB/s", "per element",
+        "array", "per element", "array" );
+    printf ( "%-12s %14s %14s %14s %14s\n", "", "",
+        "", "in place", "in place" );
+    for ( unsigned i = 0; i < sizeof ( tests ) / sizeof ( tests[0] ); i++ ) {
+        const convertTest & test = tests[i];
+        size_t size = count * test.elementSize;
+        char * pSrc = static_cast < char * > ( malloc ( size ) );
+        char * pRef = static_cast < char * > ( malloc ( size ) );
+        char * pDest = static_cast < char * > ( malloc ( size ) );
+        if ( ! pSrc || ! pRef || ! pDest ) {
+            fprintf ( stderr, "caConvertPerf: out of memory\n" );
+            exit ( 1 );
+        }
+        for ( size_t j = 0; j < size; j++ ) {
+            pSrc[j] = static_cast < char > ( rand () );
+        }
+
+        for ( int hton = 0; hton < 2; hton++ ) {
+            ( *test.pElementConvert ) ( pSrc, pRef, hton, count );
+            caNetConvert ( test.type, pSrc, pDest, hton, count );
+            if ( memcmp ( pRef, pDest, size ) ) {
+                printf ( "%s: conversion differs from the reference\n",
+                    test.pName );
+                failures++;
+            }
+        }
+
+        double element = rate ( test, false, false, pSrc, pDest, count );
+        double array = rate ( test, true, false, pSrc, pDest, count );
+        double elementInPlace = rate ( test, false, true, pSrc, pDest, count );
+        double arrayInPlace = rate ( test, true, true, pSrc, pDest, count );
+        printf ( "%-12s %14.0f %14.0f %14.0f %14.0f\n", test.pName,
+            element, array, elementInPlace, arrayInPlace );
+
+        free ( pSrc );
+        free ( pRef );
+        free ( pDest );
+    }
+    return failures;
+}
+
+} // namespace
+
+int main ( int argc, char ** argv )
+{
+    int failures = 0;
+
+    if ( argc > 1 ) {
+        for ( int i = 1; i < argc; i++ ) {
+            failures += runTests ( strtoul ( argv[i], 0, 10 ) );
+        }
+    }
+    else {
+        failures += runTests ( 1000u );
+        failures += runTests ( 100000u );
+        failures += runTests ( 4000000u );
+    }
+    return failures ? 1 : 0;
+}
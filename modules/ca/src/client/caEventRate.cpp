@@ -14,43 +14,83 @@
 
 #include "cadef.h"
 #include "dbDefs.h"
+#include "epicsAtomic.h"
 #include "epicsTime.h"
 #include "errlog.h"
 
+void caEventRate ( const char * const *pNames, unsigned nNames,
+    unsigned count, ca_preemptive_callback_select select,
+    double callbackWork );
+
+struct eventRateCounter {
+    size_t count;
+    epicsUInt64 workNanoSec;
+};
+
 /*
  * event_handler()
  */
 extern "C" void eventCallBack ( struct event_handler_args args )
 {
-    unsigned *pCount = static_cast < unsigned * > ( args.usr );
-    (*pCount)++;
+    eventRateCounter *pCounter = static_cast < eventRateCounter * > ( args.usr );
+    if ( pCounter->workNanoSec ) {
+        // simulate a callback which does some work with the value
+        epicsUInt64 begin = epicsMonotonicGet ();
+        while ( epicsMonotonicGet () - begin < pCounter->workNanoSec ) {
+        }
+    }
+    epicsAtomicIncrSizeT ( & pCounter->count );
 }
 
 /*
  * caEventRate ()
  */
 void caEventRate ( const char *pName, unsigned count )
+{
+    caEventRate ( & pName, 1u, count,
+        ca_disable_preemptive_callback, 0.0 );
+}
+
+/*
+ * caEventRate ()
+ *
+ * Subscribes count times to each of the channels, and reports the
+ * total rate of subscription updates. The channels should be served by
+ * different servers to measure callbacks from several circuits.
+ */
+void caEventRate ( const char * const *pNames, unsigned nNames,
+    unsigned count, ca_preemptive_callback_select select,
+    double callbackWork )
 {
     static const double initialSamplePeriod = 1.0;
     static const double maxSamplePeriod = 60.0 * 5.0;
-    unsigned eventCount = 0u;
+    eventRateCounter counter;
+    unsigned total = nNames * count;
+
+    counter.count = 0u;
+    counter.workNanoSec = static_cast < epicsUInt64 > ( callbackWork * 1e9 );
+
+    int status = ca_context_create ( select );
+    SEVCHK ( status, NULL );
 
-    chid * pChidTable = new chid [ count ];
+    chid * pChidTable = new chid [ total ];
 
     {
-        printf ( "Connecting to CA Channel \"%s\" %u times.",
-                    pName, count );
+        printf ( "Connecting to %u CA Channel(s) %u times.",
+                    nNames, count );
         fflush ( stdout );
 
         epicsTime begin = epicsTime::getCurrent ();
-        for ( unsigned i = 0u; i < count; i++ ) {
-            int status = ca_search ( pName,  & pChidTable[i] );
+        for ( unsigned i = 0u; i < total; i++ ) {
+            status = ca_search ( pNames[i % nNames],  & pChidTable[i] );
             SEVCHK ( status, NULL );
         }
 
-        int status = ca_pend_io ( 10000.0 );
+        status = ca_pend_io ( 10000.0 );
         if ( status != ECA_NORMAL ) {
             fprintf ( stderr, " not found.\n" );
+            delete [] pChidTable;
+            ca_context_destroy ();
             return;
         }
         epicsTime end = epicsTime::getCurrent ();
@@ -59,17 +99,17 @@ void caEventRate ( const char *pName, unsigned count )
     }
 
     {
-        printf ( "Subscribing %u times.", count );
+        printf ( "Subscribing %u times.", total );
         fflush ( stdout );
 
         epicsTime begin = epicsTime::getCurrent ();
-        for ( unsigned i = 0u; i < count; i++ ) {
+        for ( unsigned i = 0u; i < total; i++ ) {
             int addEventStatus = ca_add_event ( DBR_FLOAT,
-                pChidTable[i], eventCallBack, &eventCount, NULL);
+                pChidTable[i], eventCallBack, &counter, NULL);
             SEVCHK ( addEventStatus, __FILE__ );
         }
 
-        int status = ca_flush_io ();
+        status = ca_flush_io ();
         SEVCHK ( status, __FILE__ );
 
         epicsTime end = epicsTime::getCurrent ();
@@ -83,8 +123,8 @@ void caEventRate ( const char *pName, unsigned count )
 
         // let the first one go by
         epicsTime begin = epicsTime::getCurrent ();
-        while ( eventCount < count ) {
-            int status = ca_pend_event ( 0.01 );
+        while ( epicsAtomicGetSizeT ( & counter.count ) < total ) {
+            status = ca_pend_event ( 0.01 );
             if ( status != ECA_TIMEOUT ) {
                 SEVCHK ( status, NULL );
             }
@@ -99,23 +139,19 @@ void caEventRate ( const char *pName, unsigned count )
     double XX = 0.0;
     unsigned N = 0u;
     while ( true ) {
-        unsigned nEvents, lastEventCount, curEventCount;
+        size_t nEvents, lastEventCount, curEventCount;
 
         epicsTime beginPend = epicsTime::getCurrent ();
-        lastEventCount = eventCount;
-        int status = ca_pend_event ( samplePeriod );
-        curEventCount = eventCount;
+        lastEventCount = epicsAtomicGetSizeT ( & counter.count );
+        status = ca_pend_event ( samplePeriod );
+        curEventCount = epicsAtomicGetSizeT ( & counter.count );
         epicsTime endPend = epicsTime::getCurrent ();
         if ( status != ECA_TIMEOUT ) {
             SEVCHK ( status, NULL );
         }
 
-        if ( curEventCount >= lastEventCount ) {
-            nEvents = curEventCount - lastEventCount;
-        }
-        else {
-            nEvents = ( UINT_MAX - lastEventCount ) + curEventCount + 1u;
-        }
+        // unsigned arithmetic also handles wrap around
+        nEvents = curEventCount - lastEventCount;
 
         N++;
 
@@ -136,4 +172,3 @@ void caEventRate ( const char *pName, unsigned count )
         }
     }
 }
-
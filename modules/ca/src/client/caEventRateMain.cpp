@@ -11,28 +11,69 @@
 #include <stdio.h>
 #include <stdlib.h>
 
-void caEventRate ( const char *pName, unsigned count );
+#include "cadef.h"
+#include "epicsGetopt.h"
+
+void caEventRate ( const char * const *pNames, unsigned nNames,
+    unsigned count, ca_preemptive_callback_select select,
+    double callbackWork );
+
+static void usage ( const char *pProg )
+{
+    fprintf ( stderr, "usage: %s [-p | -c] [-w <usec>] "
+        "< PV name > [< PV name > ...] [subscription count]\n"
+        "  -p  preemptive callbacks\n"
+        "  -c  concurrent callbacks, one thread for each server\n"
+        "  -w  busy wait for <usec> microseconds in each callback\n",
+        pProg );
+}
 
 int main ( int argc, char **argv )
 {
-    if ( argc < 2 || argc > 3 ) {
-        fprintf ( stderr, "usage: %s < PV name > [subscription count]\n", argv[0] );
-        return 0;
-    }
+    ca_preemptive_callback_select select = ca_disable_preemptive_callback;
+    double callbackWork = 0.0;
+    int opt;
 
-    unsigned count;
-    if ( argc == 3 ) {
-        int status = sscanf ( argv[2], " %u ", & count );
-        if ( status != 1 ) {
-            fprintf ( stderr, "expected unsigned integer 2nd argument\n" );
+    while ( ( opt = getopt ( argc, argv, "pcw:" ) ) != -1 ) {
+        switch ( opt ) {
+        case 'p':
+            select = ca_enable_preemptive_callback;
+            break;
+        case 'c':
+            select = ca_enable_concurrent_callback;
+            break;
+        case 'w':
+            if ( sscanf ( optarg, " %lf ", & callbackWork ) != 1 ||
+                    callbackWork < 0.0 ) {
+                fprintf ( stderr, "expected microseconds for -w\n" );
+                return 0;
+            }
+            callbackWork *= 1e-6;
+            break;
+        default:
+            usage ( argv[0] );
             return 0;
         }
     }
-    else {
-        count = 1;
+
+    int nNames = argc - optind;
+    unsigned count = 1;
+    if ( nNames > 1 ) {
+        // a trailing unsigned integer is the subscription count
+        char *pEnd;
+        unsigned long value = strtoul ( argv[argc - 1], & pEnd, 10 );
+        if ( *pEnd == '\0' ) {
+            count = static_cast < unsigned > ( value );
+            nNames--;
+        }
+    }
+    if ( nNames < 1 || count < 1 ) {
+        usage ( argv[0] );
+        return 0;
     }
 
-    caEventRate ( argv[1], count );
+    caEventRate ( argv + optind, static_cast < unsigned > ( nNames ),
+        count, select, callbackWork );
 
     return 0;
 }
@@ -58,7 +58,8 @@ extern epicsThreadPrivateId caClientContextId;
 cacService * ca_client_context::pDefaultService = 0;
 epicsMutex * ca_client_context::pDefaultServiceInstallMutex;
 
-ca_client_context::ca_client_context ( bool enablePreemptiveCallback ) :
+ca_client_context::ca_client_context ( bool enablePreemptiveCallback,
+        bool enableConcurrentCallback ) :
     mutex(__FILE__, __LINE__),
     cbMutex(__FILE__, __LINE__),
     createdByThread ( epicsThreadGetIdSelf () ),
@@ -83,7 +84,8 @@ ca_client_context::ca_client_context ( bool enablePreemptiveCallback ) :
                     this->mutex, this->cbMutex, *this ) );
         }
         else {
-            this->pServiceContext.reset ( new cac ( this->mutex, this->cbMutex, *this ) );
+            this->pServiceContext.reset ( new cac ( this->mutex, this->cbMutex,
+                *this, enableConcurrentCallback ) );
         }
     }
 
@@ -255,6 +257,27 @@ void ca_client_context::registerForFileDescriptorCallBack (
 // should block here until related callback in progress completes
 }
 
+//
+// call the file descriptor registration function for the
+// UDP socket when the first channel is created
+//
+void ca_client_context::fileDescriptorRegister ()
+{
+    CAFDHANDLER * pFunc = 0;
+    void * pArg = 0;
+    {
+        epicsGuard < epicsMutex > guard ( this->mutex );
+        if ( this->fdRegFuncNeedsToBeCalled ) {
+            pFunc = this->fdRegFunc;
+            pArg = this->fdRegArg;
+            this->fdRegFuncNeedsToBeCalled = false;
+        }
+    }
+    if ( pFunc ) {
+        ( *pFunc ) ( pArg, this->sock, true );
+    }
+}
+
 int ca_client_context :: printFormated (
     const char *pformat, ... ) const
 {
@@ -672,6 +695,19 @@ cacChannel & ca_client_context::createChannel (
         guard, pChannelName, chan, pri );
 }
 
+void ca_client_context::reserveChannels (
+    epicsGuard < epicsMutex > & guard, unsigned nChannels )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->pServiceContext->reserveChannels ( guard, nChannels );
+}
+
+void ca_client_context::startSearches ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->pServiceContext->startSearches ( guard );
+}
+
 void ca_client_context::flush ( epicsGuard < epicsMutex > & guard )
 {
     this->pServiceContext->flush ( guard );
@@ -683,6 +719,14 @@ unsigned ca_client_context::circuitCount () const
     return this->pServiceContext->circuitCount ( guard );
 }
 
+void ca_client_context::connectionProgress (
+    unsigned & nChannels, unsigned & nConnected ) const
+{
+    epicsGuard < epicsMutex > guard ( this->mutex );
+    this->pServiceContext->connectionProgress (
+        guard, nChannels, nConnected );
+}
+
 unsigned ca_client_context::beaconAnomaliesSinceProgramStart () const
 {
     epicsGuard < epicsMutex > guard ( this->mutex );
@@ -789,6 +833,42 @@ LIBCA_API int epicsStdCall ca_clear_subscription ( evid pMon )
     return ECA_NORMAL;
 }
 
+LIBCA_API int epicsStdCall ca_set_subscription_buffers ( evid pMon,
+    unsigned nBuffers, void * const * pBuffers,
+    unsigned long bufferSize, unsigned flags )
+{
+    if ( nBuffers > 0u && ( ! pBuffers || bufferSize == 0u ) ) {
+        return ECA_BADCOUNT;
+    }
+    for ( unsigned i = 0u; i < nBuffers; i++ ) {
+        if ( ! pBuffers[i] ) {
+            return ECA_BADCOUNT;
+        }
+    }
+    oldChannelNotify & chan = pMon->channel ();
+    ca_client_context & cac = chan.getClientCtx ();
+    try {
+        // the circuit may be placing an update in the old buffers,
+        // which it only does while holding the callback lock
+        if ( cac.pCallbackGuard.get() &&
+            cac.createdByThread == epicsThreadGetIdSelf () ) {
+            epicsGuard < epicsMutex > guard ( cac.mutex );
+            pMon->setBuffers ( guard, nBuffers, pBuffers, bufferSize,
+                ( flags & CA_BUFFER_NETWORK_ORDER ) != 0u );
+        }
+        else {
+            CallbackGuard cbGuard ( cac.cbMutex );
+            epicsGuard < epicsMutex > guard ( cac.mutex );
+            pMon->setBuffers ( guard, nBuffers, pBuffers, bufferSize,
+                ( flags & CA_BUFFER_NETWORK_ORDER ) != 0u );
+        }
+    }
+    catch ( std::bad_alloc & ) {
+        return ECA_ALLOCMEM;
+    }
+    return ECA_NORMAL;
+}
+
 void ca_client_context :: eliminateExcessiveSendBacklog (
     epicsGuard < epicsMutex > & guard, cacChannel & chan )
 {
@@ -129,7 +129,8 @@ const cac::pExcepProtoStubTCP cac::tcpExcepJumpTableCAC [] =
 cac::cac (
     epicsMutex & mutualExclusionIn,
     epicsMutex & callbackControlIn,
-    cacContextNotify & notifyIn ) :
+    cacContextNotify & notifyIn,
+    bool concurrentCallbacksIn ) :
     _refLocalHostName ( localHostNameCache.getReference () ),
     programBeginTime ( epicsTime::getCurrent() ),
     connTMO ( CA_CONN_VERIFY_PERIOD ),
@@ -149,7 +150,8 @@ cac::cac (
     maxContigFrames ( contiguousMsgCountWhichTriggersFlowControl ),
     beaconAnomalyCount ( 0u ),
     iiuExistenceCount ( 0u ),
-    cacShutdownInProgress ( false )
+    cacShutdownInProgress ( false ),
+    concurrentCallback ( concurrentCallbacksIn )
 {
     if ( ! osiSockAttach () ) {
         throwWithLocation ( udpiiu :: noSocket () );
@@ -405,6 +407,54 @@ unsigned cac::circuitCount (
     return this->circuitList.count ();
 }
 
+void cac::createUDPIIU ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( ! this->pudpiiu ) {
+        this->pudpiiu = new udpiiu (
+            guard, this->timerQueue, this->cbMutex,
+            this->mutex, this->notify, *this, this->_serverPort,
+            this->searchDestList );
+    }
+}
+
+//
+// called before creating many channels at once
+//
+void cac::reserveChannels (
+    epicsGuard < epicsMutex > & guard, unsigned nChannels )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->chanTable.setTableSize (
+        this->chanTable.numEntriesInstalled () + nChannels );
+}
+
+//
+// send the search requests for new channels now rather than
+// when the first search timer next expires
+//
+void cac::startSearches ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( this->pudpiiu ) {
+        this->pudpiiu->startSearches ( guard );
+    }
+}
+
+void cac::connectionProgress (
+    epicsGuard < epicsMutex > & guard, unsigned & nChannels,
+    unsigned & nConnected ) const
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    nChannels = this->chanTable.numEntriesInstalled ();
+    nConnected = 0u;
+    tsDLIterConst < tcpiiu > iter = this->circuitList.firstIter ();
+    while ( iter.valid () ) {
+        nConnected += iter->connectedChannelCount ( guard );
+        iter++;
+    }
+}
+
 void cac::show (
     epicsGuard < epicsMutex > & guard, unsigned level ) const
 {
@@ -419,6 +469,9 @@ void cac::show (
     if ( level > 0u ) {
         this->serverTable.show ( level - 1u );
         ::printf ( "\tconnection time out watchdog period %f\n", this->connTMO );
+        if ( this->concurrentCallback ) {
+            ::printf ( "\tsubscription updates are delivered concurrently\n" );
+        }
     }
 
     if ( level > 1u ) {
@@ -521,12 +574,7 @@ cacChannel & cac::createChannel (
         throw cacChannel::badString ();
     }
 
-    if ( ! this->pudpiiu ) {
-        this->pudpiiu = new udpiiu (
-            guard, this->timerQueue, this->cbMutex,
-            this->mutex, this->notify, *this, this->_serverPort,
-            this->searchDestList );
-    }
+    this->createUDPIIU ( guard );
 
     nciu * pNetChan = new ( this->channelFreeList )
             nciu ( *this, noopIIU, chan, pName, pri );
@@ -742,6 +790,9 @@ bool cac::destroyIO (
 
     baseNMIU * pIO = this->ioTable.remove ( idIn );
     if ( pIO ) {
+        if ( this->concurrentCallback ) {
+            this->ioDeliveryWait ( callbackGuard, guard, idIn );
+        }
         class netSubscription * pSubscr = pIO->isSubscription ();
         if ( pSubscr ) {
             pSubscr->unsubscribeIfRequired ( guard, chan );
@@ -755,6 +806,61 @@ bool cac::destroyIO (
     return false;
 }
 
+//
+// With concurrent callbacks a circuit calls subscription update callbacks
+// without the callback lock, so wait for one which may be in progress
+// before the IO is destroyed. It is no longer in the IO table, so there
+// will be no further updates.
+//
+// Update callbacks on two circuits clearing each other's subscriptions
+// would each wait for the other to return. The one that would close
+// such a cycle goes ahead without waiting, as when a callback clears
+// its own subscription.
+//
+void cac::ioDeliveryWait (
+    CallbackGuard & callbackGuard,
+    epicsGuard < epicsMutex > & guard,
+    const cacChannel::ioid & idIn )
+{
+    // a callback may destroy its own subscription
+    void * pSelf = epicsThreadPrivateGet ( caClientCallbackThreadId );
+    tcpiiu * pSelfCircuit = 0;
+    tcpiiu * pDelivering = 0;
+
+    tsDLIter < tcpiiu > iter = this->circuitList.firstIter ();
+    while ( iter.valid () ) {
+        if ( iter.pointer () == pSelf ) {
+            pSelfCircuit = iter.pointer ();
+        }
+        else if ( iter->ioDeliveryInProgress ( guard, idIn ) ) {
+            // only one circuit delivers to an IO
+            pDelivering = iter.pointer ();
+        }
+        iter++;
+    }
+    if ( ! pDelivering ) {
+        return;
+    }
+    if ( pSelfCircuit &&
+            pDelivering->ioDeliveryWaitsFor ( guard, *pSelfCircuit ) ) {
+        return;
+    }
+
+    ioDeliveryWaiter waiter;
+    pDelivering->ioDeliveryWaiterAdd ( guard, waiter );
+    if ( pSelfCircuit ) {
+        pSelfCircuit->ioDeliveryBlockedOn ( guard, pDelivering );
+    }
+    {
+        epicsGuardRelease < epicsMutex > unguard ( guard );
+        epicsGuardRelease < epicsMutex > cbUnguard ( callbackGuard );
+        waiter.done.wait ();
+    }
+    if ( pSelfCircuit ) {
+        pSelfCircuit->ioDeliveryBlockedOn ( guard, 0 );
+    }
+}
+
 void cac::ioShow (
     epicsGuard < epicsMutex > & guard,
     const cacChannel::ioid & idIn, unsigned level ) const
@@ -925,6 +1031,16 @@ bool cac::searchRespAction ( callbackManager &, tcpiiu & iiu,
 
 bool cac::eventRespAction ( callbackManager &, tcpiiu &iiu,
     const epicsTime &, const caHdrLargeArray & hdr, void * pMsgBdy )
+{
+    this->eventRespNotify ( iiu, hdr, pMsgBdy );
+    return true;
+}
+
+//
+// With concurrent callbacks the circuit calls this without the callback lock
+//
+void cac::eventRespNotify ( tcpiiu &iiu,
+    const caHdrLargeArray & hdr, void * pMsgBdy )
 {
     int caStatus;
 
@@ -933,7 +1049,7 @@ bool cac::eventRespAction ( callbackManager &, tcpiiu &iiu,
      * but is now a noop because the IO block is immediately deleted
      */
     if ( ! hdr.m_postsize ) {
-        return true;
+        return;
     }
 
     epicsGuard < epicsMutex > guard ( this->mutex );
@@ -953,14 +1069,23 @@ bool cac::eventRespAction ( callbackManager &, tcpiiu &iiu,
     // The IO destroy routines take the call back mutex
     // when uninstalling and deleting the baseNMIU so there is
     // no need to worry here about the baseNMIU being deleted while
-    // it is in use here.
+    // it is in use here. With concurrent callbacks they instead
+    // wait for the delivery marked here to end.
     //
     baseNMIU * pmiu = this->ioTable.lookup ( hdr.m_available );
     if ( pmiu ) {
+        if ( this->concurrentCallback ) {
+            iiu.ioDeliveryBegin ( guard, hdr.m_available );
+        }
         /*
-         * convert the data buffer from net format to host format
+         * convert the data buffer from net format to host format,
+         * unless it was placed in a buffer which wants network format
          */
-        if ( caStatus == ECA_NORMAL ) {
+        bool networkByteOrder = false;
+        if ( caStatus == ECA_NORMAL &&
+                ( this->eventRespBuffer ( guard, hdr,
+                        & networkByteOrder ) != pMsgBdy ||
+                    ! networkByteOrder ) ) {
             caStatus = caNetConvert (
                 hdr.m_dataType, pMsgBdy, pMsgBdy, false, hdr.m_count );
         }
@@ -973,8 +1098,36 @@ bool cac::eventRespAction ( callbackManager &, tcpiiu &iiu,
                 "subscription update read failed",
                 hdr.m_dataType, hdr.m_count );
         }
+        if ( this->concurrentCallback ) {
+            iiu.ioDeliveryEnd ( guard );
+        }
     }
-    return true;
+}
+
+//
+// The buffer supplied by the subscriber for this update, if any
+//
+void * cac::eventRespBuffer ( epicsGuard < epicsMutex > & guard,
+    const caHdrLargeArray & hdr, bool * pNetworkByteOrder )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+
+    if ( ! dbr_type_is_valid ( hdr.m_dataType ) ||
+            hdr.m_count > hdr.m_postsize ||
+            dbr_size_n ( hdr.m_dataType, hdr.m_count ) > hdr.m_postsize ) {
+        return 0;
+    }
+    baseNMIU * pmiu = this->ioTable.lookup ( hdr.m_available );
+    if ( ! pmiu ) {
+        return 0;
+    }
+    bool networkByteOrder = false;
+    void * pBuf = pmiu->updateBuffer ( guard,
+        dbr_size_n ( hdr.m_dataType, hdr.m_count ), networkByteOrder );
+    if ( pNetworkByteOrder ) {
+        *pNetworkByteOrder = networkByteOrder;
+    }
+    return pBuf;
 }
 
 bool cac::readRespAction ( callbackManager &, tcpiiu &,
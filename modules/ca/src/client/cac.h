@@ -104,7 +104,8 @@ public:
     cac (
         epicsMutex & mutualExclusion,
         epicsMutex & callbackControl,
-        cacContextNotify & );
+        cacContextNotify &,
+        bool concurrentCallbacks = false );
     virtual ~cac ();
 
     // beacon management
@@ -177,6 +178,12 @@ public:
 
     // diagnostics
     unsigned circuitCount ( epicsGuard < epicsMutex > & ) const;
+    void reserveChannels (
+        epicsGuard < epicsMutex > &, unsigned nChannels );
+    void startSearches ( epicsGuard < epicsMutex > & );
+    void connectionProgress (
+        epicsGuard < epicsMutex > &, unsigned & nChannels,
+        unsigned & nConnected ) const;
     void show ( epicsGuard < epicsMutex > &, unsigned level ) const;
     int printFormated (
         epicsGuard < epicsMutex > & callbackControl,
@@ -189,6 +196,7 @@ public:
     unsigned maxContiguousFrames ( epicsGuard < epicsMutex > & ) const;
 
     // misc
+    bool concurrentCallbacks () const;
     const char * userNamePointer () const;
     unsigned getInitializingThreadsPriority () const;
     epicsMutex & mutexRef ();
@@ -268,6 +276,7 @@ private:
     unsigned short _serverPort;
     unsigned iiuExistenceCount;
     bool cacShutdownInProgress;
+    const bool concurrentCallback;
 
     void recycleReadNotifyIO (
         epicsGuard < epicsMutex > &, netReadNotifyIO &io );
@@ -301,6 +310,12 @@ private:
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
     bool eventRespAction ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
+    void eventRespNotify ( tcpiiu &, const caHdrLargeArray &, void *pMsgBdy );
+    void * eventRespBuffer ( epicsGuard < epicsMutex > &,
+        const caHdrLargeArray &, bool * pNetworkByteOrder = 0 );
+    void createUDPIIU ( epicsGuard < epicsMutex > & );
+    void ioDeliveryWait ( CallbackGuard &, epicsGuard < epicsMutex > &,
+        const cacChannel::ioid & );
     bool readRespAction ( callbackManager &, tcpiiu &,
         const epicsTime & currentTime, const caHdrLargeArray &, void *pMsgBdy );
     bool clearChannelRespAction ( callbackManager &, tcpiiu &,
@@ -351,6 +366,11 @@ inline const char * cac::userNamePointer () const
     return this->pUserName;
 }
 
+inline bool cac::concurrentCallbacks () const
+{
+    return this->concurrentCallback;
+}
+
 inline unsigned cac::getInitializingThreadsPriority () const
 {
     return this->initializingThreadsPriority;
@@ -139,6 +139,24 @@ const char * cacChannel::pHostName (
 
 cacContext::~cacContext () {}
 
+void cacContext::reserveChannels (
+    epicsGuard < epicsMutex > &, unsigned )
+{
+}
+
+void cacContext::startSearches (
+    epicsGuard < epicsMutex > & )
+{
+}
+
+void cacContext::connectionProgress (
+    epicsGuard < epicsMutex > &, unsigned & nChannels,
+    unsigned & nConnected ) const
+{
+    nChannels = 0u;
+    nConnected = 0u;
+}
+
 cacService::~cacService () {}
 
 
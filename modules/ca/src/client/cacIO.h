@@ -100,6 +100,12 @@ public:
         epicsGuard < epicsMutex > &, int status,
         const char *pContext, unsigned type,
         arrayElementCount count ) = 0;
+    // A subscriber may supply the buffer where its next update of
+    // nBytes is placed, and ask for it to be left in network byte order.
+    // The update is then passed to current () at that address.
+    virtual void * updateBuffer (
+        epicsGuard < epicsMutex > &, arrayElementCount nBytes,
+        bool & networkByteOrder );
 };
 
 class caAccessRights {
@@ -286,6 +292,14 @@ public:
         epicsGuard < epicsMutex > & ) const = 0;
     virtual void show (
         epicsGuard < epicsMutex > &, unsigned level ) const = 0;
+    // used when creating many channels at once, the defaults do nothing
+    virtual void reserveChannels (
+        epicsGuard < epicsMutex > &, unsigned nChannels );
+    virtual void startSearches (
+        epicsGuard < epicsMutex > & );
+    virtual void connectionProgress (
+        epicsGuard < epicsMutex > &, unsigned & nChannels,
+        unsigned & nConnected ) const;
 };
 
 class LIBCA_API cacContextNotify {
@@ -26,3 +26,9 @@
 cacStateNotify::~cacStateNotify ()
 {
 }
+
+void * cacStateNotify::updateBuffer (
+    epicsGuard < epicsMutex > &, arrayElementCount, bool & )
+{
+    return 0;
+}
@@ -174,7 +174,8 @@ LIBCA_API enum channel_state epicsStdCall ca_state (chid chan);
 /************************************************************************/
 LIBCA_API int epicsStdCall ca_task_initialize (void);
 enum ca_preemptive_callback_select
-{ ca_disable_preemptive_callback, ca_enable_preemptive_callback };
+{ ca_disable_preemptive_callback, ca_enable_preemptive_callback,
+  ca_enable_concurrent_callback };
 LIBCA_API int epicsStdCall 
         ca_context_create (enum ca_preemptive_callback_select select);
 LIBCA_API void epicsStdCall ca_detach_context (); 
@@ -217,6 +218,48 @@ LIBCA_API int epicsStdCall ca_create_channel
      chid           *pChanID
 );
 
+/*
+ * ca_create_channels ()
+ *
+ * Creates many channels with one call, and starts searching for them
+ * immediately. The arguments are as for ca_create_channel() except
+ * that they are arrays of nChannels entries. If pUserPrivates is NULL
+ * then the user private field of each channel is NULL. On failure no
+ * channels are created.
+ *
+ * nChannels            R   number of channels to create
+ * pChanNames           R   array of channel name strings
+ * pConnStateCallback   R   address of connection state change
+ *                          callback function, used by all of the channels
+ * pUserPrivates        R   array of user private pointers, or NULL
+ * priority             R   priority level in the server 0 - 100
+ * pChanIDs             RW  array where the channel ids are written
+ */
+LIBCA_API int epicsStdCall ca_create_channels
+(
+     unsigned           nChannels,
+     const char * const *pChanNames,
+     caCh               *pConnStateCallback,
+     void * const       *pUserPrivates,
+     capri              priority,
+     chid               *pChanIDs
+);
+
+/*
+ * ca_connection_progress ()
+ *
+ * Reports how many network channels exist in the current context, and
+ * how many of them are connected.
+ *
+ * pChannels            W   number of channels
+ * pConnected           W   number of connected channels
+ */
+LIBCA_API int epicsStdCall ca_connection_progress
+(
+     unsigned       *pChannels,
+     unsigned       *pConnected
+);
+
 /*
  * ca_change_connection_event()
  *
@@ -261,6 +304,10 @@ LIBCA_API int epicsStdCall ca_add_exception_event
  * - deallocate resources reserved for a channel
  *
  * chanId   R   channel ID
+ *
+ * With ca_enable_concurrent_callback, this waits for a subscription
+ * update callback of the channel running in another thread to return,
+ * see ca_clear_subscription().
  */
 LIBCA_API int epicsStdCall ca_clear_channel
 (
@@ -501,12 +548,52 @@ LIBCA_API int epicsStdCall ca_create_subscription
  * ca_clear_subscription()
  *
  * eventID  R   event id
+ *
+ * With ca_enable_concurrent_callback, this waits for an update callback
+ * of the subscription running in another thread to return. It does not
+ * wait when called from that callback, nor when update callbacks for
+ * channels on two servers clear each other's subscriptions at the same
+ * time, which would deadlock. Then the caller's own subscription may be
+ * cleared while its callback runs, so an update callback should not use
+ * its event_handler_args after clearing a subscription of another server.
  */
 LIBCA_API int epicsStdCall ca_clear_subscription
 (
      evid eventID
 );
 
+/************************************************************************/
+/*  Supply buffers for the updates of a subscription                    */
+/*                                                                      */
+/************************************************************************/
+/*
+ * ca_set_subscription_buffers()
+ *
+ * Each later update is placed in the next buffer of a ring of
+ * nBuffers buffers, straight from the network receive buffer when
+ * the server is remote, and the dbr pointer passed to the callback
+ * points to it. The callback may keep using the data until the ring
+ * comes back round to that buffer. An update which doesn't fit is
+ * reported to the callback with status ECA_TOLARGE. Passing zero
+ * buffers returns to normal delivery.
+ *
+ * eventID      R   event id
+ * nBuffers     R   number of buffers in the ring, or zero
+ * pBuffers     R   array of nBuffers buffer addresses
+ * bufferSize   R   size of each buffer in bytes
+ * flags        R   zero or CA_BUFFER_NETWORK_ORDER
+ */
+#define CA_BUFFER_NETWORK_ORDER 1 /* leave the data in network byte order */
+
+LIBCA_API int epicsStdCall ca_set_subscription_buffers
+(
+     evid               eventID,
+     unsigned           nBuffers,
+     void * const       *pBuffers,
+     unsigned long      bufferSize,
+     unsigned           flags
+);
+
 LIBCA_API chid epicsStdCall ca_evid_to_chid ( evid id );
 
 
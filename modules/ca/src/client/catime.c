@@ -109,6 +109,40 @@ unsigned    *pInlineIter
     *pInlineIter = 1;
 }
 
+/*
+ * test_create_channels ()
+ */
+static void test_create_channels (
+ti      *pItems,
+unsigned    iterations,
+unsigned    *pInlineIter
+)
+{
+    const char **pNames;
+    chid *pChans;
+    unsigned i;
+    int status;
+
+    pNames = malloc ( iterations * sizeof ( *pNames ) );
+    pChans = malloc ( iterations * sizeof ( *pChans ) );
+    assert ( pNames && pChans );
+    for ( i = 0u; i < iterations; i++ ) {
+        pNames[i] = pItems[i].name;
+    }
+    status = ca_create_channels ( iterations, pNames, NULL, NULL,
+        CA_PRIORITY_DEFAULT, pChans );
+    SEVCHK ( status, NULL );
+    status = ca_pend_io ( 0.0 );
+    SEVCHK ( status, NULL );
+    for ( i = 0u; i < iterations; i++ ) {
+        pItems[i].chix = pChans[i];
+    }
+    free ( pNames );
+    free ( pChans );
+
+    *pInlineIter = 1;
+}
+
 /*
  * test_sync_search()
  */
@@ -535,6 +569,7 @@ int catime ( const char * channelName,
     int j;
     unsigned strsize;
     unsigned nBytesSent, nBytesRecv;
+    chid *pOldChans;
     ti *pItemList;
 
     if ( channelCount == 0 ) {
@@ -583,6 +618,30 @@ int catime ( const char * channelName,
     timeIt ( test_search, pItemList, channelCount, nBytesSent, nBytesRecv );
     printSearchStat ( pItemList, channelCount );
 
+    /*
+     * the first set of channels is cleared afterwards so that
+     * the circuit stays up
+     */
+    pOldChans = malloc ( channelCount * sizeof ( *pOldChans ) );
+    assert ( pOldChans );
+    for ( i = 0; i < channelCount; i++ ) {
+        pOldChans[i] = pItemList[i].chix;
+    }
+    printf ( "Bulk Channel Connect Test\n" );
+    printf ( "-------------------------\n" );
+    timeIt ( test_create_channels, pItemList, channelCount,
+        nBytesSent, nBytesRecv );
+    printSearchStat ( pItemList, channelCount );
+    {
+        unsigned nChannels, nConnected;
+        SEVCHK ( ca_connection_progress ( &nChannels, &nConnected ), NULL );
+        printf ( "%u of %u channels connected\n", nConnected, nChannels );
+    }
+    for ( i = 0; i < channelCount; i++ ) {
+        SEVCHK ( ca_clear_channel ( pOldChans[i] ), NULL );
+    }
+    free ( pOldChans );
+
     for ( i = 0; i < channelCount; i++ ) {
         size_t count = ca_element_count ( pItemList[i].chix );
         size_t size = sizeof ( dbr_string_t ) * count;
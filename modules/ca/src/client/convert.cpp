@@ -97,6 +97,115 @@ inline epicsUInt32 dbr_htonl ( const epicsUInt32 & host )
     return tmp;
 }
 
+/*
+ * Bulk conversion of value arrays
+ *
+ * On little endian hosts with IEEE floating point in the same word
+ * order, converting any numeric type to or from the network format is
+ * a plain byte swap, in either direction. These loops are written so
+ * that the compiler vectorizes them. On x86 they are also built for
+ * AVX2, and the variant to use is chosen on the first conversion.
+ * Elsewhere the per element conversions below are used.
+ */
+#if EPICS_BYTE_ORDER == EPICS_ENDIAN_LITTLE && \
+    EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_LITTLE && \
+    ( defined ( __clang__ ) || ( defined ( __GNUC__ ) && \
+        ( __GNUC__ > 4 || ( __GNUC__ == 4 && __GNUC_MINOR__ >= 8 ) ) ) )
+#   define CA_BULK_SWAP
+#   if defined ( __x86_64__ ) || defined ( __i386__ )
+#       define CA_BULK_SWAP_AVX2
+#   endif
+#endif
+
+#ifdef CA_BULK_SWAP
+
+typedef void ( * CASWAPFUNCPTR ) (
+    const void *pSrc, void *pDest, arrayElementCount count );
+
+inline epicsUInt16 bulkSwap ( epicsUInt16 v ) { return __builtin_bswap16 ( v ); }
+inline epicsUInt32 bulkSwap ( epicsUInt32 v ) { return __builtin_bswap32 ( v ); }
+inline epicsUInt64 bulkSwap ( epicsUInt64 v ) { return __builtin_bswap64 ( v ); }
+
+// memcpy keeps this within the aliasing rules, it
+// compiles to plain vector loads and stores
+template < class T >
+inline __attribute__ (( always_inline ))
+void swapArray ( const void *s, void *d, arrayElementCount num )
+{
+    const char * pSrc = static_cast < const char * > ( s );
+    char * pDest = static_cast < char * > ( d );
+    for ( arrayElementCount i = 0; i < num; i++ ) {
+        T tmp;
+        memcpy ( & tmp, pSrc + i * sizeof ( T ), sizeof ( T ) );
+        tmp = bulkSwap ( tmp );
+        memcpy ( pDest + i * sizeof ( T ), & tmp, sizeof ( T ) );
+    }
+}
+
+static void swapArray16 ( const void *s, void *d, arrayElementCount num )
+{
+    swapArray < epicsUInt16 > ( s, d, num );
+}
+static void swapArray32 ( const void *s, void *d, arrayElementCount num )
+{
+    swapArray < epicsUInt32 > ( s, d, num );
+}
+static void swapArray64 ( const void *s, void *d, arrayElementCount num )
+{
+    swapArray < epicsUInt64 > ( s, d, num );
+}
+
+#ifdef CA_BULK_SWAP_AVX2
+__attribute__ (( target ( "avx2" ) ))
+static void swapArray16AVX2 ( const void *s, void *d, arrayElementCount num )
+{
+    swapArray < epicsUInt16 > ( s, d, num );
+}
+__attribute__ (( target ( "avx2" ) ))
+static void swapArray32AVX2 ( const void *s, void *d, arrayElementCount num )
+{
+    swapArray < epicsUInt32 > ( s, d, num );
+}
+__attribute__ (( target ( "avx2" ) ))
+static void swapArray64AVX2 ( const void *s, void *d, arrayElementCount num )
+{
+    swapArray < epicsUInt64 > ( s, d, num );
+}
+
+static bool haveAVX2 ()
+{
+    __builtin_cpu_init ();
+    return __builtin_cpu_supports ( "avx2" );
+}
+
+// Chosen on first use, not by static initializers, which conversions
+// made while other libraries are being initialized could run ahead of
+static CASWAPFUNCPTR swapArray16Impl ()
+{
+    static const CASWAPFUNCPTR pSwap =
+        haveAVX2 () ? swapArray16AVX2 : swapArray16;
+    return pSwap;
+}
+static CASWAPFUNCPTR swapArray32Impl ()
+{
+    static const CASWAPFUNCPTR pSwap =
+        haveAVX2 () ? swapArray32AVX2 : swapArray32;
+    return pSwap;
+}
+static CASWAPFUNCPTR swapArray64Impl ()
+{
+    static const CASWAPFUNCPTR pSwap =
+        haveAVX2 () ? swapArray64AVX2 : swapArray64;
+    return pSwap;
+}
+#else
+static CASWAPFUNCPTR swapArray16Impl () { return swapArray16; }
+static CASWAPFUNCPTR swapArray32Impl () { return swapArray32; }
+static CASWAPFUNCPTR swapArray64Impl () { return swapArray64; }
+#endif
+
+#endif /* CA_BULK_SWAP */
+
 /*
  * if hton is true then it is a host to network conversion
  * otherwise vise-versa
@@ -134,6 +243,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#   ifdef CA_BULK_SWAP
+        ( * swapArray16Impl () ) ( s, d, num );
+#   else
     dbr_short_t         *pSrc = (dbr_short_t *) s;
     dbr_short_t         *pDest = (dbr_short_t *) d;
 
@@ -147,6 +259,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohs( pSrc[i] );
         }
     }
+#   endif
 }
 
 /*
@@ -184,6 +297,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#   ifdef CA_BULK_SWAP
+        ( * swapArray32Impl () ) ( s, d, num );
+#   else
     dbr_long_t          *pSrc = (dbr_long_t *) s;
     dbr_long_t          *pDest = (dbr_long_t *) d;
 
@@ -197,6 +313,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohl( pSrc[i] );
         }
     }
+#   endif
 }
 
 /*
@@ -213,6 +330,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#   ifdef CA_BULK_SWAP
+        ( * swapArray16Impl () ) ( s, d, num );
+#   else
     dbr_enum_t          *pSrc = (dbr_enum_t *) s;
     dbr_enum_t          *pDest = (dbr_enum_t *) d;
 
@@ -226,6 +346,7 @@ arrayElementCount   num         /* number of values     */
             pDest[i] = dbr_ntohs ( pSrc[i] );
         }
     }
+#   endif
 }
 
 /*
@@ -244,6 +365,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#   ifdef CA_BULK_SWAP
+        ( * swapArray32Impl () ) ( s, d, num );
+#   else
     const dbr_float_t   *pSrc = (const dbr_float_t *) s;
     dbr_float_t         *pDest = (dbr_float_t *) d;
 
@@ -257,6 +381,7 @@ arrayElementCount   num         /* number of values     */
             dbr_ntohf ( &pSrc[i], &pDest[i] );
         }
     }
+#   endif
 }
 
 /*
@@ -269,6 +394,9 @@ int                 encode,     /* cvrt HOST to NET if T    */
 arrayElementCount   num         /* number of values     */
 )
 {
+#   ifdef CA_BULK_SWAP
+        ( * swapArray64Impl () ) ( s, d, num );
+#   else
     dbr_double_t        *pSrc = (dbr_double_t *) s;
     dbr_double_t        *pDest = (dbr_double_t *) d;
 
@@ -282,6 +410,7 @@ arrayElementCount   num         /* number of values     */
             dbr_ntohd( &pSrc[i], &pDest[i] );
         }
     }
+#   endif
 }
 
 /****************************************************************************
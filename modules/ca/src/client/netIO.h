@@ -63,6 +63,9 @@ public:
     virtual void forceSubscriptionUpdate (
         epicsGuard < epicsMutex > & guard, nciu & chan ) = 0;
     virtual class netSubscription * isSubscription () = 0;
+    virtual void * updateBuffer (
+        epicsGuard < epicsMutex > &, arrayElementCount nBytes,
+        bool & networkByteOrder );
     virtual void show (
         unsigned level ) const = 0;
     virtual void show (
@@ -127,6 +130,9 @@ private:
         arrayElementCount count );
     void forceSubscriptionUpdate (
         epicsGuard < epicsMutex > & guard, nciu & chan );
+    void * updateBuffer (
+        epicsGuard < epicsMutex > &, arrayElementCount nBytes,
+        bool & networkByteOrder );
     netSubscription ( const netSubscription & );
     netSubscription & operator = ( const netSubscription & );
 };
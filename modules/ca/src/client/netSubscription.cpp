@@ -142,6 +142,13 @@ void netSubscription::completion (
     }
 }
 
+void * netSubscription::updateBuffer (
+    epicsGuard < epicsMutex > & guard, arrayElementCount nBytes,
+    bool & networkByteOrder )
+{
+    return this->notify.updateBuffer ( guard, nBytes, networkByteOrder );
+}
+
 void netSubscription::subscribeIfRequired (
     epicsGuard < epicsMutex > & guard, nciu & chan )
 {
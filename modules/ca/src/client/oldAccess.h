@@ -270,6 +270,10 @@ public:
     void cancel (
         CallbackGuard & callbackGuard,
         epicsGuard < epicsMutex > & mutualExclusionGuard );
+    void setBuffers (
+        epicsGuard < epicsMutex > &, unsigned nBuffers,
+        void * const * pBuffers, arrayElementCount bufferSize,
+        bool networkByteOrder );
     void * operator new ( size_t size,
         tsFreeList < struct oldSubscription, 1024, epicsMutexNOOP > & );
     epicsPlacementDeleteOperator (( void *,
@@ -279,12 +283,20 @@ private:
     cacChannel::ioid id;
     caEventCallBackFunc * pFunc;
     void * pPrivate;
+    void ** pRing;
+    arrayElementCount ringBufferSize;
+    unsigned ringSize;
+    unsigned ringNext;
+    bool ringNetworkByteOrder;
     void current (
         epicsGuard < epicsMutex > &, unsigned type,
         arrayElementCount count, const void *pData );
     void exception (
         epicsGuard < epicsMutex > &, int status,
         const char *pContext, unsigned type, arrayElementCount count );
+    void * updateBuffer (
+        epicsGuard < epicsMutex > &, arrayElementCount nBytes,
+        bool & networkByteOrder );
     oldSubscription ( const oldSubscription & );
     oldSubscription & operator = ( const oldSubscription & );
     void operator delete ( void * );
@@ -295,16 +307,21 @@ extern "C" void cacOnceFunc ( void * );
 struct ca_client_context : public cacContextNotify
 {
 public:
-    ca_client_context ( bool enablePreemptiveCallback = false );
+    ca_client_context ( bool enablePreemptiveCallback = false,
+        bool enableConcurrentCallback = false );
     virtual ~ca_client_context ();
     void changeExceptionEvent (
         caExceptionHandler * pfunc, void * arg );
     void registerForFileDescriptorCallBack (
         CAFDHANDLER * pFunc, void * pArg );
+    void fileDescriptorRegister ();
     void replaceErrLogHandler ( caPrintfFunc * ca_printf_func );
     cacChannel & createChannel (
         epicsGuard < epicsMutex > &, const char * pChannelName,
         cacChannelNotify &, cacChannel::priLev pri );
+    void reserveChannels (
+        epicsGuard < epicsMutex > &, unsigned nChannels );
+    void startSearches ( epicsGuard < epicsMutex > & );
     void flush ( epicsGuard < epicsMutex > & );
     void eliminateExcessiveSendBacklog (
         epicsGuard < epicsMutex > &, cacChannel & );
@@ -313,6 +330,8 @@ public:
     bool ioComplete () const;
     void show ( unsigned level ) const;
     unsigned circuitCount () const;
+    void connectionProgress (
+        unsigned & nChannels, unsigned & nConnected ) const;
     unsigned sequenceNumberOfOutstandingIO (
         epicsGuard < epicsMutex > & ) const;
     unsigned beaconAnomaliesSinceProgramStart () const;
@@ -355,6 +374,9 @@ public:
     friend int epicsStdCall ca_create_channel (
         const char * name_str, caCh * conn_func, void * puser,
         capri priority, chid * chanptr );
+    friend int epicsStdCall ca_create_channels (
+        unsigned nChannels, const char * const * pNames, caCh * conn_func,
+        void * const * pUserPrivates, capri priority, chid * pChanIDs );
     friend int epicsStdCall ca_clear_channel ( chid pChan );
     friend int epicsStdCall ca_array_get ( chtype type,
         arrayElementCount count, chid pChan, void * pValue );
@@ -372,6 +394,9 @@ public:
         evid *monixptr );
     friend int epicsStdCall ca_flush_io ();
     friend int epicsStdCall ca_clear_subscription ( evid pMon );
+    friend int epicsStdCall ca_set_subscription_buffers ( evid pMon,
+        unsigned nBuffers, void * const * pBuffers,
+        unsigned long bufferSize, unsigned flags );
     friend int epicsStdCall ca_sg_create ( CA_SYNC_GID * pgid );
     friend int epicsStdCall ca_sg_delete ( const CA_SYNC_GID gid );
     friend int epicsStdCall ca_sg_block ( const CA_SYNC_GID gid, ca_real timeout );
@@ -20,11 +20,13 @@
  */
 
 #include <stdexcept>
+#include <string.h>
 
 #include "errlog.h"
 
 #include "iocinf.h"
 #include "oldAccess.h"
+#include "net_convert.h"
 
 oldSubscription::oldSubscription  (
     epicsGuard < epicsMutex > & guard,
@@ -33,7 +35,8 @@ oldSubscription::oldSubscription  (
     caEventCallBackFunc * pFuncIn, void * pPrivateIn,
     evid * pEventId ) :
     chan ( chanIn ), id ( UINT_MAX ), pFunc ( pFuncIn ),
-        pPrivate ( pPrivateIn )
+        pPrivate ( pPrivateIn ), pRing ( 0 ), ringBufferSize ( 0u ),
+        ringSize ( 0u ), ringNext ( 0u ), ringNetworkByteOrder ( false )
 {
     // The users event id *must* be set prior to potentially
     // calling his callback from within subscribe.
@@ -48,6 +51,38 @@ oldSubscription::oldSubscription  (
 
 oldSubscription::~oldSubscription ()
 {
+    delete [] this->pRing;
+}
+
+void oldSubscription::setBuffers (
+    epicsGuard < epicsMutex > &, unsigned nBuffers,
+    void * const * pBuffers, arrayElementCount bufferSize,
+    bool networkByteOrder )
+{
+    void ** pNewRing = 0;
+    if ( nBuffers > 0u ) {
+        pNewRing = new void * [nBuffers];
+        for ( unsigned i = 0u; i < nBuffers; i++ ) {
+            pNewRing[i] = pBuffers[i];
+        }
+    }
+    delete [] this->pRing;
+    this->pRing = pNewRing;
+    this->ringBufferSize = bufferSize;
+    this->ringSize = nBuffers;
+    this->ringNext = 0u;
+    this->ringNetworkByteOrder = networkByteOrder;
+}
+
+void * oldSubscription::updateBuffer (
+    epicsGuard < epicsMutex > &, arrayElementCount nBytes,
+    bool & networkByteOrder )
+{
+    if ( this->pRing && nBytes <= this->ringBufferSize ) {
+        networkByteOrder = this->ringNetworkByteOrder;
+        return this->pRing[this->ringNext];
+    }
+    return 0;
 }
 
 void oldSubscription::current (
@@ -61,6 +96,29 @@ void oldSubscription::current (
     args.count = static_cast < long > ( count );
     args.status = ECA_NORMAL;
     args.dbr = pData;
+    if ( this->pRing ) {
+        // Updates which the circuit didn't place in the ring, such
+        // as those from a channel in this IOC, are copied into it.
+        void * pSlot = this->pRing[this->ringNext];
+        if ( pData != pSlot ) {
+            if ( dbr_size_n ( type, count ) > this->ringBufferSize ) {
+                args.status = ECA_TOLARGE;
+                args.dbr = 0;
+            }
+            else if ( this->ringNetworkByteOrder ) {
+                args.status = caNetConvert ( type, pData, pSlot,
+                    true, count );
+                args.dbr = args.status == ECA_NORMAL ? pSlot : 0;
+            }
+            else {
+                memcpy ( pSlot, pData, dbr_size_n ( type, count ) );
+                args.dbr = pSlot;
+            }
+        }
+        if ( args.dbr ) {
+            this->ringNext = ( this->ringNext + 1u ) % this->ringSize;
+        }
+    }
     caEventCallBackFunc * pFuncTmp = this->pFunc;
     {
         epicsGuardRelease < epicsMutex > unguard ( guard );
@@ -65,6 +65,18 @@ void searchTimer::start ( epicsGuard < epicsMutex > & guard )
     this->timer.start ( *this, this->period ( guard ) );
 }
 
+//
+// send the pending search requests now rather than at the end
+// of the current period
+//
+void searchTimer::searchNow ( epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( ! this->stopped && this->chanListReqPending.count () ) {
+        this->timer.start ( *this, 0.0 );
+    }
+}
+
 searchTimer::~searchTimer ()
 {
     assert ( this->chanListReqPending.count() == 0 );
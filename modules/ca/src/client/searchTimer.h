@@ -58,6 +58,7 @@ public:
         bool boostPossible );
     virtual ~searchTimer ();
     void start ( epicsGuard < epicsMutex > & );
+    void searchNow ( epicsGuard < epicsMutex > & );
     void shutdown (
         epicsGuard < epicsMutex > & cbGuard,
         epicsGuard < epicsMutex > & guard );
@@ -691,6 +691,7 @@ tcpiiu::tcpiiu (
     comBufMemMgr ( comBufMemMgrIn ),
     cacRef ( cac ),
     pCurData ( (char*) freeListMalloc(this->cacRef.tcpSmallRecvBufFreeList) ),
+    pCurDest ( 0 ),
     pSearchDest ( pSearchDestIn ),
     mutex ( mutexIn ),
     cbMutex ( cbMutexIn ),
@@ -712,7 +713,11 @@ tcpiiu::tcpiiu (
     recvProcessPostponedFlush ( false ),
     discardingPendingData ( false ),
     socketHasBeenClosed ( false ),
-    unresponsiveCircuit ( false )
+    unresponsiveCircuit ( false ),
+    curDestLost ( false ),
+    pDeliveryBlockedOn ( 0 ),
+    deliveringIO ( 0u ),
+    ioDelivering ( false )
 {
     if(!pCurData)
         throw std::bad_alloc();
@@ -1203,84 +1208,132 @@ bool tcpiiu::processIncoming (
         }
 
         //
-        // make sure we have a large enough message body cache
+        // a subscription update may be placed straight into
+        // a buffer supplied by the subscriber
         //
-        if ( this->curMsg.m_postsize > this->curDataMax ) {
-            assert (this->curMsg.m_postsize > MAX_TCP);
+        if ( this->curMsg.m_cmmd == CA_PROTO_EVENT_ADD &&
+                this->curMsg.m_postsize > 0u ) {
+            epicsGuard < epicsMutex > guard ( this->mutex );
+            void * pDest = this->cacRef.eventRespBuffer ( guard, this->curMsg );
+            if ( this->curDataBytes == 0u ) {
+                this->pCurDest = static_cast < char * > ( pDest );
+                this->curDestLost = false;
+            }
+            else if ( this->pCurDest && pDest != this->pCurDest ) {
+                // the subscription was cancelled, or its buffers
+                // replaced, while we waited for the rest of the update
+                this->curDestLost = true;
+            }
+        }
+        else {
+            this->pCurDest = 0;
+        }
+
+        if ( this->pCurDest ) {
+            const arrayElementCount nBytes = dbr_size_n (
+                this->curMsg.m_dataType, this->curMsg.m_count );
+            if ( this->curDataBytes < nBytes && ! this->curDestLost ) {
+                this->curDataBytes += this->recvQue.copyOutBytes (
+                            &this->pCurDest[this->curDataBytes],
+                            nBytes - this->curDataBytes );
+            }
+            if ( this->curDataBytes >= nBytes || this->curDestLost ) {
+                // alignment padding, or the rest of a lost update
+                this->curDataBytes += this->recvQue.removeBytes (
+                        this->curMsg.m_postsize - this->curDataBytes );
+            }
+            if ( this->curDataBytes < this->curMsg.m_postsize ) {
+                epicsGuard < epicsMutex > guard ( this->mutex );
+                this->flushIfRecvProcessRequested ( guard );
+                return true;
+            }
+            if ( ! this->curDestLost ) {
+                if ( ! this->deliverResponse ( currentTime, mgr,
+                                            this->pCurDest ) ) {
+                    return false;
+                }
+            }
+        }
+        else {
+            //
+            // make sure we have a large enough message body cache
+            //
+            if ( this->curMsg.m_postsize > this->curDataMax ) {
+                assert (this->curMsg.m_postsize > MAX_TCP);
 
-            char * newbuf = NULL;
-            arrayElementCount newsize;
+                char * newbuf = NULL;
+                arrayElementCount newsize;
 
-            if ( !this->cacRef.tcpLargeRecvBufFreeList ) {
-                // round size up to multiple of 4K
-                newsize = ((this->curMsg.m_postsize-1)|0xfff)+1;
+                if ( !this->cacRef.tcpLargeRecvBufFreeList ) {
+                    // round size up to multiple of 4K
+                    newsize = ((this->curMsg.m_postsize-1)|0xfff)+1;
 
-                if ( this->curDataMax <= MAX_TCP ) {
-                    // small -> large
-                    newbuf = (char*)malloc(newsize);
+                    if ( this->curDataMax <= MAX_TCP ) {
+                        // small -> large
+                        newbuf = (char*)malloc(newsize);
 
-                } else {
-                    // expand large to larger
-                    newbuf = (char*)realloc(this->pCurData, newsize);
-                }
+                    } else {
+                        // expand large to larger
+                        newbuf = (char*)realloc(this->pCurData, newsize);
+                    }
 
-            } else if ( this->curMsg.m_postsize <= this->cacRef.maxRecvBytesTCP ) {
-                newbuf = (char*) freeListMalloc(this->cacRef.tcpLargeRecvBufFreeList);
-                newsize = this->cacRef.maxRecvBytesTCP;
+                } else if ( this->curMsg.m_postsize <= this->cacRef.maxRecvBytesTCP ) {
+                    newbuf = (char*) freeListMalloc(this->cacRef.tcpLargeRecvBufFreeList);
+                    newsize = this->cacRef.maxRecvBytesTCP;
 
-            }
+                }
+
+                if ( newbuf) {
+                    if (this->curDataMax <= MAX_TCP) {
+                        freeListFree(this->cacRef.tcpSmallRecvBufFreeList, this->pCurData );
 
-            if ( newbuf) {
-                if (this->curDataMax <= MAX_TCP) {
-                    freeListFree(this->cacRef.tcpSmallRecvBufFreeList, this->pCurData );
+                    } else if (this->cacRef.tcpLargeRecvBufFreeList) {
+                        freeListFree(this->cacRef.tcpLargeRecvBufFreeList, this->pCurData );
 
-                } else if (this->cacRef.tcpLargeRecvBufFreeList) {
-                    freeListFree(this->cacRef.tcpLargeRecvBufFreeList, this->pCurData );
+                    } else {
+                        // called realloc()
+                    }
+                    this->pCurData = newbuf;
+                    this->curDataMax = newsize;
 
                 } else {
-                    // called realloc()
+                    this->printFormated ( mgr.cbGuard,
+                        "CAC: not enough memory for message body cache (ignoring response message)\n");
                 }
-                this->pCurData = newbuf;
-                this->curDataMax = newsize;
-
-            } else {
-                this->printFormated ( mgr.cbGuard,
-                    "CAC: not enough memory for message body cache (ignoring response message)\n");
             }
-        }
 
-        if ( this->curMsg.m_postsize <= this->curDataMax ) {
-            if ( this->curMsg.m_postsize > 0u ) {
-                this->curDataBytes += this->recvQue.copyOutBytes (
-                            &this->pCurData[this->curDataBytes],
-                            this->curMsg.m_postsize - this->curDataBytes );
-                if ( this->curDataBytes < this->curMsg.m_postsize ) {
+            if ( this->curMsg.m_postsize <= this->curDataMax ) {
+                if ( this->curMsg.m_postsize > 0u ) {
+                    this->curDataBytes += this->recvQue.copyOutBytes (
+                                &this->pCurData[this->curDataBytes],
+                                this->curMsg.m_postsize - this->curDataBytes );
+                    if ( this->curDataBytes < this->curMsg.m_postsize ) {
+                        epicsGuard < epicsMutex > guard ( this->mutex );
+                        this->flushIfRecvProcessRequested ( guard );
+                        return true;
+                    }
+                }
+                if ( ! this->deliverResponse ( currentTime, mgr,
+                                            this->pCurData ) ) {
+                    return false;
+                }
+            }
+            else {
+                static bool once = false;
+                if ( ! once ) {
+                    this->printFormated ( mgr.cbGuard,
+    "CAC: response with payload size=%u > EPICS_CA_MAX_ARRAY_BYTES ignored\n",
+                        this->curMsg.m_postsize );
+                    once = true;
+                }
+                this->curDataBytes += this->recvQue.removeBytes (
+                        this->curMsg.m_postsize - this->curDataBytes );
+                if ( this->curDataBytes < this->curMsg.m_postsize  ) {
                     epicsGuard < epicsMutex > guard ( this->mutex );
                     this->flushIfRecvProcessRequested ( guard );
                     return true;
                 }
             }
-            bool msgOK = this->cacRef.executeResponse ( mgr, *this,
-                                currentTime, this->curMsg, this->pCurData );
-            if ( ! msgOK ) {
-                return false;
-            }
-        }
-        else {
-            static bool once = false;
-            if ( ! once ) {
-                this->printFormated ( mgr.cbGuard,
-    "CAC: response with payload size=%u > EPICS_CA_MAX_ARRAY_BYTES ignored\n",
-                    this->curMsg.m_postsize );
-                once = true;
-            }
-            this->curDataBytes += this->recvQue.removeBytes (
-                    this->curMsg.m_postsize - this->curDataBytes );
-            if ( this->curDataBytes < this->curMsg.m_postsize  ) {
-                epicsGuard < epicsMutex > guard ( this->mutex );
-                this->flushIfRecvProcessRequested ( guard );
-                return true;
-            }
         }
 
         this->oldMsgHeaderAvailable = false;
@@ -1289,6 +1342,22 @@ bool tcpiiu::processIncoming (
     }
 }
 
+bool tcpiiu::deliverResponse ( const epicsTime & currentTime,
+    callbackManager & mgr, char * pMsgBody )
+{
+    if ( this->curMsg.m_cmmd == CA_PROTO_EVENT_ADD &&
+            this->cacRef.concurrentCallbacks () ) {
+        // subscription update callbacks of different circuits
+        // run concurrently, the rest are serialized
+        epicsGuardRelease < epicsMutex > cbUnguard ( mgr.cbGuard );
+        this->cacRef.eventRespNotify ( *this,
+                        this->curMsg, pMsgBody );
+        return true;
+    }
+    return this->cacRef.executeResponse ( mgr, *this,
+                    currentTime, this->curMsg, pMsgBody );
+}
+
 void tcpiiu::hostNameSetRequest ( epicsGuard < epicsMutex > & guard )
 {
     guard.assertIdenticalMutex ( this->mutex );
@@ -1257,6 +1257,12 @@ void udpiiu::installNewChannel (
     this->ppSearchTmr[0]->installChannel ( guard, chan );
 }
 
+void udpiiu::startSearches (
+    epicsGuard < epicsMutex > & guard )
+{
+    this->ppSearchTmr[0]->searchNow ( guard );
+}
+
 void udpiiu::installDisconnectedChannel (
     epicsGuard < epicsMutex > & guard, nciu & chan )
 {
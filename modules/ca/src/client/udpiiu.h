@@ -107,6 +107,8 @@ public:
         epicsGuard < epicsMutex > &, nciu &, netiiu * & );
     void installDisconnectedChannel (
         epicsGuard < epicsMutex > &, nciu & );
+    void startSearches (
+        epicsGuard < epicsMutex > & );
     void beaconAnomalyNotify (
         epicsGuard < epicsMutex > & guard );
     void shutdown ( epicsGuard < epicsMutex > & cbGuard,
@@ -109,6 +109,12 @@ private:
     bool _active;
 };
 
+// a thread waiting for a circuit's subscription update delivery to end
+class ioDeliveryWaiter : public tsDLNode < ioDeliveryWaiter > {
+public:
+    epicsEvent done;
+};
+
 class tcpiiu :
         public netiiu, public tsDLNode < tcpiiu >,
         public tsSLNode < tcpiiu >, public caServerID,
@@ -181,6 +187,8 @@ public:
         const char *pformat, ... );
     unsigned channelCount (
         epicsGuard < epicsMutex > & );
+    unsigned connectedChannelCount (
+        epicsGuard < epicsMutex > & ) const;
     void disconnectAllChannels (
         epicsGuard < epicsMutex > & cbGuard,
         epicsGuard < epicsMutex > & guard, class udpiiu & );
@@ -199,6 +207,20 @@ public:
         const epicsTime &, const caHdrLargeArray & );
     void versionRespNotify ( const caHdrLargeArray & );
 
+    // subscription update delivery without the callback lock
+    void ioDeliveryBegin (
+        epicsGuard < epicsMutex > &, ca_uint32_t id );
+    void ioDeliveryEnd (
+        epicsGuard < epicsMutex > & );
+    bool ioDeliveryInProgress (
+        epicsGuard < epicsMutex > &, ca_uint32_t id ) const;
+    void ioDeliveryWaiterAdd (
+        epicsGuard < epicsMutex > &, ioDeliveryWaiter & );
+    void ioDeliveryBlockedOn (
+        epicsGuard < epicsMutex > &, const tcpiiu * );
+    bool ioDeliveryWaitsFor (
+        epicsGuard < epicsMutex > &, const tcpiiu & ) const;
+
     void * operator new ( size_t size,
         tsFreeList < class tcpiiu, 32, epicsMutexNOOP >  & );
     epicsPlacementDeleteOperator (( void *,
@@ -227,6 +249,7 @@ private:
     comBufMemoryManager & comBufMemMgr;
     cac & cacRef;
     char * pCurData;
+    char * pCurDest; // subscriber's buffer receiving the current message
     SearchDestTCP * pSearchDest;
     epicsMutex & mutex;
     epicsMutex & cbMutex;
@@ -257,9 +280,19 @@ private:
     bool discardingPendingData;
     bool socketHasBeenClosed;
     bool unresponsiveCircuit;
+    bool curDestLost;
+    // protected by the mutex
+    tsDLList < ioDeliveryWaiter > deliveryWaiters;
+    // the circuit whose delivery this one's callback waits for
+    const tcpiiu * pDeliveryBlockedOn;
+    ca_uint32_t deliveringIO;
+    bool ioDelivering;
 
     bool processIncoming (
         const epicsTime & currentTime, callbackManager & );
+    bool deliverResponse (
+        const epicsTime & currentTime, callbackManager &,
+        char * pMsgBody );
     unsigned sendBytes ( const void *pBuf,
         unsigned nBytesInBuf, const epicsTime & currentTime );
     void recvBytes (
@@ -389,6 +422,70 @@ inline bool tcpiiu::receiveThreadIsBusy (
     return this->_receiveThreadIsBusy;
 }
 
+inline unsigned tcpiiu::connectedChannelCount (
+    epicsGuard < epicsMutex > & guard ) const
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    return this->subscripReqPend.count () +
+        this->connectedList.count () +
+        this->subscripUpdateReqPend.count ();
+}
+
+inline void tcpiiu::ioDeliveryBegin (
+    epicsGuard < epicsMutex > & guard, ca_uint32_t id )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->deliveringIO = id;
+    this->ioDelivering = true;
+}
+
+inline void tcpiiu::ioDeliveryEnd (
+    epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->ioDelivering = false;
+    while ( ioDeliveryWaiter * pWaiter = this->deliveryWaiters.get () ) {
+        pWaiter->done.signal ();
+    }
+}
+
+inline bool tcpiiu::ioDeliveryInProgress (
+    epicsGuard < epicsMutex > & guard, ca_uint32_t id ) const
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    return this->ioDelivering && this->deliveringIO == id;
+}
+
+inline void tcpiiu::ioDeliveryWaiterAdd (
+    epicsGuard < epicsMutex > & guard, ioDeliveryWaiter & waiter )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->deliveryWaiters.add ( waiter );
+}
+
+inline void tcpiiu::ioDeliveryBlockedOn (
+    epicsGuard < epicsMutex > & guard, const tcpiiu * pOther )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    this->pDeliveryBlockedOn = pOther;
+}
+
+// True if this circuit's callback waits, directly or through other
+// circuits' callbacks, for the delivery of the other circuit to end.
+// No wait is started that closes a cycle, so the chain ends.
+inline bool tcpiiu::ioDeliveryWaitsFor (
+    epicsGuard < epicsMutex > & guard, const tcpiiu & other ) const
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    for ( const tcpiiu * p = this->pDeliveryBlockedOn; p;
+            p = p->pDeliveryBlockedOn ) {
+        if ( p == & other ) {
+            return true;
+        }
+    }
+    return false;
+}
+
 inline void tcpiiu::beaconAnomalyNotify (
     epicsGuard < epicsMutex > & guard )
 {
@@ -0,0 +1,10 @@
+/* Generated file, do not edit! */
+
+/* Version determined from Git */
+
+#ifndef EPICS_VCS_VERSION
+  #define EPICS_VCS_VERSION "bc9f5d83e742d9e326b8-dirty"
+#endif
+#ifndef EPICS_VCS_VERSION_DATE
+  #define EPICS_VCS_VERSION_DATE "Git: 2026-10-17 11:16:02 +0000"
+#endif
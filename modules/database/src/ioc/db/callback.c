@@ -26,7 +26,7 @@
 #include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsInterrupt.h"
-#include "epicsRingPointer.h"
+#include "epicsSpin.h"
 #include "epicsString.h"
 #include "epicsThread.h"
 #include "epicsTimer.h"
@@ -50,9 +50,36 @@
 
 static int callbackQueueSize = 2000;
 
+/* A queue may grow to this many times its initial size, except when
+ * callbackRequest() is called from an interrupt
+ */
+#define QUEUE_GROWTH_LIMIT 16
+
+/* Each worker thread has its own FIFO queue. Requests from outside the
+ * workers are spread over the queues, requests made by a worker go on its
+ * own queue, and a worker with an empty queue takes from the others.
+ */
+typedef struct cbQueue {
+    epicsSpinId lock;
+    epicsCallback **ring;
+    int size;
+    int head;
+    int count; // also read without the lock
+} cbQueue;
+
+typedef struct cbWorker {
+    struct cbQueueSet *set;
+    cbQueue queue;
+    epicsEventId wakeUp;
+    int idle; // use atomic
+} cbWorker;
+
 typedef struct cbQueueSet {
-    epicsEventId semWakeUp;
-    epicsRingPointerId queue;
+    cbWorker *workers;
+    int nextWorker; // use atomic
+    int nIdle; // use atomic
+    int used; // use atomic
+    int maxUsed; // use atomic
     int queueOverflow;
     int queueOverflows;
     int shutdown; // use atomic
@@ -82,6 +109,9 @@ static int cbState; // holdscbState_t, use atomic ops
 
 static epicsEventId startStopEvent;
 
+/* The cbWorker of a callback thread */
+static epicsThreadPrivateId workerPvt;
+
 /* Static data */
 static char *threadNamePrefix[NUM_CALLBACK_PRIORITIES] = {
     "cbLow", "cbMedium", "cbHigh"
@@ -95,7 +125,6 @@ static unsigned int threadPriority[NUM_CALLBACK_PRIORITIES] = {
     epicsThreadPriorityScanLow + 4,
     epicsThreadPriorityScanHigh + 1
 };
-static int priorityValue[NUM_CALLBACK_PRIORITIES] = {0, 1, 2};
 
 
 int callbackSetQueueSize(int size)
@@ -108,18 +137,42 @@ int callbackSetQueueSize(int size)
     return 0;
 }
 
+int callbackGetQueueSize(void)
+{
+    return callbackQueueSize;
+}
+
+/* Current slots of all of a priority's queues, which grow when full */
+static int queueCapacity(cbQueueSet *mySet)
+{
+    int i, size = 0;
+
+    for (i = 0; i < mySet->threadsConfigured; i++) {
+        cbQueue *q = &mySet->workers[i].queue;
+
+        epicsSpinLock(q->lock);
+        size += q->size;
+        epicsSpinUnlock(q->lock);
+    }
+    return size;
+}
+
 int callbackQueueStatus(const int reset, callbackQueueStats *result)
 {
     int ret;
     if (epicsAtomicGetIntT(&cbState)==cbInit) return -1;
     if (result) {
         int prio;
-        result->size = callbackQueueSize;
+        result->size = 0;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerId qId = callbackQueue[prio].queue;
-            result->numUsed[prio] = epicsRingPointerGetUsed(qId);
-            result->maxUsed[prio] = epicsRingPointerGetHighWaterMark(qId);
-            result->numOverflow[prio] = epicsAtomicGetIntT(&callbackQueue[prio].queueOverflows);
+            cbQueueSet *mySet = &callbackQueue[prio];
+            int size = queueCapacity(mySet);
+
+            if (size > result->size)
+                result->size = size;
+            result->numUsed[prio] = epicsAtomicGetIntT(&mySet->used);
+            result->maxUsed[prio] = epicsAtomicGetIntT(&mySet->maxUsed);
+            result->numOverflow[prio] = epicsAtomicGetIntT(&mySet->queueOverflows);
         }
         ret = 0;
     } else {
@@ -128,7 +181,9 @@ int callbackQueueStatus(const int reset, callbackQueueStats *result)
     if (reset) {
         int prio;
         for(prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsRingPointerResetHighWaterMark(callbackQueue[prio].queue);
+            cbQueueSet *mySet = &callbackQueue[prio];
+            epicsAtomicSetIntT(&mySet->maxUsed,
+                epicsAtomicGetIntT(&mySet->used));
         }
     }
     return ret;
@@ -144,10 +199,11 @@ void callbackQueueShow(const int reset)
         int prio;
         printf("PRIORITY  HIGH-WATER MARK  ITEMS IN Q  Q SIZE  %% USED  Q OVERFLOWS\n");
         for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            double qusage = 100.0 * stats.numUsed[prio] / stats.size;
+            int size = queueCapacity(&callbackQueue[prio]);
+            double qusage = 100.0 * stats.numUsed[prio] / size;
             printf("%8s  %15d  %10d  %6d  %6.1f  %11d\n",
                    threadNamePrefix[prio], stats.maxUsed[prio],
-                   stats.numUsed[prio], stats.size, qusage,
+                   stats.numUsed[prio], size, qusage,
                    stats.numOverflow[prio]);
         }
     }
@@ -203,26 +259,185 @@ found:
     return 0;
 }
 
+/* The queues start with callbackQueueSize slots between them */
+static int queueSize(const cbQueueSet *mySet)
+{
+    int n = mySet->threadsConfigured;
+
+    return callbackQueueSize > n ? (callbackQueueSize + n - 1) / n : 1;
+}
+
+static void queueInit(cbQueue *q, int size)
+{
+    q->lock = epicsSpinMustCreate();
+    q->ring = callocMustSucceed(size, sizeof(epicsCallback *), "callbackInit");
+    q->size = size;
+    q->head = 0;
+    q->count = 0;
+}
+
+static void queueDestroy(cbQueue *q)
+{
+    epicsSpinDestroy(q->lock);
+    free(q->ring);
+}
+
+/* This routine can be called from interrupt context */
+static int queuePush(cbQueue *q, epicsCallback *pcallback)
+{
+    int ok = FALSE;
+
+    epicsSpinLock(q->lock);
+    if (q->count < q->size) {
+        int tail = q->head + q->count;
+
+        if (tail >= q->size)
+            tail -= q->size;
+        q->ring[tail] = pcallback;
+        q->count++;
+        ok = TRUE;
+    }
+    epicsSpinUnlock(q->lock);
+    return ok;
+}
+
+static epicsCallback * queuePop(cbQueue *q)
+{
+    epicsCallback *pcallback = NULL;
+
+    if (!epicsAtomicGetIntT(&q->count))
+        return NULL;
+
+    epicsSpinLock(q->lock);
+    if (q->count) {
+        pcallback = q->ring[q->head];
+        if (++q->head == q->size)
+            q->head = 0;
+        q->count--;
+    }
+    epicsSpinUnlock(q->lock);
+    return pcallback;
+}
+
+/* Double the size of a full queue, returns FALSE at the limit */
+static int queueGrow(cbQueue *q, int limit)
+{
+    epicsCallback **ring, **old;
+    int size, i;
+
+    epicsSpinLock(q->lock);
+    size = q->size;
+    epicsSpinUnlock(q->lock);
+    if (size >= limit)
+        return FALSE;
+
+    ring = malloc(2 * size * sizeof(epicsCallback *));
+    if (!ring)
+        return FALSE;
+
+    epicsSpinLock(q->lock);
+    if (q->size != size) {
+        /* Another thread grew it first */
+        epicsSpinUnlock(q->lock);
+        free(ring);
+        return TRUE;
+    }
+    for (i = 0; i < q->count; i++)
+        ring[i] = q->ring[(q->head + i) % size];
+    old = q->ring;
+    q->ring = ring;
+    q->size = 2 * size;
+    q->head = 0;
+    epicsSpinUnlock(q->lock);
+
+    free(old);
+    return TRUE;
+}
+
+/* Wake pworker if it is idle, or else another idle worker which can take
+ * the request from its queue. Busy workers are not signalled, so a burst
+ * of requests costs at most one wake-up for each idle thread.
+ */
+static void wakeWorker(cbQueueSet *mySet, cbWorker *pworker)
+{
+    int n = mySet->threadsConfigured;
+    int i = pworker - mySet->workers;
+    int j;
+
+    for (j = 0; j < n; j++) {
+        cbWorker *pw = &mySet->workers[i];
+
+        if (epicsAtomicCmpAndSwapIntT(&pw->idle, 1, 0) == 1) {
+            epicsAtomicDecrIntT(&mySet->nIdle);
+            epicsEventSignal(pw->wakeUp);
+            return;
+        }
+        if (!epicsAtomicGetIntT(&mySet->nIdle))
+            return;
+        if (++i == n)
+            i = 0;
+    }
+}
+
+/* Take the oldest request from another worker's queue */
+static epicsCallback * steal(cbQueueSet *mySet, cbWorker *me)
+{
+    int n = mySet->threadsConfigured;
+    int i = me - mySet->workers;
+    int j;
+
+    for (j = 1; j < n; j++) {
+        epicsCallback *pcallback;
+
+        if (++i == n)
+            i = 0;
+        pcallback = queuePop(&mySet->workers[i].queue);
+        if (pcallback)
+            return pcallback;
+    }
+    return NULL;
+}
+
+static int queuesEmpty(cbQueueSet *mySet)
+{
+    int i;
+
+    for (i = 0; i < mySet->threadsConfigured; i++) {
+        if (epicsAtomicGetIntT(&mySet->workers[i].queue.count))
+            return FALSE;
+    }
+    return TRUE;
+}
+
 static void callbackTask(void *arg)
 {
-    int prio = *(int*)arg;
-    cbQueueSet *mySet = &callbackQueue[prio];
+    cbWorker *me = (cbWorker *)arg;
+    cbQueueSet *mySet = me->set;
 
+    epicsThreadPrivateSet(workerPvt, me);
     taskwdInsert(0, NULL, NULL);
     epicsEventSignal(startStopEvent);
 
     while(!epicsAtomicGetIntT(&mySet->shutdown)) {
-        void *ptr;
-        if (epicsRingPointerIsEmpty(mySet->queue))
-            epicsEventMustWait(mySet->semWakeUp);
-
-        while ((ptr = epicsRingPointerPop(mySet->queue))) {
-            epicsCallback *pcallback = (epicsCallback *)ptr;
-            if(!epicsRingPointerIsEmpty(mySet->queue))
-                epicsEventMustTrigger(mySet->semWakeUp);
+        epicsCallback *pcallback = queuePop(&me->queue);
+
+        if (!pcallback)
+            pcallback = steal(mySet, me);
+
+        if (pcallback) {
+            epicsAtomicDecrIntT(&mySet->used);
             mySet->queueOverflow = FALSE;
             (*pcallback->callback)(pcallback);
+            continue;
         }
+
+        /* Go idle, unless a request arrived while we looked */
+        epicsAtomicSetIntT(&me->idle, 1);
+        epicsAtomicIncrIntT(&mySet->nIdle);
+        if (queuesEmpty(mySet) && !epicsAtomicGetIntT(&mySet->shutdown))
+            epicsEventMustWait(me->wakeUp);
+        if (epicsAtomicCmpAndSwapIntT(&me->idle, 1, 0) == 1)
+            epicsAtomicDecrIntT(&mySet->nIdle);
     }
 
     if(!epicsAtomicDecrIntT(&mySet->threadsRunning))
@@ -237,8 +452,12 @@ void callbackStop(void)
     if (epicsAtomicCmpAndSwapIntT(&cbState, cbRun, cbStop)!=cbRun) return;
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
-        epicsAtomicSetIntT(&callbackQueue[i].shutdown, 1);
-        epicsEventSignal(callbackQueue[i].semWakeUp);
+        cbQueueSet *mySet = &callbackQueue[i];
+        int j;
+
+        epicsAtomicSetIntT(&mySet->shutdown, 1);
+        for (j = 0; j < mySet->threadsConfigured; j++)
+            epicsEventSignal(mySet->workers[j].wakeUp);
     }
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
@@ -246,7 +465,8 @@ void callbackStop(void)
         int j;
 
         while (epicsAtomicGetIntT(&mySet->threadsRunning)) {
-            epicsEventSignal(mySet->semWakeUp);
+            for (j = 0; j < mySet->threadsConfigured; j++)
+                epicsEventSignal(mySet->workers[j].wakeUp);
             epicsEventWaitWithTimeout(startStopEvent, 0.1);
         }
         for(j=0; j<mySet->threadsConfigured; j++) {
@@ -265,12 +485,15 @@ void callbackCleanup(void)
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
         cbQueueSet *mySet = &callbackQueue[i];
+        int j;
 
         assert(epicsAtomicGetIntT(&mySet->threadsRunning)==0);
-        epicsEventDestroy(mySet->semWakeUp);
-        mySet->semWakeUp = NULL;
-        epicsRingPointerDelete(mySet->queue);
-        mySet->queue = NULL;
+        for (j = 0; j < mySet->threadsConfigured; j++) {
+            epicsEventDestroy(mySet->workers[j].wakeUp);
+            queueDestroy(&mySet->workers[j].queue);
+        }
+        free(mySet->workers);
+        mySet->workers = NULL;
         free(mySet->threads);
         mySet->threads = NULL;
     }
@@ -292,22 +515,31 @@ void callbackInit(void)
 
     if(!startStopEvent)
         startStopEvent = epicsEventMustCreate(epicsEventEmpty);
+    if(!workerPvt)
+        workerPvt = epicsThreadPrivateCreate();
 
     timerQueue = epicsTimerQueueAllocate(0, epicsThreadPriorityScanHigh);
 
     for (i = 0; i < NUM_CALLBACK_PRIORITIES; i++) {
         epicsThreadId tid;
+        int size;
 
-        callbackQueue[i].semWakeUp = epicsEventMustCreate(epicsEventEmpty);
-        callbackQueue[i].queue = epicsRingPointerLockedCreate(callbackQueueSize);
-        if (callbackQueue[i].queue == 0)
-            cantProceed("epicsRingPointerLockedCreate failed for %s\n",
-                threadNamePrefix[i]);
         callbackQueue[i].queueOverflow = FALSE;
 
         if (callbackQueue[i].threadsConfigured == 0)
             callbackQueue[i].threadsConfigured = callbackThreadsDefault;
 
+        callbackQueue[i].workers = callocMustSucceed(callbackQueue[i].threadsConfigured,
+                                                     sizeof(cbWorker), "callbackInit");
+        size = queueSize(&callbackQueue[i]);
+        for (j = 0; j < callbackQueue[i].threadsConfigured; j++) {
+            cbWorker *pw = &callbackQueue[i].workers[j];
+
+            pw->set = &callbackQueue[i];
+            pw->wakeUp = epicsEventMustCreate(epicsEventEmpty);
+            queueInit(&pw->queue, size);
+        }
+
         callbackQueue[i].threads = callocMustSucceed(callbackQueue[i].threadsConfigured,
                                                      sizeof(*callbackQueue[i].threads),
                                                      "callbackInit");
@@ -322,7 +554,7 @@ void callbackInit(void)
             else
                 strcpy(threadName, threadNamePrefix[i]);
             callbackQueue[i].threads[j] = tid = epicsThreadCreateOpt(threadName,
-                (EPICSTHREADFUNC)callbackTask, &priorityValue[i], &opts);
+                callbackTask, &callbackQueue[i].workers[j], &opts);
             if (tid == 0) {
                 cantProceed("Failed to spawn callback thread %s\n", threadName);
             } else {
@@ -339,6 +571,8 @@ int callbackRequest(epicsCallback *pcallback)
     int priority;
     int pushOK;
     cbQueueSet *mySet;
+    cbWorker *pworker;
+    int nWorkers, inISR, used, max, i;
 
     if (!pcallback) {
         epicsInterruptContextMessage("callbackRequest: " ERL_ERROR " pcallback was NULL\n");
@@ -354,21 +588,57 @@ int callbackRequest(epicsCallback *pcallback)
         return S_db_badChoice;
     }
     mySet = &callbackQueue[priority];
-    if (!mySet->queue) {
+    if (!mySet->workers) {
         epicsInterruptContextMessage("callbackRequest: " ERL_ERROR " Callbacks not initialized\n");
         return S_db_notInit;
     }
     if (mySet->queueOverflow) return S_db_bufFull;
 
-    pushOK = epicsRingPointerPush(mySet->queue, pcallback);
+    nWorkers = mySet->threadsConfigured;
+    inISR = epicsInterruptIsInterruptContext();
+    pworker = NULL;
+    if (nWorkers > 1 && !inISR) {
+        /* A worker keeps its own requests */
+        pworker = epicsThreadPrivateGet(workerPvt);
+        if (pworker && pworker->set != mySet)
+            pworker = NULL;
+    }
+    if (!pworker) {
+        i = nWorkers > 1 ?
+            (unsigned) epicsAtomicIncrIntT(&mySet->nextWorker) % nWorkers : 0;
+        pworker = &mySet->workers[i];
+    }
+
+    /* Count the request before a worker can see it and take it off */
+    used = epicsAtomicIncrIntT(&mySet->used);
+    pushOK = queuePush(&pworker->queue, pcallback);
+    for (i = 1; !pushOK && i < nWorkers; i++) {
+        cbWorker *pw = &mySet->workers[
+            (pworker - mySet->workers + i) % nWorkers];
+
+        pushOK = queuePush(&pw->queue, pcallback);
+    }
+    for (i = 0; !pushOK && !inISR && i < nWorkers; i++) {
+        cbWorker *pw = &mySet->workers[
+            (pworker - mySet->workers + i) % nWorkers];
+
+        while (!pushOK &&
+            queueGrow(&pw->queue, QUEUE_GROWTH_LIMIT * queueSize(mySet)))
+            pushOK = queuePush(&pw->queue, pcallback);
+    }
 
     if (!pushOK) {
+        epicsAtomicDecrIntT(&mySet->used);
         epicsInterruptContextMessage(fullMessage[priority]);
         mySet->queueOverflow = TRUE;
         epicsAtomicIncrIntT(&mySet->queueOverflows);
         return S_db_bufFull;
     }
-    epicsEventSignal(mySet->semWakeUp);
+
+    while ((max = epicsAtomicGetIntT(&mySet->maxUsed)) < used &&
+        epicsAtomicCmpAndSwapIntT(&mySet->maxUsed, max, used) != max)
+        ;
+    wakeWorker(mySet, pworker);
     return 0;
 }
 
@@ -41,6 +41,7 @@
 #include "dbAddr.h"
 #include "dbBase.h"
 #include "dbBkpt.h"
+#include "dbChannel.h"
 #include "dbCommonPvt.h"
 #include "dbConvertFast.h"
 #include "dbConvert.h"
@@ -768,9 +769,11 @@ long dbBufferSize(short dbr_type, long options, long no_elements)
 
     nbytes += dbValueSize(dbr_type) * no_elements;
     if (options & DBR_STATUS)      nbytes += dbr_status_size;
+    if (options & DBR_AMSG)        nbytes += DB_AMSG_SIZE;
     if (options & DBR_UNITS)       nbytes += dbr_units_size;
     if (options & DBR_PRECISION)   nbytes += dbr_precision_size;
     if (options & DBR_TIME)        nbytes += dbr_time_size;
+    if (options & DBR_UTAG)        nbytes += sizeof(epicsUTag);
     if (options & DBR_ENUM_STRS)   nbytes += dbr_enumStrs_size;
     if (options & DBR_GR_LONG)     nbytes += dbr_grLong_size;
     if (options & DBR_GR_DOUBLE)   nbytes += dbr_grDouble_size;
@@ -902,19 +905,45 @@ long dbGetField(DBADDR *paddr,short dbrType,
     return status;
 }
 
-long dbGet(DBADDR *paddr, short dbrType,
-    void *pbuffer, long *options, long *nRequest, void *pflin)
+/* The parts of a dbGet() that only depend on the field and request type */
+static void prepareGet(const DBADDR *paddr, short field_type, short dbrType,
+    dbChannelGetPrep *prep)
+{
+    rset *prset = dbGetRset(paddr);
+
+    prep->chan = NULL;
+    prep->dbrType = dbrType;
+    prep->field_type = field_type;
+    prep->options = 0;
+    prep->bufferSize = 0;
+    if (INVALID_DB_REQ(dbrType) || field_type > DBF_DEVICE) {
+        prep->fastConvert = NULL;
+        prep->convert = NULL;
+    } else {
+        prep->fastConvert = dbFastGetConvertRoutine[field_type][dbrType];
+        prep->convert = dbGetConvertRoutine[field_type][dbrType];
+    }
+    prep->getArrayInfo = NULL;
+    if (paddr->pfldDes && paddr->pfldDes->special == SPC_DBADDR &&
+        prset && prset->get_array_info)
+        prep->getArrayInfo = prset->get_array_info;
+    prep->longString = dbrType == DBF_CHAR &&
+        paddr->pfldDes && paddr->pfldDes->field_type == DBF_STRING;
+}
+
+static long getPrepared(DBADDR *paddr, const dbChannelGetPrep *prep,
+    void *pbuffer, long *options, long *nRequest, db_field_log *pfl)
 {
     char *pbuf = pbuffer;
     void *pfieldsave = paddr->pfield;
-    db_field_log *pfl = (db_field_log *)pflin;
+    dbChannelGetPrep local;
+    short dbrType = prep->dbrType;
     short field_type;
     long capacity, no_elements, offset;
-    rset *prset;
     long status = 0;
 
     if (options && *options)
-        getOptions(paddr, &pbuf, options, pflin);
+        getOptions(paddr, &pbuf, options, pfl);
     if (nRequest && *nRequest == 0)
         return 0;
 
@@ -926,14 +955,17 @@ long dbGet(DBADDR *paddr, short dbrType,
         no_elements = capacity = pfl->no_elements;
     }
 
+    /* A filter may have changed the type */
+    if (field_type != prep->field_type) {
+        prepareGet(paddr, field_type, dbrType, &local);
+        prep = &local;
+    }
+
     /* Update field info from record (if necessary);
      * may modify paddr->pfield.
      */
-    if (!dbfl_has_copy(pfl) &&
-        paddr->pfldDes->special == SPC_DBADDR &&
-        (prset = dbGetRset(paddr)) &&
-        prset->get_array_info) {
-        status = prset->get_array_info(paddr, &no_elements, &offset);
+    if (!dbfl_has_copy(pfl) && prep->getArrayInfo) {
+        status = prep->getArrayInfo(paddr, &no_elements, &offset);
     } else {
         offset = 0;
     }
@@ -967,8 +999,7 @@ long dbGet(DBADDR *paddr, short dbrType,
         }
 
         if (!dbfl_has_copy(pfl)) {
-            status = dbFastGetConvertRoutine[field_type][dbrType]
-                (paddr->pfield, pbuf, paddr);
+            status = prep->fastConvert(paddr->pfield, pbuf, paddr);
         } else {
             DBADDR localAddr = *paddr; /* Structure copy */
 
@@ -982,12 +1013,11 @@ long dbGet(DBADDR *paddr, short dbrType,
             /* not used by dbFastConvert: */
             localAddr.no_elements = pfl->no_elements;
             localAddr.pfield = dbfl_pfield(pfl);
-            status = dbFastGetConvertRoutine[field_type][dbrType]
-                (localAddr.pfield, pbuf, &localAddr);
+            status = prep->fastConvert(localAddr.pfield, pbuf, &localAddr);
         }
     } else {
         long n;
-        GETCONVERTFUNC convert;
+        GETCONVERTFUNC convert = prep->convert;
 
         if (nRequest) {
             if (no_elements < *nRequest)
@@ -998,7 +1028,6 @@ long dbGet(DBADDR *paddr, short dbrType,
         } else {
             n = 1;
         }
-        convert = dbGetConvertRoutine[field_type][dbrType];
         if (!convert) {
             char message[80];
 
@@ -1029,9 +1058,7 @@ long dbGet(DBADDR *paddr, short dbrType,
             status = convert(&localAddr, pbuf, n, capacity, offset);
         }
 
-        if(!status && dbrType==DBF_CHAR && nRequest &&
-                paddr->pfldDes && paddr->pfldDes->field_type==DBF_STRING)
-        {
+        if (!status && prep->longString && nRequest) {
             /* long string ensure nil and truncate to actual length */
             long nReq = *nRequest;
             pbuf[nReq-1] = '\0';
@@ -1043,6 +1070,38 @@ done:
     return status;
 }
 
+long dbGet(DBADDR *paddr, short dbrType,
+    void *pbuffer, long *options, long *nRequest, void *pflin)
+{
+    db_field_log *pfl = (db_field_log *)pflin;
+    dbChannelGetPrep prep;
+
+    prepareGet(paddr, pfl ? pfl->field_type : paddr->field_type,
+        dbrType, &prep);
+    return getPrepared(paddr, &prep, pbuffer, options, nRequest, pfl);
+}
+
+long dbChannelGetPrepare(dbChannel *chan, short type, long options,
+    dbChannelGetPrep *prep)
+{
+    if (INVALID_DB_REQ(type)) {
+        prep->dbrType = -1;
+        return S_db_badDbrtype;
+    }
+    prepareGet(&chan->addr, chan->addr.field_type, type, prep);
+    prep->chan = chan;
+    prep->options = options;
+    prep->bufferSize = dbBufferSize(type, options, chan->final_no_elements);
+    return 0;
+}
+
+long dbChannelGetPrepared(const dbChannelGetPrep *prep, void *pbuffer,
+    long *options, long *nRequest, void *pfl)
+{
+    return getPrepared(&prep->chan->addr, prep, pbuffer, options, nRequest,
+        (db_field_log *) pfl);
+}
+
 devSup* dbDTYPtoDevSup(dbRecordType *prdes, int dtyp) {
     return (devSup *)ellNth(&prdes->devList, dtyp+1);
 }
@@ -215,6 +215,11 @@ private:
         epicsGuard < epicsMutex > & ) const;
     void show (
         epicsGuard < epicsMutex > &, unsigned level ) const;
+    void startSearches (
+        epicsGuard < epicsMutex > & );
+    void connectionProgress (
+        epicsGuard < epicsMutex > &, unsigned & nChannels,
+        unsigned & nConnected ) const;
 
     dbContext ( const dbContext & );
     dbContext & operator = ( const dbContext & );
@@ -36,6 +36,7 @@
 #include "dbEvent.h"
 #include "dbLock.h"
 #include "dbStaticLib.h"
+#include "dbStaticPvt.h"
 #include "link.h"
 #include "recSup.h"
 #include "special.h"
@@ -342,6 +343,19 @@ long dbChannelTest(const char *name)
     return status;
 }
 
+int dbChannelMayExist(const char *name)
+{
+    const char *pfn;
+
+    if (!name || !*name || !pdbbase)
+        return 0;
+
+    /* the record part, as dbFindRecordPart() */
+    pfn = strchr(name, '.');
+    return dbPvdMayExist(pdbbase, name,
+        pfn ? (size_t) (pfn - name) : strlen(name));
+}
+
 #define TRY(Func, Arg) \
 if (Func) { \
     result = Func Arg; \
@@ -473,6 +487,7 @@ dbChannel * dbChannelCreate(const char *name)
     ellInit(&chan->filters);
     ellInit(&chan->pre_chain);
     ellInit(&chan->post_chain);
+    chan->getPrep.dbrType = -1;
 
     paddr = &chan->addr;
     status = dbEntryToAddr(&dbEntry, paddr);
@@ -627,7 +642,11 @@ long dbChannelOpen(dbChannel *chan)
 long dbChannelGet(dbChannel *chan, short type, void *pbuffer,
         long *options, long *nRequest, void *pfl)
 {
-    return dbGet(&chan->addr, type, pbuffer, options, nRequest, pfl);
+    if (chan->getPrep.dbrType != type &&
+        dbChannelGetPrepare(chan, type, 0, &chan->getPrep))
+        return dbGet(&chan->addr, type, pbuffer, options, nRequest, pfl);
+    return dbChannelGetPrepared(&chan->getPrep, pbuffer, options, nRequest,
+        pfl);
 }
 
 long dbChannelGetField(dbChannel *chan, short dbrType, void *pbuffer,
@@ -54,18 +54,26 @@ struct evSubscrip {
     void              * user_arg;
     /* associated queue, may be shared with other evSubscrip */
     struct event_que  * ev_que;
-    /* NULL if !npend.  if npend!=0, pointer to last event added to event_que::valque */
-    db_field_log     ** pLastLog;
-    /* n times this event is on the queue */
-    unsigned long       npend;
+    /* if npend!=0, pointer to last event added to event_que::valque */
+    void             ** pLastLog;
+    /* n times this event is on the queue (atomic) */
+    size_t              npend;
+    /* owner plus one per queued event not yet delivered (atomic) */
+    int                 refs;
     /* n times replacing event on the queue */
     unsigned long       nreplace;
+    /* max events on the queue before replacing, 0 for no limit */
+    unsigned            depth;
+    /* que entries reserved for this subscription */
+    unsigned            quota;
     /* DBE mask */
     unsigned char       select;
     /* if set, subscription will yield dbfl_type_val */
     char                useValque;
-    /* event_task is handling this subscription */
-    char                callBackInProgress;
+    /* last event added to the queue references the record field */
+    char                lastIsRef;
+    /* event_task is handling this subscription (atomic) */
+    int                 callBackInProgress;
     /* this node added to dbCommon::mlis */
     char                enabled;
 };
@@ -73,6 +81,27 @@ struct evSubscrip {
 
 typedef struct chFilter chFilter;
 
+/** \brief A dbChannelGet() prepared for one request type
+ *
+ * Holds what dbGet() would otherwise look up again on every call for the
+ * channel's field and a request type. Fill it in with dbChannelGetPrepare()
+ * and pass it to dbChannelGetPrepared(). The members are private.
+ */
+typedef struct dbChannelGetPrep {
+    struct dbChannel *chan;   /**< Channel the get was prepared for */
+    short dbrType;            /**< Request type, -1 if not prepared */
+    short field_type;         /**< Field type the routines were chosen for */
+    long options;             /**< Request options the buffer is sized for */
+    long bufferSize;          /**< Bytes needed for options and all elements */
+    long (*fastConvert)();    /**< Scalar conversion routine */
+    long (*convert)(const struct dbAddr *paddr, void *pbuffer,
+        long nRequest, long no_elements, long offset);
+                              /**< Array conversion routine */
+    long (*getArrayInfo)(struct dbAddr *paddr, long *no_elements,
+        long *offset);        /**< Record support get_array_info() or NULL */
+    char longString;          /**< DBR_CHAR of a DBF_STRING field */
+} dbChannelGetPrep;
+
 /** \brief A Database Channel object
  *
  * A dbChannel is created from a user-supplied channel name, and holds
@@ -90,6 +119,7 @@ typedef struct dbChannel {
     ELLLIST filters;          /**< Filters used by dbChannel */
     ELLLIST pre_chain;        /**< Filters on pre-event-queue chain */
     ELLLIST post_chain;       /**< Filters on post-event-queue chain */
+    dbChannelGetPrep getPrep; /**< Last request type used by dbChannelGet() */
 } dbChannel;
 
 /** \brief Event filter function type
@@ -358,6 +388,17 @@ DBCORE_API void dbChannelExit(void);
  */
 DBCORE_API long dbChannelTest(const char *name);
 
+/** \brief Quickly reject PV names which are not on this IOC.
+ *
+ * This routine tests the record name part of the given PV name against a
+ * filter of all record and alias names. It takes no lock and usually reads
+ * one cache line. It may return true for a name that is not present, so
+ * names which pass should still be checked with dbChannelTest().
+ * \param name Channel name.
+ * \returns 0 if the record does not exist, non-zero if it may.
+ */
+DBCORE_API int dbChannelMayExist(const char *name);
+
 /** \brief Create a dbChannel object for the given PV name.
  *
  * \param name Channel name.
@@ -487,6 +528,8 @@ DBCORE_API extern unsigned short dbDBRnewToDBRold[];
 /** \brief dbGet() through a dbChannel.
  *
  * Calls dbGet() for the field that \p chan refers to.
+ * The conversion routines for the last request type used are kept in the
+ * channel, so repeated reads with the same type don't look them up again.
  * Only call this routine if the record is already locked.
  * \param[in] chan Pointer to the dbChannel object.
  * \param[in] type Request type from dbFldTypes.h.
@@ -499,6 +542,43 @@ DBCORE_API extern unsigned short dbDBRnewToDBRold[];
 DBCORE_API long dbChannelGet(dbChannel *chan, short type,
         void *pbuffer, long *options, long *nRequest, void *pfl);
 
+/** \brief Prepare repeated reads of a channel with one request type.
+ *
+ * Looks up the conversion routines for the channel's field and \p type,
+ * the record support get_array_info() routine, and the buffer size needed
+ * for \p options and the channel's final element count. Call this after
+ * dbChannelOpen(). The record need not be locked.
+ * \param[in] chan Pointer to the dbChannel object.
+ * \param[in] type Request type from dbFldTypes.h.
+ * \param[in] options Request options from dbAccessDefs.h.
+ * \param[out] prep The prepared get.
+ * \returns 0, or S_db_badDbrtype if \p type is not a valid request type.
+ */
+DBCORE_API long dbChannelGetPrepare(dbChannel *chan, short type,
+        long options, dbChannelGetPrep *prep);
+
+/** \brief dbChannelGet() with a prepared request type.
+ *
+ * Behaves like dbChannelGet() for the channel and request type of \p prep,
+ * without looking up the conversion routines again. The \p options may be
+ * any subset of those the buffer was sized for. Only call this routine if
+ * the record is already locked.
+ * \param[in] prep Get prepared by dbChannelGetPrepare().
+ * \param[out] pbuffer Pointer to data buffer.
+ * \param[in,out] options Request options from dbAccessDefs.h.
+ * \param[in,out] nRequest Pointer to the element count.
+ * \param[in] pfl Pointer to a db_field_log or NULL.
+ * \returns 0, or an error status value.
+ */
+DBCORE_API long dbChannelGetPrepared(const dbChannelGetPrep *prep,
+        void *pbuffer, long *options, long *nRequest, void *pfl);
+
+/** \brief Buffer size needed by a prepared get.
+ * \param[in] pPrep Pointer to a dbChannelGetPrep.
+ * \returns Bytes for the prepared options and the final element count.
+ */
+#define dbChannelGetPrepSize(pPrep) ((pPrep)->bufferSize)
+
 /** \brief dbGetField() through a dbChannel.
  *
  * Get values from a PV through a channel.
@@ -397,6 +397,31 @@ void dbContext::flush (
     }
 }
 
+void dbContext::startSearches (
+    epicsGuard < epicsMutex > & guard )
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( this->pNetContext.get() ) {
+        this->pNetContext->startSearches ( guard );
+    }
+}
+
+// only counts the channels which are not in this IOC
+void dbContext::connectionProgress (
+    epicsGuard < epicsMutex > & guard, unsigned & nChannels,
+    unsigned & nConnected ) const
+{
+    guard.assertIdenticalMutex ( this->mutex );
+    if ( this->pNetContext.get() ) {
+        this->pNetContext->connectionProgress (
+            guard, nChannels, nConnected );
+    }
+    else {
+        nChannels = 0u;
+        nConnected = 0u;
+    }
+}
+
 unsigned dbContext::circuitCount (
     epicsGuard < epicsMutex > & guard ) const
 {
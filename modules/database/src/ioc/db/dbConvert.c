@@ -60,22 +60,55 @@ static void copyNoConvert(const void *pfrom,
 #define COPYNOCONVERT(N, FROM, TO, NREQ, NO_ELEM, OFFSET) \
     copyNoConvert(FROM, TO, (N)*(NREQ), (N)*(NO_ELEM), (N)*(OFFSET))
 
+/* As copyNoConvert() but the offset and wrap apply to the destination */
+static void copyNoConvertPut(const void *pfrom,
+    void *pto, long nRequest, long no_bytes, long offset)
+{
+    void *pto_offset = (char *) pto + offset;
+
+    if (offset > 0 && offset < no_bytes && offset + nRequest > no_bytes) {
+        const size_t N = no_bytes - offset;
+        const void *pfrom_N = (const char *) pfrom + N;
+
+        /* copy with wrap */
+        memmove(pto_offset, pfrom,   N);
+        memmove(pto,        pfrom_N, nRequest - N);
+    } else {
+        /* no wrap, just copy */
+        memmove(pto_offset, pfrom, nRequest);
+    }
+}
+#define COPYNOCONVERTPUT(N, FROM, TO, NREQ, NO_ELEM, OFFSET) \
+    copyNoConvertPut(FROM, TO, (N)*(NREQ), (N)*(NO_ELEM), (N)*(OFFSET))
+
+/* Number of elements that can be transferred starting at offset before
+ * wrapping around to the start of a circular array. The array is only
+ * wrapped once, so each conversion below is at most two contiguous loops
+ * which the compiler can vectorize.
+ */
+#define FIRSTRUN(NREQ, NO_ELEM, OFFSET) \
+    ((OFFSET) < (NO_ELEM) && (NO_ELEM) - (OFFSET) < (NREQ) ? \
+        (NO_ELEM) - (OFFSET) : (NREQ))
+
 #define GET(typea, typeb) (const dbAddr *paddr, \
     void *pto, long nRequest, long no_elements, long offset) \
 { \
     typea *psrc = (typea *) paddr->pfield; \
     typeb *pdst = (typeb *) pto; \
+    long nFirst, i; \
     \
     if (nRequest==1 && offset==0) { \
         *pdst = (typeb) *psrc; \
         return 0; \
     } \
+    nFirst = FIRSTRUN(nRequest, no_elements, offset); \
     psrc += offset; \
-    while (nRequest--) { \
-        *pdst++ = (typeb) *psrc++; \
-        if (++offset == no_elements) \
-            psrc = (typea *) paddr->pfield; \
-    } \
+    for (i = 0; i < nFirst; i++) \
+        pdst[i] = (typeb) psrc[i]; \
+    psrc = (typea *) paddr->pfield; \
+    pdst += nFirst; \
+    for (i = 0; i < nRequest - nFirst; i++) \
+        pdst[i] = (typeb) psrc[i]; \
     return 0; \
 }
 
@@ -98,17 +131,20 @@ static void copyNoConvert(const void *pfrom,
 { \
     const typea *psrc = (const typea *) pfrom; \
     typeb *pdst = (typeb *) paddr->pfield; \
+    long nFirst, i; \
     \
     if (nRequest==1 && offset==0) { \
         *pdst = (typeb) *psrc; \
         return 0; \
     } \
+    nFirst = FIRSTRUN(nRequest, no_elements, offset); \
     pdst += offset; \
-    while (nRequest--) { \
-        *pdst++ = (typeb) *psrc++; \
-        if (++offset == no_elements) \
-            pdst = (typeb *) paddr->pfield; \
-    } \
+    for (i = 0; i < nFirst; i++) \
+        pdst[i] = (typeb) psrc[i]; \
+    pdst = (typeb *) paddr->pfield; \
+    psrc += nFirst; \
+    for (i = 0; i < nRequest - nFirst; i++) \
+        pdst[i] = (typeb) psrc[i]; \
     return 0; \
 }
 
@@ -122,7 +158,7 @@ static void copyNoConvert(const void *pfrom,
         *pdst = (typeb) *psrc; \
         return 0; \
     } \
-    COPYNOCONVERT(sizeof(typeb), pfrom, paddr->pfield, nRequest, no_elements, offset); \
+    COPYNOCONVERTPUT(sizeof(typeb), pfrom, paddr->pfield, nRequest, no_elements, offset); \
     return 0; \
 }
 
@@ -812,18 +848,20 @@ static long getDoubleFloat(const dbAddr *paddr,
 {
     epicsFloat64 *psrc = (epicsFloat64 *) paddr->pfield;
     epicsFloat32 *pdst = (epicsFloat32 *) pto;
+    long nFirst, i;
 
     if (nRequest==1 && offset==0) {
         *pdst = epicsConvertDoubleToFloat(*psrc);
         return 0;
     }
+    nFirst = FIRSTRUN(nRequest, no_elements, offset);
     psrc += offset;
-    while (nRequest--) {
-        *pdst = epicsConvertDoubleToFloat(*psrc);
-        ++psrc; ++pdst;
-        if (++offset == no_elements)
-            psrc = (epicsFloat64 *) paddr->pfield;
-    }
+    for (i = 0; i < nFirst; i++)
+        pdst[i] = epicsConvertDoubleToFloat(psrc[i]);
+    psrc = (epicsFloat64 *) paddr->pfield;
+    pdst += nFirst;
+    for (i = 0; i < nRequest - nFirst; i++)
+        pdst[i] = epicsConvertDoubleToFloat(psrc[i]);
     return 0;
 }
 
@@ -1641,17 +1679,20 @@ static long putDoubleFloat(dbAddr *paddr,
 {
     const epicsFloat64 *psrc = (const epicsFloat64 *) pfrom;
     epicsFloat32 *pdst = (epicsFloat32 *) paddr->pfield;
+    long nFirst, i;
 
     if (nRequest==1 && offset==0) {
         *pdst = epicsConvertDoubleToFloat(*psrc);
         return 0;
     }
+    nFirst = FIRSTRUN(nRequest, no_elements, offset);
     pdst += offset;
-    while (nRequest--) {
-        *pdst++ = epicsConvertDoubleToFloat(*psrc++);
-        if (++offset == no_elements)
-            pdst = (epicsFloat32 *) paddr->pfield;
-    }
+    for (i = 0; i < nFirst; i++)
+        pdst[i] = epicsConvertDoubleToFloat(psrc[i]);
+    pdst = (epicsFloat32 *) paddr->pfield;
+    psrc += nFirst;
+    for (i = 0; i < nRequest - nFirst; i++)
+        pdst[i] = epicsConvertDoubleToFloat(psrc[i]);
     return 0;
 }
 
@@ -29,8 +29,10 @@
 #include "cantProceed.h"
 #include "dbDefs.h"
 #include "epicsAssert.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
+#include "epicsStdio.h"
 #include "epicsThread.h"
 #include "errlog.h"
 #include "freeList.h"
@@ -44,41 +46,79 @@
 #include "dbChannel.h"
 #include "dbCommon.h"
 #include "dbEvent.h"
+#include "dbExtractArray.h"
 #include "db_field_log.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
+#include "epicsExport.h"
 #include "link.h"
 #include "special.h"
 
-/* Queue size based on Ethernet MTU of 1500 bytes.
+/* Default queue geometry based on Ethernet MTU of 1500 bytes.
  * Assume <=66 bytes of ethernet+IP+TCP overhead
  * and 40 byte CA messages (DBF_TIME_DOUBLE).
  *
  * (1500-66)/40 -> 35
  */
-#define EVENTSPERQUE    36
-#define EVENTENTRIES    4      /* the number of que entries for each event */
-#define EVENTQUESIZE    (EVENTENTRIES  * EVENTSPERQUE)
+int dbEventSubscriptionsPerQueue = 36;
+epicsExportAddress(int, dbEventSubscriptionsPerQueue);
+/* the number of que entries for each event */
+int dbEventEntriesPerSubscription = 4;
+epicsExportAddress(int, dbEventEntriesPerSubscription);
+/* the number of event tasks for each client */
+int dbEventShards = 1;
+epicsExportAddress(int, dbEventShards);
+/* share one copy of array data between the monitors of a post */
+int dbEventArraySnapshots = 0;
+epicsExportAddress(int, dbEventArraySnapshots);
+
+/* Each que added to a client doubles the capacity, up to this many entries */
+#define EVENTQUEMAXSIZE 65536u
+/* entries of one subscription, so that it fits in a que at the limit */
+#define EVENTMAXENTRIES (EVENTQUEMAXSIZE / 2u)
 #define EVENTQEMPTY     ((struct evSubscrip *)NULL)
+#define EVENTMAXSHARDS  64u
 
 /*
  * really a ring buffer
+ *
+ * Writers (db_post_events) serialize on writelock and publish entries
+ * with atomic stores.  The single reader (event_task) never takes
+ * writelock; it claims entries with atomic operations and advances
+ * getix, so readers never slow up writers.
  */
 struct event_que {
     /* lock writers to the ring buffer only */
-    /* readers must never slow up writers */
     epicsMutexId            writelock;
-    db_field_log            *valque[EVENTQUESIZE];
-    struct evSubscrip       *evque[EVENTQUESIZE];
+    EpicsAtomicPtrT         *valque;        /* db_field_log * [size] */
+    EpicsAtomicPtrT         *evque;         /* struct evSubscrip * [size] */
     struct event_que        *nextque;       /* in case que quota exceeded */
     struct event_user       *evUser;        /* event user parent struct */
-    unsigned short          putix;
-    unsigned short          getix;
-    unsigned short          quota;          /* the number of assigned entries*/
-    unsigned short          nDuplicates;    /* N events duplicated on this q */
+    struct event_shard      *shard;         /* reader, NULL for event_task */
+    unsigned                size;           /* the number of entries */
+    unsigned                maxsubs;        /* subscriptions limit, also reserve */
+    unsigned                nsubs;          /* the number of subscriptions */
+    unsigned                quota;          /* the number of assigned entries*/
+    unsigned long           nreplace;       /* events discarded by replacement */
+    unsigned                putix;          /* owned by writers */
+    int                     getix;          /* owned by event_task */
+    int                     nDuplicates;    /* N events duplicated on this q */
+    int                     idle;           /* event_task may sleep, writer must wake it */
     unsigned                possibleStall;
 };
 
+/*
+ * An additional task reading some of the queues of an event_user.
+ * Each que is read by one task only, which preserves the order of
+ * events for each subscription.
+ */
+struct event_shard {
+    struct event_user   *evUser;
+    epicsEventId        ppendsem;       /* Wait while empty */
+    epicsThreadId       taskid;
+    epicsUInt32         pflush_seq;     /* protected by evUser->lock */
+};
+
 struct event_user {
     struct event_que    firstque;       /* the first event que */
 
@@ -92,9 +132,15 @@ struct event_user {
     void                *extralabor_arg;/* parameter to above */
 
     epicsThreadId       taskid;         /* event handler task id */
+    struct event_shard  *shards;        /* [nshards-1] additional tasks */
+    unsigned            nshards;        /* including event_task */
+    unsigned            nextShard;      /* for the next subscription */
+    unsigned            queSubscriptions; /* geometry of firstque */
+    unsigned            queEntries;     /* default entries for each event */
     epicsUInt32         pflush_seq;     /* worker cycle count for synchronization */
     unsigned            queovr;         /* event que overflow count */
     unsigned char       pendexit;       /* exit pend task */
+    unsigned char       shardexit;      /* exit additional tasks */
     unsigned char       extra_labor;    /* if set call extra labor func */
     unsigned char       flowCtrlMode;   /* replace existing monitor */
     unsigned char       extraLaborBusy;
@@ -107,14 +153,60 @@ typedef struct {
     epicsEventId wake;
 } event_waiter;
 
+/*
+ * dbCommon::midx, an index of dbCommon::mlis by field.
+ * Subscriptions to the same field are kept adjacent in mlis, and the
+ * index holds the first node and length of each run, sorted by field
+ * address.  Only accessed while holding the record's mlok.
+ */
+#define MONFIELD_NONE UINT_MAX
+
+typedef struct {
+    void                *pField;
+    struct evSubscrip   *first;     /* first of count adjacent in mlis */
+    unsigned            count;
+    unsigned            mask;       /* db_post_events_many() scratch */
+    unsigned            nextPost;   /* db_post_events_many() scratch */
+} monitor_field;
+
+struct dbMonitorIndex {
+    unsigned            nfields;
+    unsigned            size;
+    monitor_field       fields[1];  /* actually size */
+};
+
+/*
+ * Immutable copy of array field data, shared by the field logs of all
+ * subscriptions updated by one post.  Freed by the last field log.
+ */
+typedef struct {
+    int                 refs;
+    size_t              size;       /* bytes of data */
+    long                no_elements;
+    union {
+        epicsFloat64    d;
+        epicsUInt64     u;
+        void            *p;
+    } data[1];                      /* actually size bytes */
+} array_snapshot;
+
+static size_t snapshotCount;
+static size_t snapshotBytes;
+
+/* event tasks to notify once db_post_events_many() is done */
+typedef struct {
+    unsigned            count;
+    epicsEventId        sems[16];
+} post_wake;
+
 /*
  * Reliable intertask communication requires copying the current value of the
  * channel for later queuing so 3 stepper motor steps of 10 each do not turn
  * into only 10 or 20 total steps part of the time.
  */
 
-#define RNGINC(OLD)\
-( (unsigned short) ( (OLD) >= (EVENTQUESIZE-1) ? 0 : (OLD)+1 ) )
+#define RNGINC(EV_QUE, OLD)\
+( (OLD) >= ((EV_QUE)->size-1) ? 0u : (unsigned) (OLD)+1 )
 
 #define LOCKEVQUE(EV_QUE)   epicsMutexMustLock((EV_QUE)->writelock)
 #define UNLOCKEVQUE(EV_QUE) epicsMutexUnlock((EV_QUE)->writelock)
@@ -130,20 +222,86 @@ static char *EVENT_PEND_NAME = "eventTask";
 
 static epicsMutexId stopSync;
 
-/* unused space in queue (EVENTQUESIZE when empty) */
-static unsigned short ringSpace ( const struct event_que *pevq )
+/* unused space in queue (size when empty)
+ * caller holds writelock.  event_task advances getix before it releases
+ * the slot, so a concurrent read may under-estimate, never over-estimate.
+ */
+static unsigned ringSpace ( const struct event_que *pevq )
 {
-    if ( pevq->evque[pevq->putix] == EVENTQEMPTY ) {
-        if ( pevq->getix > pevq->putix ) {
-            return ( unsigned short ) ( pevq->getix - pevq->putix );
+    if ( epicsAtomicGetPtrT ( &pevq->evque[pevq->putix] ) == EVENTQEMPTY ) {
+        const unsigned getix = (unsigned) epicsAtomicGetIntT ( &pevq->getix );
+        if ( getix > pevq->putix ) {
+            return getix - pevq->putix;
         }
         else {
-            return ( unsigned short ) ( ( EVENTQUESIZE + pevq->getix ) - pevq->putix );
+            return ( pevq->size + getix ) - pevq->putix;
         }
     }
     return 0;
 }
 
+/* the semaphore of the task reading a que */
+static epicsEventId que_pendsem ( const struct event_que *pevq )
+{
+    return pevq->shard ? pevq->shard->ppendsem : pevq->evUser->ppendsem;
+}
+
+/* wake all tasks of an event user */
+static void event_user_signal ( struct event_user *evUser )
+{
+    unsigned i;
+
+    epicsEventSignal ( evUser->ppendsem );
+    for ( i = 0u; i + 1u < evUser->nshards; i++ ) {
+        epicsEventSignal ( evUser->shards[i].ppendsem );
+    }
+}
+
+/*
+ * init_shards()
+ * (re)create the additional tasks' state, caller holds evUser->lock
+ * and none of them is running
+ */
+static int init_shards ( struct event_user *evUser, unsigned nshards )
+{
+    struct event_shard *shards = NULL;
+    unsigned i;
+
+    if ( nshards < 1u ) {
+        nshards = 1u;
+    }
+    if ( nshards > EVENTMAXSHARDS ) {
+        nshards = EVENTMAXSHARDS;
+    }
+
+    if ( nshards > 1u ) {
+        shards = calloc ( nshards - 1u, sizeof ( *shards ) );
+        if ( ! shards ) {
+            return DB_EVENT_ERROR;
+        }
+        for ( i = 0u; i + 1u < nshards; i++ ) {
+            shards[i].evUser = evUser;
+            shards[i].ppendsem = epicsEventCreate ( epicsEventEmpty );
+            if ( ! shards[i].ppendsem ) {
+                while ( i-- > 0u ) {
+                    epicsEventDestroy ( shards[i].ppendsem );
+                }
+                free ( shards );
+                return DB_EVENT_ERROR;
+            }
+        }
+    }
+
+    for ( i = 0u; i + 1u < evUser->nshards; i++ ) {
+        epicsEventDestroy ( evUser->shards[i].ppendsem );
+    }
+    free ( evUser->shards );
+    evUser->shards = shards;
+    evUser->nshards = nshards;
+    evUser->nextShard = 0u;
+    return DB_EVENT_OK;
+}
+
 int db_event_list ( const char *pname, unsigned level )
 {
     return dbel ( pname, level );
@@ -189,22 +347,32 @@ int dbel ( const char *pname, unsigned level )
             if ( pevent->select & DBE_PROPERTY ) printf( "PROPERTY " );
             printf ( "}" );
 
-            if ( pevent->npend ) {
-                printf ( " undelivered=%ld", pevent->npend );
+            if ( epicsAtomicGetSizeT ( &pevent->npend ) ) {
+                printf ( " undelivered=%lu",
+                    (unsigned long) epicsAtomicGetSizeT ( &pevent->npend ) );
+            }
+
+            if ( pevent->nreplace ) {
+                printf (" discarded by replacement=%lu", pevent->nreplace);
             }
 
             if ( level > 1 ) {
-                unsigned nEntriesFree;
+                unsigned nEntriesFree, size;
+                unsigned long nreplace;
                 const void * taskId;
                 LOCKEVQUE(pevent->ev_que);
                 nEntriesFree = ringSpace ( pevent->ev_que );
-                taskId = ( void * ) pevent->ev_que->evUser->taskid;
+                size = pevent->ev_que->size;
+                nreplace = pevent->ev_que->nreplace;
+                taskId = ( void * ) ( pevent->ev_que->shard ?
+                    pevent->ev_que->shard->taskid :
+                    pevent->ev_que->evUser->taskid );
                 UNLOCKEVQUE(pevent->ev_que);
                 if ( nEntriesFree == 0u ) {
                     printf ( ", thread=%p, queue full",
                         (void *) taskId );
                 }
-                else if ( nEntriesFree == EVENTQUESIZE ) {
+                else if ( nEntriesFree == size ) {
                     printf ( ", thread=%p, queue empty",
                         (void *) taskId );
                 }
@@ -212,21 +380,23 @@ int dbel ( const char *pname, unsigned level )
                     printf ( ", thread=%p, unused entries=%u",
                         (void *) taskId, nEntriesFree );
                 }
+                printf ( ", queue size=%u", size );
+                if ( nreplace ) {
+                    printf ( ", queue discarded=%lu", nreplace );
+                }
             }
 
             if ( level > 2 ) {
-                unsigned nDuplicates;
-                if ( pevent->nreplace ) {
-                    printf (", discarded by replacement=%ld", pevent->nreplace);
+                int nDuplicates;
+                if ( pevent->depth ) {
+                    printf (", depth=%u", pevent->depth );
                 }
                 if ( ! pevent->useValque ) {
                     printf (", queueing disabled" );
                 }
-                LOCKEVQUE(pevent->ev_que);
-                nDuplicates = pevent->ev_que->nDuplicates;
-                UNLOCKEVQUE(pevent->ev_que);
-                if  ( nDuplicates ) {
-                    printf (", duplicate count =%u\n", nDuplicates );
+                nDuplicates = epicsAtomicGetIntT ( &pevent->ev_que->nDuplicates );
+                if  ( nDuplicates > 0 ) {
+                    printf (", duplicate count =%d\n", nDuplicates );
                 }
             }
 
@@ -280,6 +450,44 @@ void db_init_event_freelists (void)
     }
 }
 
+/*
+ * init_ev_que()
+ *
+ * allocate the ring buffer for nsubs subscriptions of nentries each
+ */
+static int init_ev_que ( struct event_que * const ev_que,
+    unsigned nsubs, unsigned nentries )
+{
+    EpicsAtomicPtrT *ring;
+
+    if ( nentries < 1u ) {
+        nentries = 1u;
+    }
+    if ( nentries > EVENTMAXENTRIES ) {
+        nentries = EVENTMAXENTRIES;
+    }
+    if ( nsubs > EVENTQUEMAXSIZE / nentries ) {
+        nsubs = EVENTQUEMAXSIZE / nentries;
+    }
+    /* one subscription beyond the limit is kept free as reserve */
+    if ( nsubs < 2u ) {
+        nsubs = 2u;
+    }
+
+    ring = (EpicsAtomicPtrT *) calloc ( 2u * nsubs * nentries, sizeof ( *ring ) );
+    if ( ! ring ) {
+        return DB_EVENT_ERROR;
+    }
+    free ( ev_que->valque );
+    ev_que->valque = ring;
+    ev_que->evque = ring + nsubs * nentries;
+    ev_que->size = nsubs * nentries;
+    ev_que->maxsubs = nsubs;
+    ev_que->putix = 0u;
+    ev_que->getix = 0;
+    return DB_EVENT_OK;
+}
+
 /*
  * DB_INIT_EVENTS()
  *
@@ -304,7 +512,22 @@ dbEventCtx db_init_events (void)
     /* Flag will be cleared when event task starts */
     evUser->pendexit = TRUE;
 
+    evUser->queSubscriptions = dbEventSubscriptionsPerQueue > 0 ?
+        (unsigned) dbEventSubscriptionsPerQueue : 1u;
+    evUser->queEntries = dbEventEntriesPerSubscription > 0 ?
+        (unsigned) dbEventEntriesPerSubscription : 1u;
+    if (evUser->queEntries > EVENTMAXENTRIES)
+        evUser->queEntries = EVENTMAXENTRIES;
+
+    if (init_shards(evUser, dbEventShards > 0 ?
+            (unsigned) dbEventShards : 1u) != DB_EVENT_OK)
+        goto fail;
+
     evUser->firstque.evUser = evUser;
+    evUser->firstque.idle = TRUE;
+    if (init_ev_que(&evUser->firstque, evUser->queSubscriptions,
+            evUser->queEntries) != DB_EVENT_OK)
+        goto fail;
     evUser->firstque.writelock = epicsMutexCreate();
     if (!evUser->firstque.writelock)
         goto fail;
@@ -323,10 +546,12 @@ dbEventCtx db_init_events (void)
     evUser->extraLaborBusy = FALSE;
     return (dbEventCtx) evUser;
 fail:
+    init_shards(evUser, 1u);
     if(evUser->lock)
         epicsMutexDestroy (evUser->lock);
     if(evUser->firstque.writelock)
         epicsMutexDestroy (evUser->firstque.writelock);
+    free(evUser->firstque.valque);
     if(evUser->ppendsem)
         epicsEventDestroy (evUser->ppendsem);
     if(evUser->pexitsem)
@@ -360,6 +585,28 @@ DBCORE_API void db_cleanup_events(void)
  *  itself
  *
  */
+/*
+ * free_event_ques()
+ *
+ * Free all ques of an event user whose task is not running
+ */
+static void free_event_ques ( struct event_user *evUser )
+{
+    struct event_que *ev_que = evUser->firstque.nextque;
+
+    epicsMutexDestroy ( evUser->firstque.writelock );
+    free ( evUser->firstque.valque );
+
+    while ( ev_que ) {
+        struct event_que *nextque = ev_que->nextque;
+
+        epicsMutexDestroy ( ev_que->writelock );
+        free ( ev_que->valque );
+        freeListFree ( dbevEventQueueFreeList, ev_que );
+        ev_que = nextque;
+    }
+}
+
 void db_close_events (dbEventCtx ctx)
 {
     struct event_user * const evUser = (struct event_user *) ctx;
@@ -374,6 +621,19 @@ void db_close_events (dbEventCtx ctx)
      */
     epicsMutexMustLock ( evUser->lock );
     if(!evUser->pendexit) { /* event task running */
+        unsigned i;
+
+        /* additional tasks first, event_task frees the queues */
+        evUser->shardexit = TRUE;
+        epicsMutexUnlock ( evUser->lock );
+        for (i = 0u; i + 1u < evUser->nshards; i++) {
+            if (evUser->shards[i].taskid) {
+                epicsEventSignal(evUser->shards[i].ppendsem);
+                epicsThreadMustJoin(evUser->shards[i].taskid);
+            }
+        }
+        epicsMutexMustLock ( evUser->lock );
+
         evUser->pendexit = TRUE;
         epicsMutexUnlock ( evUser->lock );
 
@@ -385,7 +645,12 @@ void db_close_events (dbEventCtx ctx)
 
         epicsMutexMustLock ( evUser->lock );
     }
+    else {
+        /* never started, the ques are ours to free */
+        free_event_ques ( evUser );
+    }
 
+    init_shards(evUser, 1u);
     epicsMutexUnlock ( evUser->lock );
 
     epicsMutexMustLock (stopSync);
@@ -399,22 +664,106 @@ void db_close_events (dbEventCtx ctx)
     freeListFree(dbevEventUserFreeList, evUser);
 }
 
+/*
+ * DB_EVENT_QUEUE_GEOMETRY()
+ *
+ * Size the first event que of a client for nSubscriptions of nEntries
+ * each.  Must be called before db_start_events() and db_add_event().
+ */
+int db_event_queue_geometry ( dbEventCtx ctx,
+    unsigned nSubscriptions, unsigned nEntries )
+{
+    struct event_user * const evUser = (struct event_user *) ctx;
+    int status = DB_EVENT_ERROR;
+
+    if ( nSubscriptions == 0u || nEntries == 0u ) {
+        return DB_EVENT_ERROR;
+    }
+    if ( nEntries > EVENTMAXENTRIES ) {
+        nEntries = EVENTMAXENTRIES;
+    }
+
+    epicsMutexMustLock ( evUser->lock );
+    LOCKEVQUE ( &evUser->firstque );
+    /* event_task reads firstque without locking */
+    if ( ! evUser->taskid && evUser->firstque.nsubs == 0u ) {
+        status = init_ev_que ( &evUser->firstque, nSubscriptions, nEntries );
+        if ( status == DB_EVENT_OK ) {
+            evUser->queSubscriptions = nSubscriptions;
+            evUser->queEntries = nEntries;
+        }
+    }
+    UNLOCKEVQUE ( &evUser->firstque );
+    epicsMutexUnlock ( evUser->lock );
+
+    return status;
+}
+
+/*
+ * DB_EVENT_SHARDS()
+ *
+ * Read the event queues of a client with nShards tasks.  Subscriptions
+ * are spread over them, the events of each are delivered in order by
+ * one task.  Must be called before db_start_events() and db_add_event().
+ */
+int db_event_shards ( dbEventCtx ctx, unsigned nShards )
+{
+    struct event_user * const evUser = (struct event_user *) ctx;
+    int status = DB_EVENT_ERROR;
+
+    if ( nShards == 0u || nShards > EVENTMAXSHARDS ) {
+        return DB_EVENT_ERROR;
+    }
+
+    epicsMutexMustLock ( evUser->lock );
+    if ( ! evUser->taskid && evUser->firstque.nsubs == 0u &&
+            ! evUser->firstque.nextque ) {
+        status = init_shards ( evUser, nShards );
+    }
+    epicsMutexUnlock ( evUser->lock );
+
+    return status;
+}
+
+/*
+ * DB_EVENT_SHARD_COUNT()
+ */
+unsigned db_event_shard_count ( dbEventCtx ctx )
+{
+    struct event_user * const evUser = (struct event_user *) ctx;
+
+    return evUser->nshards;
+}
+
 /*
  * create_ev_que()
+ *
+ * each que added doubles the number of subscriptions of the last one
+ * read by the same task
  */
-static struct event_que * create_ev_que ( struct event_user * const evUser )
+static struct event_que * create_ev_que ( struct event_user * const evUser,
+    const struct event_que * const prev, struct event_shard * const shard )
 {
     struct event_que * const ev_que = (struct event_que *)
         freeListCalloc ( dbevEventQueueFreeList );
     if ( ! ev_que ) {
         return NULL;
     }
+    if ( init_ev_que ( ev_que,
+            prev ? 2u * prev->maxsubs : evUser->firstque.maxsubs,
+            evUser->queEntries ) != DB_EVENT_OK ) {
+        freeListFree ( dbevEventQueueFreeList, ev_que );
+        return NULL;
+    }
     ev_que->writelock = epicsMutexCreate();
     if ( ! ev_que->writelock ) {
+        free ( ev_que->valque );
         freeListFree ( dbevEventQueueFreeList, ev_que );
         return NULL;
     }
     ev_que->evUser = evUser;
+    ev_que->shard = shard;
+    ev_que->idle = TRUE;
     return ev_que;
 }
 
@@ -424,10 +773,28 @@ static struct event_que * create_ev_que ( struct event_user * const evUser )
 dbEventSubscription db_add_event (
     dbEventCtx ctx, struct dbChannel *chan,
     EVENTFUNC *user_sub, void *user_arg, unsigned select)
+{
+    return db_add_event_depth ( ctx, chan, user_sub, user_arg, select, 0u );
+}
+
+/*
+ * DB_ADD_EVENT_DEPTH()
+ *
+ * depth limits the number of events queued for this subscription
+ * before the last one is replaced, 0 for no limit other than the
+ * que space shared with the other subscriptions of the client.
+ * Depths over EVENTMAXENTRIES (32768) are reduced to it.
+ */
+dbEventSubscription db_add_event_depth (
+    dbEventCtx ctx, struct dbChannel *chan,
+    EVENTFUNC *user_sub, void *user_arg, unsigned select, unsigned depth)
 {
     struct event_user * const evUser = (struct event_user *) ctx;
     struct event_que * ev_que;
+    struct event_que * prev;
+    struct event_shard * shard;
     struct evSubscrip * pevent;
+    unsigned quota;
 
     /*
      * Don't add events which will not be triggered
@@ -443,21 +810,45 @@ dbEventSubscription db_add_event (
 
     /* find an event que block with enough quota */
     /* otherwise add a new one to the list */
+    /* a larger quota would never fit, and add ques until memory runs out */
+    if ( depth > EVENTMAXENTRIES ) {
+        depth = EVENTMAXENTRIES;
+    }
     epicsMutexMustLock ( evUser->lock );
+    quota = evUser->queEntries;
+    if ( depth > quota ) {
+        quota = depth;
+    }
+    /* spread subscriptions over the tasks */
+    shard = NULL;
+    if ( evUser->nshards > 1u ) {
+        const unsigned ishard = evUser->nextShard;
+
+        evUser->nextShard = ( ishard + 1u ) % evUser->nshards;
+        if ( ishard > 0u ) {
+            shard = &evUser->shards[ishard - 1u];
+        }
+    }
     ev_que = & evUser->firstque;
+    prev = NULL;
     while ( TRUE ) {
         int success = 0;
-        LOCKEVQUE ( ev_que );
-        success = ( ev_que->quota < EVENTQUESIZE - EVENTENTRIES );
-        if ( success ) {
-            ev_que->quota += EVENTENTRIES;
-        }
-        UNLOCKEVQUE ( ev_que );
-        if ( success ) {
-            break;
+        if ( ev_que->shard == shard ) {
+            LOCKEVQUE ( ev_que );
+            success = ( ev_que->nsubs + 1u < ev_que->maxsubs &&
+                        ev_que->quota + quota < ev_que->size );
+            if ( success ) {
+                ev_que->quota += quota;
+                ev_que->nsubs++;
+            }
+            UNLOCKEVQUE ( ev_que );
+            if ( success ) {
+                break;
+            }
+            prev = ev_que;
         }
         if ( ! ev_que->nextque ) {
-            ev_que->nextque = create_ev_que ( evUser );
+            ev_que->nextque = create_ev_que ( evUser, prev, shard );
             if ( ! ev_que->nextque ) {
                 ev_que = NULL;
                 break;
@@ -472,13 +863,17 @@ dbEventSubscription db_add_event (
         return NULL;
     }
 
-    pevent->npend =     0ul;
+    pevent->npend =     0u;
+    pevent->refs =      1;      /* released by db_cancel_event() */
     pevent->nreplace =  0ul;
+    pevent->depth =     depth;
+    pevent->quota =     quota;
     pevent->user_sub =  user_sub;
     pevent->user_arg =  user_arg;
     pevent->chan =      chan;
     pevent->select =    (unsigned char) select;
     pevent->pLastLog =  NULL; /* not yet in the queue */
+    pevent->lastIsRef = FALSE;
     pevent->callBackInProgress = FALSE;
     pevent->enabled =   FALSE;
     pevent->ev_que =    ev_que;
@@ -500,6 +895,118 @@ dbEventSubscription db_add_event (
     return pevent;
 }
 
+/*
+ * monitor_field_find()
+ * binary search of the index.  Returns the entry for pField, or NULL
+ * with *pPos set to where it would be inserted.
+ */
+static monitor_field * monitor_field_find ( struct dbMonitorIndex *pidx,
+    const void *pField, unsigned *pPos )
+{
+    unsigned lo = 0u, hi = pidx ? pidx->nfields : 0u;
+
+    while ( lo < hi ) {
+        const unsigned mid = lo + ( hi - lo ) / 2u;
+        const char * const pmid = (const char *) pidx->fields[mid].pField;
+
+        if ( pmid == (const char *) pField ) {
+            if ( pPos ) *pPos = mid;
+            return &pidx->fields[mid];
+        }
+        if ( pmid < (const char *) pField )
+            lo = mid + 1u;
+        else
+            hi = mid;
+    }
+    if ( pPos ) *pPos = lo;
+    return NULL;
+}
+
+/*
+ * monitor_list_add()
+ * caller holds mlok
+ */
+static void monitor_list_add ( struct dbCommon *precord,
+    struct evSubscrip *pevent )
+{
+    struct dbMonitorIndex *pidx = precord->midx;
+    void * const pField = dbChannelField ( pevent->chan );
+    monitor_field *pmf;
+    unsigned pos;
+
+    pmf = monitor_field_find ( pidx, pField, &pos );
+    if ( pmf ) {
+        /* join the end of the run of subscriptions on this field,
+         * so that they are posted in the order they were added */
+        ELLNODE *pLast = &pmf->first->node;
+        unsigned i;
+
+        for ( i = 1u; i < pmf->count; i++ ) {
+            pLast = ellNext ( pLast );
+        }
+        ellInsert ( &precord->mlis, pLast, &pevent->node );
+        pmf->count++;
+        return;
+    }
+
+    if ( ! pidx || pidx->nfields == pidx->size ) {
+        const unsigned size = pidx ? 2u * pidx->size : 4u;
+        struct dbMonitorIndex *pnew = callocMustSucceed ( 1,
+            sizeof ( *pnew ) + ( size - 1u ) * sizeof ( pnew->fields[0] ),
+            "monitor_list_add" );
+
+        pnew->size = size;
+        if ( pidx ) {
+            pnew->nfields = pidx->nfields;
+            memcpy ( pnew->fields, pidx->fields,
+                pidx->nfields * sizeof ( pidx->fields[0] ) );
+            free ( pidx );
+        }
+        precord->midx = pidx = pnew;
+    }
+
+    memmove ( &pidx->fields[pos + 1u], &pidx->fields[pos],
+        ( pidx->nfields - pos ) * sizeof ( pidx->fields[0] ) );
+    pidx->nfields++;
+    pmf = &pidx->fields[pos];
+    pmf->pField = pField;
+    pmf->first = pevent;
+    pmf->count = 1u;
+    pmf->mask = 0u;
+    pmf->nextPost = MONFIELD_NONE;
+    ellAdd ( &precord->mlis, &pevent->node );
+}
+
+/*
+ * monitor_list_remove()
+ * caller holds mlok
+ */
+static void monitor_list_remove ( struct dbCommon *precord,
+    struct evSubscrip *pevent )
+{
+    struct dbMonitorIndex * const pidx = precord->midx;
+    monitor_field *pmf;
+    unsigned pos;
+
+    pmf = monitor_field_find ( pidx, dbChannelField ( pevent->chan ), &pos );
+    assert ( pmf && pmf->count > 0u );
+
+    if ( pmf->first == pevent ) {
+        pmf->first = (struct evSubscrip *) ellNext ( &pevent->node );
+    }
+    ellDelete ( &precord->mlis, &pevent->node );
+
+    if ( --pmf->count == 0u ) {
+        pidx->nfields--;
+        memmove ( &pidx->fields[pos], &pidx->fields[pos + 1u],
+            ( pidx->nfields - pos ) * sizeof ( pidx->fields[0] ) );
+        if ( pidx->nfields == 0u ) {
+            free ( pidx );
+            precord->midx = NULL;
+        }
+    }
+}
+
 /*
  * db_event_enable()
  */
@@ -510,7 +1017,7 @@ void db_event_enable (dbEventSubscription event)
 
     LOCKREC (precord);
     if ( ! pevent->enabled ) {
-        ellAdd (&precord->mlis, &pevent->node);
+        monitor_list_add (precord, pevent);
         pevent->enabled = TRUE;
     }
     UNLOCKREC (precord);
@@ -526,33 +1033,54 @@ void db_event_disable (dbEventSubscription event)
 
     LOCKREC (precord);
     if ( pevent->enabled ) {
-        ellDelete(&precord->mlis, &pevent->node);
+        monitor_list_remove (precord, pevent);
         pevent->enabled = FALSE;
     }
     UNLOCKREC (precord);
 }
 
+/*
+ * event_free()
+ * release a subscription once its last reference is dropped
+ */
+static void event_free ( struct evSubscrip *pevent )
+{
+    struct event_que * const ev_que = pevent->ev_que;
+
+    LOCKEVQUE (ev_que);
+    ev_que->quota -= pevent->quota;
+    ev_que->nsubs--;
+    UNLOCKEVQUE (ev_que);
+    freeListFree ( dbevEventSubscriptionFreeList, pevent );
+}
+
 /*
  * event_remove()
- * event queue lock _must_ be applied
- * this nulls the entry in the queue, but doesn't delete the db_field_log chunk
+ * called only by event_task, which owns getix.
+ * this claims the entry at getix and releases its slot, but doesn't
+ * delete the db_field_log chunk, which is returned to the caller.
  */
-static void event_remove ( struct event_que *ev_que,
-    unsigned short index, struct evSubscrip *placeHolder )
+static db_field_log * event_remove ( struct event_que *ev_que,
+    struct evSubscrip *pevent )
 {
-    struct evSubscrip * const pevent = ev_que->evque[index];
+    const unsigned index = (unsigned) ev_que->getix;
+    db_field_log *pfl;
 
-    ev_que->evque[index] = placeHolder;
-    ev_que->valque[index] = NULL;
-    if ( pevent->npend == 1u ) {
-        pevent->pLastLog = NULL;
-    }
-    else {
-        assert ( pevent->npend > 1u );
-        assert ( ev_que->nDuplicates >= 1u );
-        ev_que->nDuplicates--;
+    /* may race with a writer replacing the last event of pevent */
+    do {
+        pfl = (db_field_log *) epicsAtomicGetPtrT ( &ev_que->valque[index] );
+    } while ( epicsAtomicCmpAndSwapPtrT ( &ev_que->valque[index],
+                pfl, NULL ) != pfl );
+
+    if ( epicsAtomicDecrSizeT ( &pevent->npend ) > 0u ) {
+        epicsAtomicDecrIntT ( &ev_que->nDuplicates );
     }
-    pevent->npend--;
+
+    /* advance before releasing the slot, see ringSpace() */
+    epicsAtomicSetIntT ( &ev_que->getix, (int) RNGINC ( ev_que, index ) );
+    epicsAtomicSetPtrT ( &ev_que->evque[index], EVENTQEMPTY );
+
+    return pfl;
 }
 
 /*
@@ -570,30 +1098,25 @@ void db_cancel_event (dbEventSubscription event)
 
     db_event_disable ( event );
 
-    LOCKEVQUE (que);
-
     pevent->user_sub = NULL; /* callback pointer doubles as canceled flag */
 
-    if(pevent->callBackInProgress) {
+    /* full barrier, pairs with the one in event_read() so that either
+     * event_task sees the cancel or we see the callback in progress
+     */
+    if ( epicsAtomicCmpAndSwapIntT ( &pevent->callBackInProgress,
+            FALSE, FALSE ) ) {
         /* this event callback is pending or in-progress in event_task. */
-        if(pevent->ev_que->evUser->taskid != epicsThreadGetIdSelf())
+        epicsThreadId reader = que->shard ? que->shard->taskid :
+                                            que->evUser->taskid;
+        if(reader != epicsThreadGetIdSelf())
             sync = 1; /* concurrent to event_task, so wait */
-
-    } else if(pevent->npend) {
-        /* some (now defunct) events in the queue, defer free() to event_task */
-
-    } else {
-        /* no other references, cleanup now */
-
-        pevent->ev_que->quota -= EVENTENTRIES;
-        freeListFree ( dbevEventSubscriptionFreeList, pevent );
     }
 
-    UNLOCKEVQUE (que);
-
     if(sync) {
         /* cycle through worker */
         struct event_user *evUser = que->evUser;
+        epicsUInt32 * const pSeq = que->shard ? &que->shard->pflush_seq :
+                                                &evUser->pflush_seq;
         epicsUInt32 curSeq;
         event_waiter wait;
         wait.wake = epicsEventCreate(epicsEventEmpty); /* may fail */
@@ -601,11 +1124,11 @@ void db_cancel_event (dbEventSubscription event)
         epicsMutexMustLock ( evUser->lock );
         ellAdd(&evUser->waiters, &wait.node);
         /* grab current cycle counter, then wait for it to change */
-        curSeq = evUser->pflush_seq;
+        curSeq = *pSeq;
         do {
             epicsMutexUnlock( evUser->lock );
             /* ensure worker will cycle at least once */
-            epicsEventMustTrigger(evUser->ppendsem);
+            epicsEventMustTrigger(que_pendsem(que));
 
             if(wait.wake) {
                 epicsEventMustWait(wait.wake);
@@ -614,13 +1137,18 @@ void db_cancel_event (dbEventSubscription event)
             }
 
             epicsMutexMustLock ( evUser->lock );
-        } while(curSeq == evUser->pflush_seq);
+        } while(curSeq == *pSeq);
         ellDelete(&evUser->waiters, &wait.node);
         /* destroy under lock to ensure epicsEventMustTrigger() has returned */
         if(wait.wake)
             epicsEventDestroy(wait.wake);
         epicsMutexUnlock( evUser->lock );
     }
+
+    /* (now defunct) events still in the queue defer free() to event_task */
+    if ( ! epicsAtomicDecrIntT ( &pevent->refs ) ) {
+        event_free ( pevent );
+    }
 }
 
 /*
@@ -761,17 +1289,23 @@ db_field_log* db_create_read_log (struct dbChannel *chan)
 /*
  *  DB_QUEUE_EVENT_LOG()
  *
+ *  Returns the semaphore of the task which must be notified, or NULL.
+ *  The caller signals it, which lets db_post_events_many() wake
+ *  each event task only once.
  */
-static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
+static epicsEventId db_queue_event_log (evSubscrip *pevent,
+    db_field_log *pLog)
 {
     struct event_que    *ev_que;
-    int firstEventFlag;
+    db_field_log *pReplaced = NULL;
+    int wakeFlag = 0;
     unsigned rngSpace;
+    size_t npend;
 
     ev_que = pevent->ev_que;
     /*
      * evUser ring buffer must be locked for the multiple
-     * threads writing/reading it
+     * threads writing it
      */
 
     LOCKEVQUE (ev_que);
@@ -780,12 +1314,12 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
      * event on the queue and the current event reference
      * a record field, simply ignore duplicate events.
      */
-    if (pevent->npend > 0u
-            && !dbfl_has_copy(*pevent->pLastLog)
+    if (epicsAtomicGetSizeT(&pevent->npend) > 0u
+            && pevent->lastIsRef
             && !dbfl_has_copy(pLog)) {
-        db_delete_field_log(pLog);
         UNLOCKEVQUE (ev_que);
-        return;
+        db_delete_field_log(pLog);
+        return NULL;
     }
 
     /*
@@ -794,66 +1328,73 @@ static void db_queue_event_log (evSubscrip *pevent, db_field_log *pLog)
 
     /*
      * if an event is on the queue and one of
-     * {flowCtrlMode, not room for one more of each monitor attached}
+     * {flowCtrlMode, not room for one more of each monitor attached,
+     * depth of this monitor reached}
      * then replace the last event on the queue (for this monitor)
      */
     rngSpace = ringSpace ( ev_que );
-    if ( pevent->npend>0u &&
-        (ev_que->evUser->flowCtrlMode || rngSpace<=EVENTSPERQUE) ) {
+    npend = epicsAtomicGetSizeT(&pevent->npend);
+    if ( npend > 0u &&
+        (ev_que->evUser->flowCtrlMode || rngSpace<=ev_que->maxsubs ||
+         (pevent->depth && npend >= pevent->depth)) ) {
         /*
-         * replace last event if no space is left
+         * replace last event if no space is left.
+         * The slot can't be reused while we hold writelock,
+         * but event_task may claim it at any time.
          */
-        if (*pevent->pLastLog) {
-            db_delete_field_log(*pevent->pLastLog);
-            *pevent->pLastLog = pLog;
+        pReplaced = (db_field_log *) epicsAtomicGetPtrT ( pevent->pLastLog );
+        if ( pReplaced && epicsAtomicCmpAndSwapPtrT ( pevent->pLastLog,
+                pReplaced, pLog ) == pReplaced ) {
+            pevent->lastIsRef = !dbfl_has_copy(pLog);
+            pevent->nreplace++;
+            ev_que->nreplace++;
+            /*
+             * the event task has already been notified about
+             * this so we don't need to post the semaphore
+             */
+            pLog = NULL;
+        }
+        else {
+            /* event_task took it first, so queue a new entry */
+            pReplaced = NULL;
         }
-        pevent->nreplace++;
-        /*
-         * the event task has already been notified about
-         * this so we don't need to post the semaphore
-         */
-        firstEventFlag = 0;
     }
     /*
      * Otherwise, the current entry must be available.
      * Fill it in and advance the ring buffer.
      */
-    else {
-        assert ( ev_que->evque[ev_que->putix] == EVENTQEMPTY );
-        ev_que->evque[ev_que->putix] = pevent;
-        ev_que->valque[ev_que->putix] = pLog;
-        pevent->pLastLog = &ev_que->valque[ev_que->putix];
-        if (pevent->npend>0u) {
-            ev_que->nDuplicates++;
+    if ( pLog ) {
+        const unsigned putix = ev_que->putix;
+
+        assert ( epicsAtomicGetPtrT ( &ev_que->evque[putix] ) == EVENTQEMPTY );
+        /* counted before the entry is visible to event_task */
+        epicsAtomicIncrIntT ( &pevent->refs );
+        if ( epicsAtomicIncrSizeT ( &pevent->npend ) > 1u ) {
+            epicsAtomicIncrIntT ( &ev_que->nDuplicates );
         }
-        pevent->npend++;
+        epicsAtomicSetPtrT ( &ev_que->valque[putix], pLog );
+        pevent->pLastLog = &ev_que->valque[putix];
+        pevent->lastIsRef = !dbfl_has_copy(pLog);
+        epicsAtomicSetPtrT ( &ev_que->evque[putix], pevent );
+        ev_que->putix = RNGINC ( ev_que, putix );
         /*
-         * if the ring buffer was empty before
-         * adding this event
+         * if the event task has drained the ring buffer and
+         * may be waiting. full barrier, pairs with event_read()
          */
-        if (rngSpace==EVENTQUESIZE) {
-            firstEventFlag = 1;
-        }
-        else {
-            firstEventFlag = 0;
-        }
-        ev_que->putix = RNGINC ( ev_que->putix );
+        wakeFlag = epicsAtomicCmpAndSwapIntT ( &ev_que->idle, TRUE, FALSE );
     }
 
     UNLOCKEVQUE (ev_que);
 
+    db_delete_field_log(pReplaced);
+
     /*
      * its more efficient to notify the event handler
      * only after the event is ready and the lock
      * is off in case it runs at a higher priority
      * than the caller here.
      */
-    if (firstEventFlag) {
-        /*
-         * notify the event handler
-         */
-        epicsEventSignal(ev_que->evUser->ppendsem);
-    }
+    return wakeFlag ? que_pendsem ( ev_que ) : NULL;
 }
 
 /*
@@ -867,31 +1408,217 @@ void            *pRecord,
 void            *pField,
 unsigned int    caEventMask
 )
+{
+    db_post_field post;
+
+    post.pField = pField;
+    post.mask = caEventMask;
+    return db_post_events_many(pRecord, &post, 1u);
+}
+
+/*
+ *  SNAPSHOT_RELEASE()
+ *
+ *  Drop one reference to an array snapshot
+ */
+static void snapshot_release (array_snapshot *psnap)
+{
+    if ( ! epicsAtomicDecrIntT ( &psnap->refs ) ) {
+        epicsAtomicSubSizeT ( &snapshotBytes, psnap->size );
+        epicsAtomicDecrSizeT ( &snapshotCount );
+        free ( psnap );
+    }
+}
+
+/* dtor of a field log referencing an array snapshot */
+static void snapshot_field_log_free (db_field_log *pfl)
+{
+    snapshot_release ( (array_snapshot *) pfl->u.r.pvt );
+}
+
+/*
+ *  SNAPSHOT_CREATE()
+ *
+ *  Copy the current array data of a field, unwrapping any offset.
+ *  NOTE: This assumes that the db scan lock is already applied
+ *        (as it calls rset->get_array_info)
+ */
+static array_snapshot * snapshot_create (struct dbChannel *chan)
+{
+    array_snapshot *psnap;
+    void *pSource = dbChannelField(chan);
+    long capacity = dbChannelElements(chan);
+    long nSource = capacity;
+    long offset = 0;
+    size_t size;
+
+    dbChannelGetArrayInfo(chan, &pSource, &nSource, &offset);
+    if (nSource > capacity)
+        nSource = capacity;
+    if (nSource < 0)
+        nSource = 0;
+    size = (size_t) nSource * dbChannelFieldSize(chan);
+
+    psnap = malloc ( offsetof ( array_snapshot, data ) + size );
+    if ( ! psnap )
+        return NULL;
+    psnap->refs = 1;
+    psnap->size = size;
+    psnap->no_elements = nSource;
+    if ( nSource > 0 )
+        dbExtractArray ( pSource, psnap->data, dbChannelFieldSize(chan),
+            nSource, capacity, offset, 1 );
+
+    epicsAtomicIncrSizeT ( &snapshotCount );
+    epicsAtomicAddSizeT ( &snapshotBytes, size );
+    return psnap;
+}
+
+/*
+ *  POST_FIELD_EVENTS()
+ *
+ *  Queue an event for the subscriptions to one field,
+ *  and note the event tasks that must be woken.
+ */
+static void post_field_events ( const monitor_field *pmf, unsigned postMask,
+    post_wake *pwake )
+{
+    struct evSubscrip *pevent = pmf->first;
+    array_snapshot *psnap = NULL;
+    int snapshotTried = FALSE;
+    unsigned n, i;
+
+    for ( n = pmf->count; n > 0u;
+            n--, pevent = (struct evSubscrip *) pevent->node.next ) {
+        const unsigned mask = postMask & pevent->select;
+        db_field_log *pLog;
+        epicsEventId pendsem;
+
+        if (!mask)
+            continue;
+
+        pLog = db_create_event_log(pevent);
+        if(pLog)
+            pLog->mask = mask;
+
+        /* all subscriptions here are on the same field */
+        if (pLog && pLog->type == dbfl_type_ref && dbEventArraySnapshots) {
+            if (!snapshotTried) {
+                snapshotTried = TRUE;
+                psnap = snapshot_create(pevent->chan);
+            }
+            if (psnap) {
+                epicsAtomicIncrIntT(&psnap->refs);
+                pLog->u.r.field = psnap->data;
+                pLog->u.r.pvt = psnap;
+                pLog->dtor = snapshot_field_log_free;
+                pLog->no_elements = psnap->no_elements;
+            }
+        }
+
+        pLog = dbChannelRunPreChain(pevent->chan, pLog);
+        if (!pLog)
+            continue;
+
+        pendsem = db_queue_event_log(pevent, pLog);
+        if (!pendsem)
+            continue;
+
+        /* remember each event task once, signal when done */
+        for (i = 0u; i < pwake->count && pwake->sems[i] != pendsem; i++)
+            ;
+        if (i == pwake->count) {
+            if (pwake->count < NELEMENTS(pwake->sems))
+                pwake->sems[pwake->count++] = pendsem;
+            else
+                epicsEventSignal(pendsem);
+        }
+    }
+
+    if (psnap)
+        snapshot_release(psnap);
+}
+
+/*
+ *  DB_POST_EVENTS_MANY()
+ *
+ *  NOTE: This assumes that the db scan lock is already applied
+ *
+ */
+int db_post_events_many(
+void                    *pRecord,
+const db_post_field     *pFields,
+unsigned                nFields
+)
 {
     struct dbCommon   * const prec = (struct dbCommon *) pRecord;
-    struct evSubscrip *pevent;
+    struct dbMonitorIndex *pidx;
+    post_wake wake;
+    unsigned allMask = 0u;
+    unsigned first = MONFIELD_NONE, last = MONFIELD_NONE;
+    unsigned i;
 
     if (prec->mlis.count == 0) return DB_EVENT_OK;       /* no monitors set */
 
     LOCKREC (prec);
 
-    for (pevent = (struct evSubscrip *) prec->mlis.node.next;
-        pevent; pevent = (struct evSubscrip *) pevent->node.next){
+    /* the last monitor may have gone since the unlocked test above */
+    pidx = prec->midx;
+    if (!pidx) {
+        UNLOCKREC (prec);
+        return DB_EVENT_OK;
+    }
+    wake.count = 0u;
 
-        /*
-         * Only send event msg if they are waiting on the field which
-         * changed or pval==NULL, and are waiting on matching event
-         */
-        if ( (dbChannelField(pevent->chan) == (void *)pField || pField==NULL) &&
-            (caEventMask & pevent->select)) {
-            db_field_log *pLog = db_create_event_log(pevent);
-            if(pLog)
-                pLog->mask = caEventMask & pevent->select;
-            pLog = dbChannelRunPreChain(pevent->chan, pLog);
-            if (pLog) db_queue_event_log(pevent, pLog);
+    /*
+     * Only send event msg if they are waiting on a field which
+     * changed or pval==NULL, and are waiting on matching event.
+     * Merge the masks of pairs for the same field first.
+     */
+    for (i = 0u; i < nFields; i++) {
+        unsigned pos;
+        monitor_field *pmf;
+
+        if (!pFields[i].pField) {
+            allMask |= pFields[i].mask;
+            continue;
         }
+        pmf = monitor_field_find(pidx, pFields[i].pField, &pos);
+        if (!pmf || !pFields[i].mask)
+            continue;
+        if (!pmf->mask) {
+            pmf->nextPost = MONFIELD_NONE;
+            if (last == MONFIELD_NONE)
+                first = pos;
+            else
+                pidx->fields[last].nextPost = pos;
+            last = pos;
+        }
+        pmf->mask |= pFields[i].mask;
     }
 
+    if (allMask) {
+        for (i = 0u; i < pidx->nfields; i++) {
+            post_field_events(&pidx->fields[i],
+                allMask | pidx->fields[i].mask, &wake);
+            pidx->fields[i].mask = 0u;
+        }
+    }
+    else {
+        for (i = first; i != MONFIELD_NONE; i = pidx->fields[i].nextPost) {
+            post_field_events(&pidx->fields[i], pidx->fields[i].mask, &wake);
+            pidx->fields[i].mask = 0u;
+        }
+    }
+
+    /*
+     * notify the event handlers.  Still under the record lock,
+     * which db_cancel_event() takes before db_close_events()
+     * may destroy the semaphore.
+     */
+    for (i = 0u; i < wake.count; i++)
+        epicsEventSignal(wake.sems[i]);
+
     UNLOCKREC (prec);
     return DB_EVENT_OK;
 
@@ -910,64 +1637,80 @@ void db_post_single_event (dbEventSubscription event)
 
     pLog = db_create_event_log(pevent);
     pLog = dbChannelRunPreChain(pevent->chan, pLog);
-    if(pLog) db_queue_event_log(pevent, pLog);
+    if(pLog) {
+        epicsEventId pendsem = db_queue_event_log(pevent, pLog);
+
+        if (pendsem)
+            epicsEventSignal(pendsem);
+    }
 
     dbScanUnlock (prec);
 }
 
 /*
  * EVENT_READ()
+ *
+ * Only called by event_task, which is the single reader of ev_que
  */
 static int event_read ( struct event_que *ev_que )
 {
     int notifiedRemaining = 0;
-
-    /*
-     * evUser ring buffer must be locked for the multiple
-     * threads writing/reading it
-     */
-    LOCKEVQUE (ev_que);
+    struct evSubscrip *pevent;
 
     /*
      * if in flow control mode drain duplicates and then
      * suspend processing events until flow control
      * mode is over
      */
-    if ( ev_que->evUser->flowCtrlMode && ev_que->nDuplicates == 0u ) {
-        UNLOCKEVQUE (ev_que);
+    if ( ev_que->evUser->flowCtrlMode &&
+            epicsAtomicGetIntT ( &ev_que->nDuplicates ) <= 0 ) {
         return DB_EVENT_OK;
     }
 
-    while ( ev_que->evque[ev_que->getix] != EVENTQEMPTY ) {
-        struct evSubscrip *pevent = ev_que->evque[ev_que->getix];
+    while ( TRUE ) {
         int eventsRemaining;
-        db_field_log *pfl = ev_que->valque[ev_que->getix];
+        db_field_log *pfl;
+
+        pevent = (struct evSubscrip *)
+            epicsAtomicGetPtrT ( &ev_que->evque[ev_que->getix] );
+        if ( pevent == EVENTQEMPTY ) {
+            /*
+             * About to wait; any writer queueing after the full
+             * barrier here must wake us, else we see its entry.
+             */
+            epicsAtomicCmpAndSwapIntT ( &ev_que->idle, FALSE, TRUE );
+            if ( epicsAtomicGetPtrT ( &ev_que->evque[ev_que->getix] )
+                    == EVENTQEMPTY ) {
+                break;
+            }
+            epicsAtomicSetIntT ( &ev_que->idle, FALSE );
+            continue;
+        }
 
         /*
          * Simple type values queued up for reliable interprocess
          * communication. (for other types they get whatever happens
          * to be there upon wakeup)
          */
-
-        event_remove ( ev_que, ev_que->getix, EVENTQEMPTY );
-        ev_que->getix = RNGINC ( ev_que->getix );
-        eventsRemaining = ev_que->evque[ev_que->getix] != EVENTQEMPTY;
+        pfl = event_remove ( ev_que, pevent );
+        eventsRemaining = epicsAtomicGetPtrT (
+            &ev_que->evque[ev_que->getix] ) != EVENTQEMPTY;
 
         /*
          * Next event pointer can be used by event tasks to determine
          * if more events are waiting in the queue
          *
-         * Must remove the lock here so that we don't deadlock if
+         * No lock is held here, so we don't deadlock if
          * this calls dbGetField() and blocks on the record lock,
          * dbPutField() is in progress in another task, it has the
-         * record lock, and it is calling db_post_events() waiting
-         * for the event queue lock (which this thread now has).
+         * record lock, and it is calling db_post_events().
+         *
+         * Full barrier, pairs with the one in db_cancel_event().
          */
+        epicsAtomicCmpAndSwapIntT ( &pevent->callBackInProgress,
+            FALSE, TRUE );
         if ( pevent->user_sub ) {
             EVENTFUNC* user_sub = pevent->user_sub;
-            pevent->callBackInProgress = TRUE;
-
-            UNLOCKEVQUE (ev_que);
 
             /* Run post-event-queue filter chain */
             if (ellCount(&pevent->chan->post_chain)) {
@@ -979,15 +1722,13 @@ static int event_read ( struct event_que *ev_que )
                                 eventsRemaining, pfl );
                 notifiedRemaining = eventsRemaining;
             }
-
-            LOCKEVQUE (ev_que);
-
-            pevent->callBackInProgress = FALSE;
         }
-        /* callback may have called db_cancel_event(), so must check user_sub again */
-        if(!pevent->user_sub && !pevent->npend) {
-            pevent->ev_que->quota -= EVENTENTRIES;
-            freeListFree ( dbevEventSubscriptionFreeList, pevent );
+        epicsAtomicSetIntT ( &pevent->callBackInProgress, FALSE );
+
+        /* callback may have called db_cancel_event(), so drop our
+         * reference last */
+        if ( ! epicsAtomicDecrIntT ( &pevent->refs ) ) {
+            event_free ( pevent );
         }
         db_delete_field_log(pfl);
     }
@@ -997,15 +1738,80 @@ static int event_read ( struct event_que *ev_que )
         errlogPrintf(ERL_WARNING " dbEvent possible queue stall\n");
     }
 
-    UNLOCKEVQUE (ev_que);
-
     return DB_EVENT_OK;
 }
 
+/*
+ * Read the queues of one task, called and returns with evUser->lock held
+ */
+static void event_read_shard ( struct event_user *evUser,
+    const struct event_shard *shard )
+{
+    struct event_que * ev_que;
+
+    for ( ev_que = &evUser->firstque; ev_que; ev_que = ev_que->nextque ) {
+        if ( ev_que->shard != shard ) {
+            continue;
+        }
+        /* unlock during iteration is safe as event_que will not be free'd */
+        epicsMutexUnlock ( evUser->lock );
+        event_read (ev_que);
+        epicsMutexMustLock ( evUser->lock );
+    }
+}
+
+/*
+ * Wake db_cancel_event() callers, called with evUser->lock held
+ */
+static void event_wake_waiters ( struct event_user *evUser )
+{
+    if(ellCount(&evUser->waiters)) {
+        /* hold lock throughout to avoid race between event trigger and destroy */
+        ELLNODE *cur;
+        for(cur = ellFirst(&evUser->waiters); cur; cur = ellNext(cur)) {
+            event_waiter *w = CONTAINER(cur, event_waiter, node);
+            if(w->wake)
+                epicsEventMustTrigger(w->wake);
+        }
+    }
+}
+
+/*
+ * Additional task reading the queues assigned to one shard.
+ * Extra labor is left to event_task.
+ */
+static void event_shard_task (void *pParm)
+{
+    struct event_shard * const shard = (struct event_shard *) pParm;
+    struct event_user * const evUser = shard->evUser;
+    unsigned char shardexit;
+
+    if (evUser->init_func) {
+        (*evUser->init_func)(evUser->init_func_arg);
+    }
+
+    taskwdInsert ( epicsThreadGetIdSelf(), NULL, NULL );
+
+    do {
+        epicsEventMustWait(shard->ppendsem);
+
+        epicsMutexMustLock ( evUser->lock );
+        event_read_shard ( evUser, shard );
+        shardexit = evUser->shardexit;
+
+        shard->pflush_seq++;
+        event_wake_waiters ( evUser );
+
+        epicsMutexUnlock ( evUser->lock );
+
+    } while( ! shardexit );
+
+    taskwdRemove(epicsThreadGetIdSelf());
+}
+
 static void event_task (void *pParm)
 {
     struct event_user * const evUser = (struct event_user *) pParm;
-    struct event_que * ev_que;
     unsigned char pendexit;
 
     /* init hook */
@@ -1042,42 +1848,17 @@ static void event_task (void *pParm)
         }
         evUser->extraLaborBusy = FALSE;
 
-        for ( ev_que = &evUser->firstque; ev_que; ev_que = ev_que->nextque ) {
-            /* unlock during iteration is safe as event_que will not be free'd */
-            epicsMutexUnlock ( evUser->lock );
-            event_read (ev_que);
-            epicsMutexMustLock ( evUser->lock );
-        }
+        event_read_shard ( evUser, NULL );
         pendexit = evUser->pendexit;
 
         evUser->pflush_seq++;
-        if(ellCount(&evUser->waiters)) {
-            /* hold lock throughout to avoid race between event trigger and destroy */
-            ELLNODE *cur;
-            for(cur = ellFirst(&evUser->waiters); cur; cur = ellNext(cur)) {
-                event_waiter *w = CONTAINER(cur, event_waiter, node);
-                if(w->wake)
-                    epicsEventMustTrigger(w->wake);
-            }
-        }
+        event_wake_waiters ( evUser );
 
         epicsMutexUnlock ( evUser->lock );
 
     } while( ! pendexit );
 
-    epicsMutexDestroy(evUser->firstque.writelock);
-
-    {
-        struct event_que    *nextque;
-
-        ev_que = evUser->firstque.nextque;
-        while (ev_que) {
-            nextque = ev_que->nextque;
-            epicsMutexDestroy(ev_que->writelock);
-            freeListFree(dbevEventQueueFreeList, ev_que);
-            ev_que = nextque;
-        }
-    }
+    free_event_ques ( evUser );
 
     taskwdRemove(epicsThreadGetIdSelf());
 
@@ -1102,6 +1883,7 @@ int db_start_events (
 {
      struct event_user * const evUser = (struct event_user *) ctx;
      epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+     unsigned i;
 
      opts.stackSize = epicsThreadGetStackSize(epicsThreadStackMedium);
      opts.priority = osiPriority;
@@ -1130,6 +1912,20 @@ int db_start_events (
          return DB_EVENT_ERROR;
      }
      evUser->pendexit = FALSE;
+     evUser->shardexit = FALSE;
+     for (i = 0u; i + 1u < evUser->nshards; i++) {
+         struct event_shard *shard = &evUser->shards[i];
+         char name[40];
+
+         epicsSnprintf(name, sizeof(name), "%s-%u", taskname, i + 1u);
+         shard->taskid = epicsThreadCreateOpt (
+             name, event_shard_task, (void *)shard, &opts);
+         if (!shard->taskid) {
+             /* db_close_events() stops those already running */
+             epicsMutexUnlock ( evUser->lock );
+             return DB_EVENT_ERROR;
+         }
+     }
      epicsMutexUnlock ( evUser->lock );
      return DB_EVENT_OK;
 }
@@ -1141,7 +1937,14 @@ void db_event_change_priority ( dbEventCtx ctx,
                                         unsigned epicsPriority )
 {
     struct event_user * const evUser = ( struct event_user * ) ctx;
+    unsigned i;
+
     epicsThreadSetPriority ( evUser->taskid, epicsPriority );
+    for ( i = 0u; i + 1u < evUser->nshards; i++ ) {
+        if ( evUser->shards[i].taskid ) {
+            epicsThreadSetPriority ( evUser->shards[i].taskid, epicsPriority );
+        }
+    }
 }
 
 /*
@@ -1155,9 +1958,9 @@ void db_event_flow_ctrl_mode_on (dbEventCtx ctx)
     evUser->flowCtrlMode = TRUE;
     epicsMutexUnlock ( evUser->lock );
     /*
-     * notify the event handler task
+     * notify the event handler tasks
      */
-    epicsEventSignal(evUser->ppendsem);
+    event_user_signal ( evUser );
 }
 
 /*
@@ -1171,9 +1974,9 @@ void db_event_flow_ctrl_mode_off (dbEventCtx ctx)
     evUser->flowCtrlMode = FALSE;
     epicsMutexUnlock ( evUser->lock );
     /*
-     * notify the event handler task
+     * notify the event handler tasks
      */
-    epicsEventSignal (evUser->ppendsem);
+    event_user_signal ( evUser );
 }
 
 /*
@@ -1193,3 +1996,29 @@ int db_available_logs(void)
 {
     return (int) freeListItemsAvail(dbevFieldLogFreeList);
 }
+
+void db_snapshot_usage(size_t *pCount, size_t *pBytes)
+{
+    if (pCount)
+        *pCount = epicsAtomicGetSizeT(&snapshotCount);
+    if (pBytes)
+        *pBytes = epicsAtomicGetSizeT(&snapshotBytes);
+}
+
+void * db_field_log_hold_snapshot(const db_field_log *pfl)
+{
+    array_snapshot *psnap;
+
+    if (!pfl || pfl->type != dbfl_type_ref ||
+            pfl->dtor != snapshot_field_log_free)
+        return NULL;
+    psnap = (array_snapshot *) pfl->u.r.pvt;
+    epicsAtomicIncrIntT(&psnap->refs);
+    return psnap;
+}
+
+void db_snapshot_release(void *snapshot)
+{
+    if (snapshot)
+        snapshot_release((array_snapshot *) snapshot);
+}
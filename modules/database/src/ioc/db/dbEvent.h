@@ -20,6 +20,8 @@
 #ifndef INCLdbEventh
 #define INCLdbEventh
 
+#include <stddef.h>
+
 #include "epicsThread.h"
 
 #include "dbCoreAPI.h"
@@ -39,6 +41,33 @@ DBCORE_API int dbel (
 DBCORE_API int db_post_events (
     void *pRecord, void *pField, unsigned caEventMask );
 
+/* One (field, mask) pair for db_post_events_many() */
+typedef struct db_post_field {
+    void *pField;
+    unsigned mask;
+} db_post_field;
+
+/* Append a pair to a db_post_field array, counting in N */
+#define DB_POST_FIELD(LIST, N, FIELD, MASK) \
+    ((LIST)[N].pField = (void *)(FIELD), (LIST)[(N)++].mask = (MASK))
+
+/* Post events for several fields of one record, walking its monitor
+ * list once and waking each event task at most once.  A subscription
+ * matching more than one pair gets a single event with the masks OR'd.
+ * Like db_post_events() the caller must hold the record's scan lock.
+ */
+DBCORE_API int db_post_events_many (
+    void *pRecord, const db_post_field *pFields, unsigned nFields );
+
+/* Default event queue geometry, read by db_init_events() */
+DBCORE_API extern int dbEventSubscriptionsPerQueue;
+DBCORE_API extern int dbEventEntriesPerSubscription;
+/* Non-zero to share one copy of array data between monitors, see
+ * db_post_events_many() */
+DBCORE_API extern int dbEventArraySnapshots;
+/* Default number of tasks reading the queues of each event context */
+DBCORE_API extern int dbEventShards;
+
 typedef void * dbEventCtx;
 
 typedef void EXTRALABORFUNC (void *extralabor_arg);
@@ -54,6 +83,12 @@ DBCORE_API int db_add_extra_labor_event (
 DBCORE_API void db_flush_extra_labor_event (dbEventCtx);
 DBCORE_API int db_post_extra_labor (dbEventCtx ctx);
 DBCORE_API void db_event_change_priority ( dbEventCtx ctx, unsigned epicsPriority );
+DBCORE_API int db_event_queue_geometry ( dbEventCtx ctx,
+    unsigned nSubscriptions, unsigned nEntries );
+/* Spread the subscriptions of a context over nShards tasks, before
+ * db_start_events() and the first db_add_event() */
+DBCORE_API int db_event_shards ( dbEventCtx ctx, unsigned nShards );
+DBCORE_API unsigned db_event_shard_count ( dbEventCtx ctx );
 
 #ifdef EPICS_PRIVATE_API
 DBCORE_API void db_cleanup_events(void);
@@ -67,6 +102,9 @@ typedef void * dbEventSubscription;
 DBCORE_API dbEventSubscription db_add_event (
     dbEventCtx ctx, struct dbChannel *chan,
     EVENTFUNC *user_sub, void *user_arg, unsigned select);
+DBCORE_API dbEventSubscription db_add_event_depth (
+    dbEventCtx ctx, struct dbChannel *chan,
+    EVENTFUNC *user_sub, void *user_arg, unsigned select, unsigned depth);
 DBCORE_API void db_cancel_event (dbEventSubscription es);
 DBCORE_API void db_post_single_event (dbEventSubscription es);
 DBCORE_API void db_event_enable (dbEventSubscription es);
@@ -76,6 +114,13 @@ DBCORE_API struct db_field_log* db_create_event_log (struct evSubscrip *pevent);
 DBCORE_API struct db_field_log* db_create_read_log (struct dbChannel *chan);
 DBCORE_API void db_delete_field_log (struct db_field_log *pfl);
 DBCORE_API int db_available_logs(void);
+/* Number and total data size of the array snapshots held by field logs */
+DBCORE_API void db_snapshot_usage(size_t *pCount, size_t *pBytes);
+/* Keep the array snapshot referenced by a field log, if any, after the
+ * log is deleted.  Returns NULL when pfl does not share a snapshot.  The
+ * data stays at pfl->u.r.field until db_snapshot_release(). */
+DBCORE_API void * db_field_log_hold_snapshot(const struct db_field_log *pfl);
+DBCORE_API void db_snapshot_release(void *snapshot);
 
 #define DB_EVENT_OK 0
 #define DB_EVENT_ERROR (-1)
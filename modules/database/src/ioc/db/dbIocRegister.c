@@ -446,6 +446,55 @@ static const iocshFuncDef scanpplFuncDef = {"scanppl",1,scanpplArgs,
 static void scanpplCallFunc(const iocshArgBuf *args)
 { scanppl(args[0].dval);}
 
+/* scanParallelThreads */
+static const iocshArg scanParallelThreadsArg0 = { "no of threads", iocshArgInt};
+static const iocshArg scanParallelThreadsArg1 = { "scan rate", iocshArgString};
+static const iocshArg * const scanParallelThreadsArgs[2] =
+    {&scanParallelThreadsArg0,&scanParallelThreadsArg1};
+static const iocshFuncDef scanParallelThreadsFuncDef = {"scanParallelThreads",2,scanParallelThreadsArgs,
+                                                        "Configure threads to scan a periodic scan list in parallel\n"
+                                                        "before iocInit, dividing the list by lock set.\n"
+                                                        "scan rate may be omitted or \"*\" to act on all rates\n"
+                                                        "or a SCAN choice such as \".1 second\".\n"
+                                                        "no of threads 0 means one per CPU, negative values count\n"
+                                                        "down from that, and 1 scans serially.\n"};
+static void scanParallelThreadsCallFunc(const iocshArgBuf *args)
+{
+    scanParallelThreads(args[0].ival, args[1].sval);
+}
+
+/* scanSpreadSlices */
+static const iocshArg scanSpreadSlicesArg0 = { "no of slices", iocshArgInt};
+static const iocshArg scanSpreadSlicesArg1 = { "scan rate", iocshArgString};
+static const iocshArg * const scanSpreadSlicesArgs[2] =
+    {&scanSpreadSlicesArg0,&scanSpreadSlicesArg1};
+static const iocshFuncDef scanSpreadSlicesFuncDef = {"scanSpreadSlices",2,scanSpreadSlicesArgs,
+                                                     "Configure a periodic scan list before iocInit to process\n"
+                                                     "its records in slices spread over the period, instead\n"
+                                                     "of all at once. Records stay in PHAS order.\n"
+                                                     "scan rate may be omitted or \"*\" to act on all rates\n"
+                                                     "or a SCAN choice such as \"1 second\".\n"
+                                                     "no of slices 1 processes each pass at once.\n"};
+static void scanSpreadSlicesCallFunc(const iocshArgBuf *args)
+{
+    scanSpreadSlices(args[0].ival, args[1].sval);
+}
+
+/* scanHistShow */
+static const iocshArg scanHistShowArg0 = { "rate",iocshArgDouble};
+static const iocshArg scanHistShowArg1 = { "reset",iocshArgInt};
+static const iocshArg * const scanHistShowArgs[2] =
+    {&scanHistShowArg0,&scanHistShowArg1};
+static const iocshFuncDef scanHistShowFuncDef = {"scanHistShow",2,scanHistShowArgs,
+                                                 "Show histograms of the start jitter and processing\n"
+                                                 "time of periodic scans, then reset the statistics if\n"
+                                                 "reset is non-zero.\n"
+                                                 "If rate == 0.0, all periods are shown.\n"};
+static void scanHistShowCallFunc(const iocshArgBuf *args)
+{
+    scanHistShow(args[0].dval, args[1].ival);
+}
+
 /* scanpel */
 static const iocshArg scanpelArg0 = { "event name",iocshArgString};
 static const iocshArg * const scanpelArgs[1] = {&scanpelArg0};
@@ -610,6 +659,9 @@ void dbIocRegister(void)
     iocshRegister(&scanOnceSetQueueSizeFuncDef,scanOnceSetQueueSizeCallFunc);
     iocshRegister(&scanOnceQueueShowFuncDef,scanOnceQueueShowCallFunc);
     iocshRegister(&scanpplFuncDef,scanpplCallFunc);
+    iocshRegister(&scanParallelThreadsFuncDef,scanParallelThreadsCallFunc);
+    iocshRegister(&scanSpreadSlicesFuncDef,scanSpreadSlicesCallFunc);
+    iocshRegister(&scanHistShowFuncDef,scanHistShowCallFunc);
     iocshRegister(&scanpelFuncDef,scanpelCallFunc);
     iocshRegister(&postEventFuncDef,postEventCallFunc);
     iocshRegister(&scanpiolFuncDef,scanpiolCallFunc);
@@ -172,6 +172,16 @@ lockSet* dbLockGetRef(lockRecord *lr)
     return ls;
 }
 
+size_t dbLockRecomputeCount(void)
+{
+#ifndef LOCKSET_NOCNT
+    return epicsAtomicGetSizeT(&recomputeCnt);
+#else
+    static size_t cnt;
+    return epicsAtomicIncrSizeT(&cnt); /* Always changed */
+#endif
+}
+
 unsigned long dbLockGetLockId(dbCommon *precord)
 {
     unsigned long id=0;
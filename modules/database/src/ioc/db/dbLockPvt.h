@@ -101,6 +101,9 @@ DBCORE_API void dbLockDecRef(lockSet *ls);
  * optimization used when dbLocker on the stack.
  * nrecs must be <=DBLOCKER_NALLOC.
  */
+/* Changes whenever any record moves to a different lockSet */
+size_t dbLockRecomputeCount(void);
+
 void dbLockerPrepare(struct dbLocker *locker,
                      struct dbCommon * const *precs,
                      size_t nrecs);
@@ -17,6 +17,7 @@
 
 #include <stddef.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <limits.h>
 #include <math.h>
@@ -27,6 +28,7 @@
 #include "ellLib.h"
 #include "epicsAtomic.h"
 #include "epicsEvent.h"
+#include "epicsMath.h"
 #include "epicsMutex.h"
 #include "epicsPrint.h"
 #include "epicsRingBytes.h"
@@ -35,6 +37,7 @@
 #include "epicsString.h"
 #include "epicsThread.h"
 #include "epicsTime.h"
+#include "epicsTimer.h"
 #include "taskwd.h"
 
 #include "callback.h"
@@ -44,6 +47,7 @@
 #include "dbCommon.h"
 #include "dbFldTypes.h"
 #include "dbLock.h"
+#include "dbLockPvt.h"
 #include "dbScan.h"
 #include "dbStaticLib.h"
 #include "devSup.h"
@@ -70,14 +74,26 @@ static void *exitOnce;
 
 
 /* All other scan types */
+
+/* The records on a scan list are kept in an array sorted by PHAS. While a
+ * scan is using the array it is replaced rather than changed, so scans
+ * iterate over it without taking the list lock for each record.
+ */
+typedef struct scan_array {
+    int                 refs;       /* Scans using it, plus one while current */
+    int                 count;
+    int                 size;
+    struct dbCommon     *precord[1];    /* actually size */
+} scan_array;
+
 typedef struct scan_list{
     epicsMutexId        lock;
-    ELLLIST             list;
-    short               modified;/*has list been modified?*/
+    scan_array          *records;   /* Current array, guarded by lock */
+    int                 count;      /* Records on the list, use atomic */
+    size_t              epoch;      /* Changes to the list, guarded by lock */
 } scan_list;
 /*scan_elements are allocated and the address stored in dbCommon.spvt*/
 typedef struct scan_element{
-    ELLNODE             node;
     scan_list           *pscan_list;
     struct dbCommon     *precord;
 } scan_element;
@@ -87,6 +103,28 @@ typedef struct scan_element{
 
 #define OVERRUN_REPORT_DELAY 10.0   /* Time between initial reports */
 #define OVERRUN_REPORT_MAX 3600.0   /* Maximum time between reports */
+
+/* A parallel scan divides its list into groups of records that share a
+ * lock set. The records in a group are in PHAS order and are processed in
+ * turn by one thread, different groups are processed concurrently.
+ */
+typedef struct scan_key {
+    unsigned long       lockId;
+    int                 index;      /* Position in the scan list */
+    struct dbCommon     *precord;
+} scan_key;
+
+typedef struct scan_group {
+    int                 first;      /* Index into keys */
+    int                 count;
+} scan_group;
+
+typedef struct scan_worker {
+    struct periodic_scan_list *ppsl;
+    epicsThreadId       tid;
+    epicsEventId        go;
+} scan_worker;
+
 typedef struct periodic_scan_list {
     scan_list           scan_list;
     double              period;
@@ -94,12 +132,56 @@ typedef struct periodic_scan_list {
     unsigned long       overruns;
     volatile enum ctl   scanCtl;
     epicsEventId        loopEvent;
+    /* Pass statistics, guarded by scan_list.lock */
+    unsigned long       passes;
+    int                 nRecords;
+    double              timeLast;
+    double              timeMin;
+    double              timeMax;
+    double              timeTotal;
+    unsigned long       starts;     /* Passes or slices started */
+    double              jitterLast;
+    double              jitterMax;
+    double              jitterTotal;
+    unsigned long       jitterHist[SCAN_HIST_BINS];
+    unsigned long       timeHist[SCAN_HIST_BINS];
+    /* Passes spread over the period, only when nSlices > 1 */
+    int                 nSlices;
+    /* Parallel scanning, only when nWorkers > 0 */
+    int                 nWorkers;
+    scan_worker         *workers;
+    epicsEventId        doneEvent;
+    int                 pending;    /* Workers still scanning */
+    int                 nextGroup;  /* Next group to be claimed */
+    size_t              recomp;     /* Lock set changes when divided */
+    size_t              epoch;      /* List changes when divided */
+    int                 nKeys;
+    int                 maxKeys;
+    scan_key            *keys;
+    int                 nGroups;
+    scan_group          *groups;
 } periodic_scan_list;
 
 static int nPeriodic = 0;
 static periodic_scan_list **papPeriodic; /* pointer to array of pointers */
 static epicsThreadId *periodicTaskId;    /* array of thread ids */
 
+/* Threads for each periodic scan rate, set by scanParallelThreads() */
+static int parallelAll = 1;
+static int *parallelRate;   /* Indexed by menuScan choice, 0 = use All */
+static int nParallelRate;
+
+/* Time slices for each periodic scan rate, set by scanSpreadSlices() */
+static int spreadAll = 1;
+static int *spreadRate;     /* Indexed by menuScan choice, 0 = use All */
+static int nSpreadRate;
+
+/* Upper limits of the histogram bins */
+static const double histUpper[SCAN_HIST_BINS - 1] = {
+    10e-6, 20e-6, 50e-6, 100e-6, 200e-6, 500e-6,
+    1e-3, 2e-3, 5e-3, 10e-3, 20e-3, 50e-3, 100e-3, 200e-3, 500e-3, 1.0
+};
+
 
 static char *priorityName[NUM_CALLBACK_PRIORITIES] = {
     "Low", "Medium", "High"
@@ -122,6 +204,15 @@ static epicsMutexId event_lock;
 typedef struct io_scan_list {
     epicsCallback callback;
     scan_list scan_list;
+    int pending;            /* Pass queued but not started, use atomic */
+    int held;               /* Pass waiting for the batch timer */
+    epicsTimerId timer;
+    epicsUInt64 lastStart;  /* epicsMonotonicGet() at the last pass */
+    size_t requested;       /* Counters, use atomic */
+    size_t coalesced;
+    size_t passes;
+    size_t deferred;
+    size_t overflows;
 } io_scan_list;
 
 typedef struct ioscan_head {
@@ -129,10 +220,12 @@ typedef struct ioscan_head {
     struct io_scan_list iosl[NUM_CALLBACK_PRIORITIES];
     io_scan_complete cb;
     void *arg;
+    double batch;           /* Minimum seconds between passes */
 } ioscan_head;
 
 static ioscan_head *pioscan_list = NULL;
 static epicsMutexId ioscan_lock;
+static epicsTimerQueueId ioscanTimerQueue;
 
 /* Private routines */
 static void onceTask(void *);
@@ -144,9 +237,21 @@ static void spawnPeriodic(int ind);
 static void eventCallback(epicsCallback *pcallback);
 static void ioscanInit(void);
 static void ioscanCallback(epicsCallback *pcallback);
+static void ioscanTimer(void *arg);
+static unsigned int ioscanQueue(io_scan_list *piosl);
 static void ioscanDestroy(void);
 static void printList(scan_list *psl, char *message);
-static void scanList(scan_list *psl);
+static int scanList(scan_list *psl);
+static int scanRecords(scan_list *psl, const scan_array *parr,
+    int first, int last);
+static scan_array * getRecords(scan_list *psl, size_t *pepoch);
+static void releaseRecords(scan_array *parr);
+static void freeList(scan_list *psl);
+static int scanParallel(periodic_scan_list *ppsl);
+static int scanSpread(periodic_scan_list *ppsl, const epicsTimeStamp *pstart,
+    double *pbusy);
+static int histBin(double seconds);
+static void noteStart(periodic_scan_list *ppsl, double jitter);
 static void buildScanLists(void);
 static void addToList(struct dbCommon *precord, scan_list *psl);
 static void deleteFromList(struct dbCommon *precord, scan_list *psl);
@@ -376,10 +481,18 @@ double scanPeriod(int scan) {
     return ppsl ? ppsl->period : 0.0;
 }
 
+/* Where to append after epicsSnprintf() returned n into a size buffer */
+static int scanMessageEnd(int n, size_t size)
+{
+    if (n < 0)
+        return 0;
+    return (size_t) n < size ? n : (int) size - 1;
+}
+
 int scanppl(double period)      /* print periodic scan list(s) */
 {
     dbMenu *pmenu = dbFindMenu(pdbbase, "menuScan");
-    char message[80];
+    char message[256];
     int i;
 
     if (!pmenu || !papPeriodic) {
@@ -401,13 +514,234 @@ int scanppl(double period)      /* print periodic scan list(s) */
             (fabs(period - ppsl->period) > 0.05))
             continue;
 
-        sprintf(message, "Records with SCAN = '%s' (%lu over-runs):",
-            ppsl->name, ppsl->overruns);
+        epicsMutexMustLock(ppsl->scan_list.lock);
+        if (!ppsl->passes) {
+            epicsSnprintf(message, sizeof(message),
+                "Records with SCAN = '%s' (%lu over-runs):",
+                ppsl->name, ppsl->overruns);
+        }
+        else {
+            int n = epicsSnprintf(message, sizeof(message),
+                "Records with SCAN = '%s' "
+                "(%lu over-runs):\n"
+                "    %lu passes of %d records, %.3f ms (%.3f .. %.3f, "
+                "mean %.3f)", ppsl->name, ppsl->overruns,
+                ppsl->passes, ppsl->nRecords, ppsl->timeLast * 1e3,
+                ppsl->timeMin * 1e3, ppsl->timeMax * 1e3,
+                ppsl->timeTotal * 1e3 / ppsl->passes);
+
+            n = scanMessageEnd(n, sizeof(message));
+            if (ppsl->starts) {
+                n += epicsSnprintf(message + n, sizeof(message) - n,
+                    "\n    start jitter %.3f ms "
+                    "(max %.3f, mean %.3f)", ppsl->jitterLast * 1e3,
+                    ppsl->jitterMax * 1e3,
+                    ppsl->jitterTotal * 1e3 / ppsl->starts);
+                n = scanMessageEnd(n, sizeof(message));
+            }
+            if (ppsl->nWorkers)
+                epicsSnprintf(message + n, sizeof(message) - n,
+                    "\n    %d lock sets on %d threads",
+                    ppsl->nGroups, ppsl->nWorkers + 1);
+            else if (ppsl->nSlices > 1)
+                epicsSnprintf(message + n, sizeof(message) - n,
+                    "\n    spread over %d slices", ppsl->nSlices);
+        }
+        epicsMutexUnlock(ppsl->scan_list.lock);
         printList(&ppsl->scan_list, message);
     }
     return 0;
 }
 
+int scanPeriodicStatus(int scan, const int reset, scanPeriodicStats *result)
+{
+    periodic_scan_list *ppsl;
+
+    scan -= SCAN_1ST_PERIODIC;
+    if (!papPeriodic || scan < 0 || scan >= nPeriodic ||
+        !(ppsl = papPeriodic[scan]))
+        return -1;
+
+    epicsMutexMustLock(ppsl->scan_list.lock);
+    if (result) {
+        result->period = ppsl->period;
+        result->overruns = ppsl->overruns;
+        result->passes = ppsl->passes;
+        result->nRecords = ppsl->nRecords;
+        result->timeLast = ppsl->timeLast;
+        result->timeMin = ppsl->timeMin;
+        result->timeMax = ppsl->timeMax;
+        result->timeMean = ppsl->passes ?
+            ppsl->timeTotal / ppsl->passes : 0.0;
+        result->nLockSets = ppsl->nWorkers ? ppsl->nGroups : 0;
+        result->nThreads = ppsl->nWorkers + 1;
+        result->nSlices = ppsl->nSlices;
+        result->jitterLast = ppsl->jitterLast;
+        result->jitterMax = ppsl->jitterMax;
+        result->jitterMean = ppsl->starts ?
+            ppsl->jitterTotal / ppsl->starts : 0.0;
+    }
+    if (reset) {
+        ppsl->passes = 0;
+        ppsl->timeMin = ppsl->timeMax = ppsl->timeTotal = 0.0;
+        ppsl->starts = 0;
+        ppsl->jitterMax = ppsl->jitterTotal = 0.0;
+        memset(ppsl->jitterHist, 0, sizeof(ppsl->jitterHist));
+        memset(ppsl->timeHist, 0, sizeof(ppsl->timeHist));
+    }
+    epicsMutexUnlock(ppsl->scan_list.lock);
+    return result ? 0 : -2;
+}
+
+int scanPeriodicHistogram(int scan, scanPeriodicHist *result)
+{
+    periodic_scan_list *ppsl;
+    int i;
+
+    scan -= SCAN_1ST_PERIODIC;
+    if (!papPeriodic || scan < 0 || scan >= nPeriodic ||
+        !(ppsl = papPeriodic[scan]))
+        return -1;
+    if (!result)
+        return -2;
+
+    for (i = 0; i < SCAN_HIST_BINS - 1; i++)
+        result->upper[i] = histUpper[i];
+    result->upper[i] = epicsINF;
+
+    epicsMutexMustLock(ppsl->scan_list.lock);
+    memcpy(result->jitter, ppsl->jitterHist, sizeof(result->jitter));
+    memcpy(result->time, ppsl->timeHist, sizeof(result->time));
+    epicsMutexUnlock(ppsl->scan_list.lock);
+    return 0;
+}
+
+static void printHist(const char *title, const unsigned long *counts)
+{
+    unsigned long total = 0, max = 0;
+    int i, first = -1, last = -1;
+
+    for (i = 0; i < SCAN_HIST_BINS; i++) {
+        total += counts[i];
+        if (counts[i] > max)
+            max = counts[i];
+        if (counts[i]) {
+            if (first < 0)
+                first = i;
+            last = i;
+        }
+    }
+    printf("    %s, %lu samples\n", title, total);
+    for (i = first; i >= 0 && i <= last; i++) {
+        char range[32];
+        int bar = (int)(40.0 * counts[i] / max + 0.5);
+
+        if (i < SCAN_HIST_BINS - 1)
+            sprintf(range, "< %g ms", histUpper[i] * 1e3);
+        else
+            sprintf(range, ">= %g ms", histUpper[i - 1] * 1e3);
+        printf("    %12s %10lu %.*s\n", range, counts[i], bar,
+            "########################################");
+    }
+}
+
+int scanHistShow(double period, int reset)
+{
+    int i;
+
+    if (!papPeriodic) {
+        printf("scanHistShow: dbScan subsystem not initialized\n");
+        return -1;
+    }
+
+    for (i = 0; i < nPeriodic; i++) {
+        periodic_scan_list *ppsl = papPeriodic[i];
+        scanPeriodicHist hist;
+
+        if (!ppsl)
+            continue;
+        if (period > 0.0 &&
+            (fabs(period - ppsl->period) > 0.05))
+            continue;
+
+        scanPeriodicHistogram(i + SCAN_1ST_PERIODIC, &hist);
+        printf("SCAN = '%s':\n", ppsl->name);
+        printHist(ppsl->nSlices > 1 ? "Start jitter of slices" :
+            "Start jitter of passes", hist.jitter);
+        printHist("Processing time of passes", hist.time);
+        if (reset)
+            scanPeriodicStatus(i + SCAN_1ST_PERIODIC, 1, NULL);
+    }
+    return 0;
+}
+
+/* Set an option for all periodic rates, or one rate */
+static int setRateOption(const char *cmd, int count, const char *rate,
+    int *pall, int **prate, int *pnrate)
+{
+    dbMenu *pmenu;
+    int i;
+
+    if (papPeriodic) {
+        fprintf(stderr, "Scan system already initialized\n");
+        return -1;
+    }
+
+    if (!rate || *rate == 0 || strcmp(rate, "*") == 0) {
+        *pall = count;
+        free(*prate);
+        *prate = NULL;
+        *pnrate = 0;
+        return 0;
+    }
+
+    if (!pdbbase) {
+        fprintf(stderr, "%s: pdbbase not set\n", cmd);
+        return -1;
+    }
+    pmenu = dbFindMenu(pdbbase, "menuScan");
+    if (!pmenu) {
+        fprintf(stderr, "%s: menuScan not present\n", cmd);
+        return -1;
+    }
+
+    for (i = SCAN_1ST_PERIODIC; i < pmenu->nChoice; i++) {
+        if (epicsStrCaseCmp(rate, pmenu->papChoiceValue[i]) == 0)
+            goto found;
+    }
+    fprintf(stderr, "%s: Unknown scan rate \"%s\"\n", cmd, rate);
+    return -1;
+
+found:
+    if (*pnrate != pmenu->nChoice) {
+        free(*prate);
+        *prate = dbCalloc(pmenu->nChoice, sizeof(int));
+        *pnrate = pmenu->nChoice;
+    }
+    (*prate)[i] = count;
+    return 0;
+}
+
+int scanParallelThreads(int count, const char *rate)
+{
+    if (count < 0)
+        count = epicsThreadGetCPUs() + count;
+    else if (count == 0)
+        count = epicsThreadGetCPUs();
+    if (count < 1) count = 1;
+
+    return setRateOption("scanParallelThreads", count, rate,
+        &parallelAll, &parallelRate, &nParallelRate);
+}
+
+int scanSpreadSlices(int count, const char *rate)
+{
+    if (count < 1) count = 1;
+
+    return setRateOption("scanSpreadSlices", count, rate,
+        &spreadAll, &spreadRate, &nSpreadRate);
+}
+
 int scanpel(const char* eventname)   /* print event list */
 {
     char message[80];
@@ -418,7 +752,8 @@ int scanpel(const char* eventname)   /* print event list */
         if (!eventname || epicsStrGlobMatch(pel->eventname, eventname)) {
             printf("Event \"%s\"\n", pel->eventname);
             for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-                if (ellCount(&pel->scan_list[prio].list) == 0) continue;
+                if (epicsAtomicGetIntT(&pel->scan_list[prio].count) == 0)
+                    continue;
                 sprintf(message, " Priority %s", priorityName[prio]);
                 printList(&pel->scan_list[prio], message);
             }
@@ -445,7 +780,18 @@ int scanpiol(void)                  /* print pioscan_list */
             sprintf(message, "IO Event %p: Priority %s",
                 piosh, priorityName[prio]);
             printList(&piosl->scan_list, message);
+            if (epicsAtomicGetIntT(&piosl->scan_list.count) > 0)
+                printf("    requested %lu, coalesced %lu, passes %lu, "
+                    "deferred %lu, overflows %lu\n",
+                    (unsigned long) epicsAtomicGetSizeT(&piosl->requested),
+                    (unsigned long) epicsAtomicGetSizeT(&piosl->coalesced),
+                    (unsigned long) epicsAtomicGetSizeT(&piosl->passes),
+                    (unsigned long) epicsAtomicGetSizeT(&piosl->deferred),
+                    (unsigned long) epicsAtomicGetSizeT(&piosl->overflows));
         }
+        if (piosh->batch > 0.0)
+            printf("IO Event %p: Passes at most every %g seconds\n",
+                piosh, piosh->batch);
         piosh = piosh->next;
     }
     epicsMutexUnlock(ioscan_lock);
@@ -521,7 +867,6 @@ event_list *eventNameToHandle(const char *eventname)
             callbackSetPriority(prio, &pel->callback[prio]);
             callbackSetCallback(eventCallback, &pel->callback[prio]);
             pel->scan_list[prio].lock = epicsMutexMustCreate();
-            ellInit(&pel->scan_list[prio].list);
         }
         pel->next=pevent_list[0];
         pevent_list[0]=pel;
@@ -538,7 +883,7 @@ void postEvent(event_list *pel)
     if (scanCtl != ctlRun) return;
     if (!pel) return;
     for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-        if (ellCount(&pel->scan_list[prio].list) >0)
+        if (epicsAtomicGetIntT(&pel->scan_list[prio].count) > 0)
             callbackRequest(&pel->callback[prio]);
     }
 }
@@ -576,12 +921,20 @@ static void ioscanDestroy(void)
         int prio;
 
         for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
-            epicsMutexDestroy(piosh->iosl[prio].scan_list.lock);
-            ellFree(&piosh->iosl[prio].scan_list.list);
+            io_scan_list *piosl = &piosh->iosl[prio];
+
+            if (piosl->timer)
+                epicsTimerQueueDestroyTimer(ioscanTimerQueue, piosl->timer);
+            freeList(&piosl->scan_list);
+            epicsMutexDestroy(piosl->scan_list.lock);
         }
         free(piosh);
         piosh = pnext;
     }
+    if (ioscanTimerQueue) {
+        epicsTimerQueueRelease(ioscanTimerQueue);
+        ioscanTimerQueue = NULL;
+    }
 }
 
 void scanIoInit(IOSCANPVT *pioscanpvt)
@@ -596,7 +949,6 @@ void scanIoInit(IOSCANPVT *pioscanpvt)
         callbackSetCallback(ioscanCallback, &piosl->callback);
         callbackSetPriority(prio, &piosl->callback);
         callbackSetUser(piosh, &piosl->callback);
-        ellInit(&piosl->scan_list.list);
         piosl->scan_list.lock = epicsMutexMustCreate();
     }
     epicsMutexMustLock(ioscan_lock);
@@ -606,8 +958,25 @@ void scanIoInit(IOSCANPVT *pioscanpvt)
     *pioscanpvt = piosh;
 }
 
-/* Return a bit mask indicating each priority level
- * in which a callback request was successfully queued.
+/* Queue a pass unless one is already pending, returns 0 on overflow */
+static unsigned int ioscanQueue(io_scan_list *piosl)
+{
+    epicsAtomicIncrSizeT(&piosl->requested);
+    if (epicsAtomicCmpAndSwapIntT(&piosl->pending, 0, 1) != 0) {
+        /* The pass has not started yet, so it will see this request too */
+        epicsAtomicIncrSizeT(&piosl->coalesced);
+        return 1;
+    }
+    if (callbackRequest(&piosl->callback)) {
+        epicsAtomicSetIntT(&piosl->pending, 0);
+        epicsAtomicIncrSizeT(&piosl->overflows);
+        return 0;
+    }
+    return 1;
+}
+
+/* Return a bit mask indicating each priority level in which a
+ * scan pass was queued, or was already queued and not yet started.
  */
 unsigned int scanIoRequest(IOSCANPVT piosh)
 {
@@ -620,8 +989,8 @@ unsigned int scanIoRequest(IOSCANPVT piosh)
     for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
         io_scan_list *piosl = &piosh->iosl[prio];
 
-        if (ellCount(&piosl->scan_list.list) > 0)
-            if (!callbackRequest(&piosl->callback))
+        if (epicsAtomicGetIntT(&piosl->scan_list.count) > 0)
+            if (ioscanQueue(piosl))
                 queued |= 1 << prio;
     }
 
@@ -639,9 +1008,11 @@ unsigned int scanIoImmediate(IOSCANPVT piosh, int prio)
 
     piosl = &piosh->iosl[prio];
 
-    if (ellCount(&piosl->scan_list.list) == 0)
+    if (epicsAtomicGetIntT(&piosl->scan_list.count) == 0)
         return 0;
 
+    epicsAtomicIncrSizeT(&piosl->requested);
+    epicsAtomicIncrSizeT(&piosl->passes);
     scanList(&piosl->scan_list);
 
     if (piosh->cb)
@@ -657,6 +1028,56 @@ void scanIoSetComplete(IOSCANPVT piosh, io_scan_complete cb, void *arg)
     piosh->arg = arg;
 }
 
+/* May not be called while a scan request is queued or running */
+void scanIoSetBatch(IOSCANPVT piosh, double delay)
+{
+    int prio;
+
+    if (!(delay > 0.0))
+        delay = 0.0;
+
+    epicsMutexMustLock(ioscan_lock);
+    if (delay > 0.0 && !ioscanTimerQueue)
+        ioscanTimerQueue = epicsTimerQueueAllocate(1,
+            epicsThreadPriorityScanHigh);
+    for (prio = 0; prio < NUM_CALLBACK_PRIORITIES; prio++) {
+        io_scan_list *piosl = &piosh->iosl[prio];
+
+        if (delay > 0.0 && !piosl->timer)
+            piosl->timer = epicsTimerQueueCreateTimer(ioscanTimerQueue,
+                ioscanTimer, piosl);
+    }
+    piosh->batch = delay;
+    epicsMutexUnlock(ioscan_lock);
+}
+
+int scanIoStatus(IOSCANPVT piosh, int prio, const int reset,
+    scanIoStats *result)
+{
+    io_scan_list *piosl;
+
+    if (prio < 0 || prio >= NUM_CALLBACK_PRIORITIES)
+        return -1;
+
+    piosl = &piosh->iosl[prio];
+    if (result) {
+        result->requested = epicsAtomicGetSizeT(&piosl->requested);
+        result->coalesced = epicsAtomicGetSizeT(&piosl->coalesced);
+        result->passes = epicsAtomicGetSizeT(&piosl->passes);
+        result->deferred = epicsAtomicGetSizeT(&piosl->deferred);
+        result->overflows = epicsAtomicGetSizeT(&piosl->overflows);
+        result->nRecords = epicsAtomicGetIntT(&piosl->scan_list.count);
+    }
+    if (reset) {
+        epicsAtomicSetSizeT(&piosl->requested, 0);
+        epicsAtomicSetSizeT(&piosl->coalesced, 0);
+        epicsAtomicSetSizeT(&piosl->passes, 0);
+        epicsAtomicSetSizeT(&piosl->deferred, 0);
+        epicsAtomicSetSizeT(&piosl->overflows, 0);
+    }
+    return 0;
+}
+
 int scanOnce(struct dbCommon *precord) {
     return scanOnceCallback(precord, NULL, NULL);
 }
@@ -789,6 +1210,7 @@ static void periodicTask(void *arg)
     double over_min = 0.0;
     double over_max = 0.0;
     const double penalty = (ppsl->period >= 2) ? 1 : (ppsl->period / 2);
+    int i;
 
     taskwdInsert(0, NULL, NULL);
     epicsEventSignal(startStopEvent);
@@ -800,8 +1222,34 @@ static void periodicTask(void *arg)
         double delay;
         epicsTimeStamp now;
 
-        if (ppsl->scanCtl == ctlRun)
-            scanList(&ppsl->scan_list);
+        if (ppsl->scanCtl == ctlRun) {
+            double elapsed;
+            int nRecords;
+
+            if (ppsl->nSlices > 1) {
+                nRecords = scanSpread(ppsl, &next, &elapsed);
+            }
+            else {
+                epicsUInt64 start = epicsMonotonicGet();
+
+                epicsTimeGetMonotonic(&now);
+                noteStart(ppsl, epicsTimeDiffInSeconds(&now, &next));
+                nRecords = ppsl->nWorkers ? scanParallel(ppsl) :
+                    scanList(&ppsl->scan_list);
+                elapsed = (epicsMonotonicGet() - start) * 1e-9;
+            }
+
+            epicsMutexMustLock(ppsl->scan_list.lock);
+            if (!ppsl->passes++ || elapsed < ppsl->timeMin)
+                ppsl->timeMin = elapsed;
+            if (elapsed > ppsl->timeMax)
+                ppsl->timeMax = elapsed;
+            ppsl->timeLast = elapsed;
+            ppsl->timeTotal += elapsed;
+            ppsl->timeHist[histBin(elapsed)]++;
+            ppsl->nRecords = nRecords;
+            epicsMutexUnlock(ppsl->scan_list.lock);
+        }
 
         epicsTimeAddSeconds(&next, ppsl->period);
         epicsTimeGetMonotonic(&now);
@@ -846,10 +1294,220 @@ static void periodicTask(void *arg)
         epicsEventWaitWithTimeout(ppsl->loopEvent, delay);
     }
 
+    for (i = 0; i < ppsl->nWorkers; i++)
+        epicsEventMustTrigger(ppsl->workers[i].go);
+    for (i = 0; i < ppsl->nWorkers; i++)
+        epicsThreadMustJoin(ppsl->workers[i].tid);
+
     taskwdRemove(0);
     epicsEventSignal(startStopEvent);
 }
 
+static int histBin(double seconds)
+{
+    int i;
+
+    for (i = 0; i < SCAN_HIST_BINS - 1; i++) {
+        if (seconds < histUpper[i])
+            break;
+    }
+    return i;
+}
+
+/* Account for a pass or slice that started jitter seconds late */
+static void noteStart(periodic_scan_list *ppsl, double jitter)
+{
+    /* Early when woken by a change of state */
+    if (jitter < 0.0)
+        jitter = 0.0;
+
+    epicsMutexMustLock(ppsl->scan_list.lock);
+    ppsl->starts++;
+    ppsl->jitterLast = jitter;
+    if (jitter > ppsl->jitterMax)
+        ppsl->jitterMax = jitter;
+    ppsl->jitterTotal += jitter;
+    ppsl->jitterHist[histBin(jitter)]++;
+    epicsMutexUnlock(ppsl->scan_list.lock);
+}
+
+/* Process the list in nSlices parts, each due at an equal fraction of the
+ * period after pstart. A slice that is late starts at once, so a pass
+ * catches up when it can. Returns the number of records processed and
+ * the time spent processing them.
+ */
+static int scanSpread(periodic_scan_list *ppsl, const epicsTimeStamp *pstart,
+    double *pbusy)
+{
+    scan_list *psl = &ppsl->scan_list;
+    scan_array *parr = getRecords(psl, NULL);
+    int n = parr ? parr->count : 0;
+    int count = 0;
+    int k;
+
+    *pbusy = 0.0;
+    for (k = 0; k < ppsl->nSlices && ppsl->scanCtl == ctlRun; k++) {
+        int first = (int)((double)n * k / ppsl->nSlices);
+        int last = (int)((double)n * (k + 1) / ppsl->nSlices);
+        epicsTimeStamp due = *pstart, now;
+        epicsUInt64 start;
+        double delay;
+
+        if (first == last)
+            continue;
+
+        epicsTimeAddSeconds(&due, ppsl->period * k / ppsl->nSlices);
+        epicsTimeGetMonotonic(&now);
+        delay = epicsTimeDiffInSeconds(&due, &now);
+        if (delay > 0.0) {
+            epicsEventWaitWithTimeout(ppsl->loopEvent, delay);
+            if (ppsl->scanCtl != ctlRun)
+                break;
+            epicsTimeGetMonotonic(&now);
+        }
+        noteStart(ppsl, epicsTimeDiffInSeconds(&now, &due));
+
+        start = epicsMonotonicGet();
+        count += scanRecords(psl, parr, first, last);
+        *pbusy += (epicsMonotonicGet() - start) * 1e-9;
+    }
+    releaseRecords(parr);
+    return count;
+}
+
+static int compareKeys(const void *a, const void *b)
+{
+    const scan_key *pa = a, *pb = b;
+
+    if (pa->lockId != pb->lockId)
+        return pa->lockId < pb->lockId ? -1 : 1;
+    return pa->index - pb->index;
+}
+
+static int compareGroups(const void *a, const void *b)
+{
+    const scan_group *pa = a, *pb = b;
+
+    /* Largest first, to balance the threads */
+    if (pa->count != pb->count)
+        return pb->count - pa->count;
+    return pa->first - pb->first;
+}
+
+/* Divide the list into lock sets again if it or any lock set has changed */
+static void partitionList(periodic_scan_list *ppsl)
+{
+    size_t recomp = dbLockRecomputeCount();
+    size_t epoch;
+    scan_array *parr = getRecords(&ppsl->scan_list, &epoch);
+    int i, n;
+
+    if (epoch == ppsl->epoch && recomp == ppsl->recomp && ppsl->keys) {
+        releaseRecords(parr);
+        return;
+    }
+    ppsl->epoch = epoch;
+    ppsl->recomp = recomp;
+
+    n = parr ? parr->count : 0;
+    if (n > ppsl->maxKeys || !ppsl->keys) {
+        free(ppsl->keys);
+        free(ppsl->groups);
+        ppsl->maxKeys = n > 16 ? n : 16;
+        ppsl->keys = dbCalloc(ppsl->maxKeys, sizeof(scan_key));
+        ppsl->groups = dbCalloc(ppsl->maxKeys, sizeof(scan_group));
+    }
+    for (i = 0; i < n; i++) {
+        ppsl->keys[i].lockId = dbLockGetLockId(parr->precord[i]);
+        ppsl->keys[i].index = i;
+        ppsl->keys[i].precord = parr->precord[i];
+    }
+    releaseRecords(parr);
+
+    qsort(ppsl->keys, n, sizeof(scan_key), compareKeys);
+
+    ppsl->nGroups = 0;
+    for (i = 0; i < n; i++) {
+        if (!i || ppsl->keys[i].lockId != ppsl->keys[i - 1].lockId) {
+            scan_group *pg = &ppsl->groups[ppsl->nGroups++];
+
+            pg->first = i;
+            pg->count = 0;
+        }
+        ppsl->groups[ppsl->nGroups - 1].count++;
+    }
+    qsort(ppsl->groups, ppsl->nGroups, sizeof(scan_group), compareGroups);
+    ppsl->nKeys = n;
+}
+
+/* Claim and process groups until there are none left */
+static void scanGroups(periodic_scan_list *ppsl)
+{
+    int g;
+
+    while ((g = epicsAtomicIncrIntT(&ppsl->nextGroup) - 1) < ppsl->nGroups) {
+        const scan_group *pg = &ppsl->groups[g];
+        int i;
+
+        for (i = pg->first; i < pg->first + pg->count; i++) {
+            struct dbCommon *precord = ppsl->keys[i].precord;
+            scan_element *pse;
+
+            /* Skip records taken off this list since it was divided.
+             * SCAN is only changed with the record locked.
+             */
+            dbScanLock(precord);
+            pse = precord->spvt;
+            if (pse && pse->pscan_list == &ppsl->scan_list)
+                dbProcess(precord);
+            dbScanUnlock(precord);
+        }
+    }
+}
+
+static void scanWorker(void *arg)
+{
+    scan_worker *pw = (scan_worker *)arg;
+    periodic_scan_list *ppsl = pw->ppsl;
+
+    taskwdInsert(0, NULL, NULL);
+
+    while (TRUE) {
+        epicsEventMustWait(pw->go);
+        if (ppsl->scanCtl == ctlExit)
+            break;
+
+        scanGroups(ppsl);
+        if (epicsAtomicDecrIntT(&ppsl->pending) == 0)
+            epicsEventMustTrigger(ppsl->doneEvent);
+    }
+
+    taskwdRemove(0);
+}
+
+/* Scan the list with the workers' help, returns the number of records */
+static int scanParallel(periodic_scan_list *ppsl)
+{
+    int i, nWake;
+
+    partitionList(ppsl);
+
+    nWake = ppsl->nGroups - 1;
+    if (nWake > ppsl->nWorkers)
+        nWake = ppsl->nWorkers;
+
+    epicsAtomicSetIntT(&ppsl->nextGroup, 0);
+    epicsAtomicSetIntT(&ppsl->pending, nWake);
+    for (i = 0; i < nWake; i++)
+        epicsEventMustTrigger(ppsl->workers[i].go);
+
+    scanGroups(ppsl);
+    if (nWake > 0)
+        epicsEventMustWait(ppsl->doneEvent);
+
+    return ppsl->nKeys;
+}
+
 
 static void initPeriodic(void)
 {
@@ -900,11 +1558,37 @@ static void initPeriodic(void)
         }
 
         ppsl->scan_list.lock = epicsMutexMustCreate();
-        ellInit(&ppsl->scan_list.list);
         ppsl->name = choice;
         ppsl->scanCtl = ctlPause;
         ppsl->loopEvent = epicsEventMustCreate(epicsEventEmpty);
 
+        ppsl->nWorkers = parallelAll - 1;
+        if (i + SCAN_1ST_PERIODIC < nParallelRate &&
+            parallelRate[i + SCAN_1ST_PERIODIC])
+            ppsl->nWorkers = parallelRate[i + SCAN_1ST_PERIODIC] - 1;
+        if (ppsl->nWorkers > 0) {
+            ppsl->workers = dbCalloc(ppsl->nWorkers, sizeof(scan_worker));
+            ppsl->doneEvent = epicsEventMustCreate(epicsEventEmpty);
+        }
+
+        ppsl->nSlices = spreadAll;
+        if (i + SCAN_1ST_PERIODIC < nSpreadRate &&
+            spreadRate[i + SCAN_1ST_PERIODIC])
+            ppsl->nSlices = spreadRate[i + SCAN_1ST_PERIODIC];
+        if (ppsl->nSlices > 1 && ppsl->nWorkers > 0) {
+            errlogPrintf("initPeriodic: Scan rate '%s' is parallel, "
+                "passes will not be spread.\n", choice);
+            ppsl->nSlices = 1;
+        }
+        if (ppsl->nSlices > 1 && quantum > 0 &&
+            ppsl->period / ppsl->nSlices < quantum) {
+            ppsl->nSlices = ppsl->period / quantum;
+            if (ppsl->nSlices < 1)
+                ppsl->nSlices = 1;
+            errlogPrintf("initPeriodic: Scan rate '%s' spread over %d slices.\n",
+                choice, ppsl->nSlices);
+        }
+
         number = ppsl->period / quantum;
         if ((ppsl->period < 2 * quantum) ||
             (number / floor(number) > 1.1)) {
@@ -924,9 +1608,19 @@ static void deletePeriodic(void)
         periodic_scan_list *ppsl = papPeriodic[i];
 
         if (!ppsl) continue;
-        ellFree(&ppsl->scan_list.list);
+        freeList(&ppsl->scan_list);
         epicsEventDestroy(ppsl->loopEvent);
         epicsMutexDestroy(ppsl->scan_list.lock);
+        if (ppsl->nWorkers > 0) {
+            int j;
+
+            for (j = 0; j < ppsl->nWorkers; j++)
+                epicsEventDestroy(ppsl->workers[j].go);
+            free(ppsl->workers);
+            epicsEventDestroy(ppsl->doneEvent);
+        }
+        free(ppsl->keys);
+        free(ppsl->groups);
         free(ppsl);
     }
 
@@ -937,7 +1631,8 @@ static void deletePeriodic(void)
 static void spawnPeriodic(int ind)
 {
     periodic_scan_list *ppsl = papPeriodic[ind];
-    char taskName[20];
+    char taskName[32];
+    int i;
     epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
     opts.joinable = 1;
     opts.priority = epicsThreadPriorityScanLow + ind;
@@ -945,6 +1640,15 @@ static void spawnPeriodic(int ind)
 
     if (!ppsl) return;
 
+    for (i = 0; i < ppsl->nWorkers; i++) {
+        scan_worker *pw = &ppsl->workers[i];
+
+        pw->ppsl = ppsl;
+        pw->go = epicsEventMustCreate(epicsEventEmpty);
+        sprintf(taskName, "scan-%g-%d", ppsl->period, i + 1);
+        pw->tid = epicsThreadCreateOpt(taskName, scanWorker, pw, &opts);
+    }
+
     sprintf(taskName, "scan-%g", ppsl->period);
     periodicTaskId[ind] = epicsThreadCreateOpt(
         taskName, periodicTask, (void *)ppsl, &opts);
@@ -955,100 +1659,158 @@ static void spawnPeriodic(int ind)
 static void ioscanCallback(epicsCallback *pcallback)
 {
     ioscan_head *piosh;
+    io_scan_list *piosl;
     int prio;
 
     callbackGetUser(piosh, pcallback);
     callbackGetPriority(prio, pcallback);
-    scanList(&piosh->iosl[prio].scan_list);
+    piosl = &piosh->iosl[prio];
+
+    if (piosh->batch > 0.0) {
+        epicsUInt64 now = epicsMonotonicGet();
+        epicsUInt64 delay = piosh->batch * 1e9;
+        epicsUInt64 due = piosl->lastStart + delay;
+
+        epicsMutexMustLock(piosl->scan_list.lock);
+        if (!piosl->held && piosl->lastStart && now < due) {
+            /* Too soon after the last pass, requests until the timer
+             * expires coalesce into the pass that is still pending.
+             */
+            piosl->held = 1;
+            epicsMutexUnlock(piosl->scan_list.lock);
+            epicsAtomicIncrSizeT(&piosl->deferred);
+            epicsTimerStartDelay(piosl->timer, (due - now) * 1e-9);
+            return;
+        }
+        /* Timers may expire a little early, count a held pass from when
+         * it was due so the average rate stays within the limit.
+         */
+        piosl->lastStart = piosl->held && now < due + delay ? due : now;
+        piosl->held = 0;
+        epicsMutexUnlock(piosl->scan_list.lock);
+    }
+
+    /* Requests from now on need another pass */
+    epicsAtomicCmpAndSwapIntT(&piosl->pending, 1, 0);
+    epicsAtomicIncrSizeT(&piosl->passes);
+    scanList(&piosl->scan_list);
     if (piosh->cb)
         piosh->cb(piosh->arg, piosh, prio);
 }
 
-static void printList(scan_list *psl, char *message)
+/* The batch delay is over, queue the held pass */
+static void ioscanTimer(void *arg)
 {
-    scan_element *pse;
+    io_scan_list *piosl = (io_scan_list *) arg;
+
+    if (callbackRequest(&piosl->callback)) {
+        epicsMutexMustLock(piosl->scan_list.lock);
+        piosl->held = 0;
+        epicsMutexUnlock(piosl->scan_list.lock);
+        epicsAtomicSetIntT(&piosl->pending, 0);
+        epicsAtomicIncrSizeT(&piosl->overflows);
+    }
+}
+
+/* Take a reference to the current array of a list, NULL if it is empty */
+static scan_array * getRecords(scan_list *psl, size_t *pepoch)
+{
+    scan_array *parr;
 
     epicsMutexMustLock(psl->lock);
-    pse = (scan_element *)ellFirst(&psl->list);
+    parr = psl->records;
+    if (parr)
+        epicsAtomicIncrIntT(&parr->refs);
+    if (pepoch)
+        *pepoch = psl->epoch;
     epicsMutexUnlock(psl->lock);
+    return parr;
+}
+
+static void releaseRecords(scan_array *parr)
+{
+    if (parr && !epicsAtomicDecrIntT(&parr->refs))
+        free(parr);
+}
+
+static void printList(scan_list *psl, char *message)
+{
+    scan_array *parr = getRecords(psl, NULL);
+    int i;
 
-    if (!pse)
+    if (!parr || !parr->count) {
+        releaseRecords(parr);
         return;
+    }
 
     printf("%s\n", message);
-    while (pse) {
-        printf("    %-28s\n", pse->precord->name);
-        epicsMutexMustLock(psl->lock);
-        if (pse->pscan_list != psl) {
-            epicsMutexUnlock(psl->lock);
-            printf("    Scan list changed while printing, try again.\n");
-            return;
-        }
-        pse = (scan_element *)ellNext(&pse->node);
-        epicsMutexUnlock(psl->lock);
-    }
+    for (i = 0; i < parr->count; i++)
+        printf("    %-28s\n", parr->precord[i]->name);
+    releaseRecords(parr);
 }
-
-static void scanList(scan_list *psl)
+
+static int scanRecords(scan_list *psl, const scan_array *parr,
+    int first, int last)
 {
     /* When reading this code remember that the call to dbProcess can result
      * in the SCAN field being changed in an arbitrary number of records.
+     * The array used for this pass does not change, records taken off the
+     * list since it was fetched are skipped and records added will be
+     * scanned next time. SCAN and PHAS are only changed with the record
+     * locked.
      */
+    int count = 0;
+    int i;
 
-    scan_element *pse;
-    scan_element *prev = NULL;
-    scan_element *next = NULL;
-
-    epicsMutexMustLock(psl->lock);
-    psl->modified = FALSE;
-    pse = (scan_element *)ellFirst(&psl->list);
-    if (pse) next = (scan_element *)ellNext(&pse->node);
-    epicsMutexUnlock(psl->lock);
-
-    while (pse) {
-        struct dbCommon *precord = pse->precord;
+    for (i = first; i < last; i++) {
+        struct dbCommon *precord = parr->precord[i];
+        scan_element *pse;
 
         dbScanLock(precord);
-        dbProcess(precord);
-        dbScanUnlock(precord);
-
-        epicsMutexMustLock(psl->lock);
-        if (!psl->modified) {
-            prev = pse;
-            pse = (scan_element *)ellNext(&pse->node);
-            if (pse) next = (scan_element *)ellNext(&pse->node);
-        } else if (pse->pscan_list == psl) {
-            /*This scan element is still in same scan list*/
-            prev = pse;
-            pse = (scan_element *)ellNext(&pse->node);
-            if (pse) next = (scan_element *)ellNext(&pse->node);
-            psl->modified = FALSE;
-        } else if (prev && prev->pscan_list == psl) {
-            /*Previous scan element is still in same scan list*/
-            pse = (scan_element *)ellNext(&prev->node);
-            if (pse) {
-                prev = (scan_element *)ellPrevious(&pse->node);
-                next = (scan_element *)ellNext(&pse->node);
-            }
-            psl->modified = FALSE;
-        } else if (next && next->pscan_list == psl) {
-            /*Next scan element is still in same scan list*/
-            pse = next;
-            prev = (scan_element *)ellPrevious(&pse->node);
-            next = (scan_element *)ellNext(&pse->node);
-            psl->modified = FALSE;
-        } else {
-            /*Too many changes. Just wait till next period*/
-            epicsMutexUnlock(psl->lock);
-            return;
+        pse = precord->spvt;
+        if (pse && pse->pscan_list == psl) {
+            dbProcess(precord);
+            count++;
         }
-        epicsMutexUnlock(psl->lock);
+        dbScanUnlock(precord);
     }
+    return count;
 }
-
+
+static int scanList(scan_list *psl)
+{
+    scan_array *parr = getRecords(psl, NULL);
+    int count;
+
+    if (!parr)
+        return 0;
+
+    count = scanRecords(psl, parr, 0, parr->count);
+    releaseRecords(parr);
+    return count;
+}
+
+typedef struct phas_key {
+    short phas;
+    int index;
+    struct dbCommon *precord;
+} phas_key;
+
+static int comparePhas(const void *a, const void *b)
+{
+    const phas_key *pa = a, *pb = b;
+
+    if (pa->phas != pb->phas)
+        return pa->phas < pb->phas ? -1 : 1;
+    return pa->index - pb->index;
+}
+
 static void buildScanLists(void)
 {
     dbRecordType *pdbRecordType;
+    phas_key *keys = NULL;
+    int n = 0, size = 0;
+    int i;
 
     for (pdbRecordType = (dbRecordType *)ellFirst(&pdbbase->recordTypeList);
          pdbRecordType;
@@ -1061,17 +1823,118 @@ static void buildScanLists(void)
             dbCommon *precord = pdbRecordNode->precord;
 
             if (!precord->name[0] ||
-                pdbRecordNode->flags & DBRN_FLAGS_ISALIAS)
+                pdbRecordNode->flags & DBRN_FLAGS_ISALIAS ||
+                precord->scan == menuScanPassive)
                 continue;
 
-            scanAdd(precord);
+            if (n == size) {
+                size = size ? 2 * size : 1024;
+                keys = realloc(keys, size * sizeof(phas_key));
+                if (!keys)
+                    cantProceed("buildScanLists: realloc failed\n");
+            }
+            keys[n].phas = precord->phas;
+            keys[n].index = n;
+            keys[n].precord = precord;
+            n++;
         }
     }
+
+    /* Adding in PHAS order appends each record to its list, giving
+     * the same order as adding them as found.
+     */
+    qsort(keys, n, sizeof(phas_key), comparePhas);
+    for (i = 0; i < n; i++)
+        scanAdd(keys[i].precord);
+    free(keys);
+}
+
+/* Return an array for the list that may be changed in place and has room
+ * for extra more records. The current array is only reused while no scan
+ * holds it, otherwise a copy replaces it. Called with psl->lock held.
+ */
+static scan_array * writableRecords(scan_list *psl, int extra)
+{
+    scan_array *parr = psl->records;
+    int count = parr ? parr->count : 0;
+    int size;
+
+    if (parr && epicsAtomicGetIntT(&parr->refs) == 1 &&
+        count + extra <= parr->size)
+        return parr;
+
+    size = parr && count + extra <= parr->size ? parr->size :
+        2 * (count + extra);
+    if (size < 16)
+        size = 16;
+
+    if (parr && epicsAtomicGetIntT(&parr->refs) == 1) {
+        parr = realloc(parr, sizeof(scan_array) +
+            (size - 1) * sizeof(struct dbCommon *));
+        if (!parr)
+            cantProceed("dbScan: Scan list realloc failed\n");
+    }
+    else {
+        scan_array *pold = parr;
+
+        parr = dbCalloc(1, sizeof(scan_array) +
+            (size - 1) * sizeof(struct dbCommon *));
+        parr->refs = 1;
+        parr->count = count;
+        if (count)
+            memcpy(parr->precord, pold->precord,
+                count * sizeof(struct dbCommon *));
+        releaseRecords(pold);
+    }
+    parr->size = size;
+    psl->records = parr;
+    return parr;
+}
+
+/* Index of precord in an array, or -1 */
+static int findRecord(const scan_array *parr, const struct dbCommon *precord)
+{
+    int lo = 0, hi = parr->count;
+
+    /* First record with the same PHAS */
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+
+        if (parr->precord[mid]->phas < precord->phas)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    for (; lo < parr->count; lo++) {
+        if (parr->precord[lo] == precord)
+            return lo;
+    }
+    return -1;
+}
+
+static void freeList(scan_list *psl)
+{
+    scan_array *parr = psl->records;
+    int i;
+
+    if (!parr)
+        return;
+    for (i = 0; i < parr->count; i++) {
+        struct dbCommon *precord = parr->precord[i];
+
+        free(precord->spvt);
+        precord->spvt = NULL;
+    }
+    psl->records = NULL;
+    psl->count = 0;
+    releaseRecords(parr);
 }
 
 static void addToList(struct dbCommon *precord, scan_list *psl)
 {
-    scan_element *pse, *ptemp;
+    scan_element *pse;
+    scan_array *parr;
+    int lo = 0, hi;
 
     epicsMutexMustLock(psl->lock);
     pse = precord->spvt;
@@ -1081,19 +1944,32 @@ static void addToList(struct dbCommon *precord, scan_list *psl)
         pse->precord = precord;
     }
     pse->pscan_list = psl;
-    ptemp = (scan_element *)ellLast(&psl->list);
-    while (ptemp) {
-        if (ptemp->precord->phas <= precord->phas) break;
-        ptemp = (scan_element *)ellPrevious(&ptemp->node);
+
+    /* After any records with the same PHAS */
+    parr = writableRecords(psl, 1);
+    hi = parr->count;
+    while (lo < hi) {
+        int mid = lo + (hi - lo) / 2;
+
+        if (parr->precord[mid]->phas <= precord->phas)
+            lo = mid + 1;
+        else
+            hi = mid;
     }
-    ellInsert(&psl->list, (ptemp ? &ptemp->node : NULL), &pse->node);
-    psl->modified = TRUE;
+    memmove(&parr->precord[lo + 1], &parr->precord[lo],
+        (parr->count - lo) * sizeof(struct dbCommon *));
+    parr->precord[lo] = precord;
+    parr->count++;
+    psl->epoch++;
+    epicsAtomicSetIntT(&psl->count, parr->count);
     epicsMutexUnlock(psl->lock);
 }
 
 static void deleteFromList(struct dbCommon *precord, scan_list *psl)
 {
     scan_element *pse;
+    scan_array *parr;
+    int i;
 
     epicsMutexMustLock(psl->lock);
     pse = precord->spvt;
@@ -1112,7 +1988,15 @@ static void deleteFromList(struct dbCommon *precord, scan_list *psl)
         return;
     }
     pse->pscan_list = NULL;
-    ellDelete(&psl->list, &pse->node);
-    psl->modified = TRUE;
+
+    parr = writableRecords(psl, 0);
+    i = findRecord(parr, precord);
+    if (i >= 0) {
+        parr->count--;
+        memmove(&parr->precord[i], &parr->precord[i + 1],
+            (parr->count - i) * sizeof(struct dbCommon *));
+    }
+    psl->epoch++;
+    epicsAtomicSetIntT(&psl->count, parr->count);
     epicsMutexUnlock(psl->lock);
 }
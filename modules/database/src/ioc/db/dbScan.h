@@ -50,6 +50,42 @@ typedef struct scanOnceQueueStats {
     int numOverflow;
 } scanOnceQueueStats;
 
+typedef struct scanPeriodicStats {
+    double period;          /* Seconds */
+    unsigned long overruns;
+    unsigned long passes;   /* Since the last reset */
+    int nRecords;           /* Processed by the last pass */
+    double timeLast;        /* Seconds taken by the last pass */
+    double timeMin;
+    double timeMax;
+    double timeMean;
+    int nLockSets;          /* Lock sets in the last pass, 0 if serial */
+    int nThreads;
+    int nSlices;            /* Time slices each pass is spread over */
+    double jitterLast;      /* Seconds a pass or slice started late */
+    double jitterMax;
+    double jitterMean;
+} scanPeriodicStats;
+
+/* Histogram bins are bounded by 10us, 20us, 50us ... 1s */
+#define SCAN_HIST_BINS 17
+
+typedef struct scanPeriodicHist {
+    double upper[SCAN_HIST_BINS];       /* Bin limits in seconds, the last
+                                         * is infinite */
+    unsigned long jitter[SCAN_HIST_BINS];   /* Late starts */
+    unsigned long time[SCAN_HIST_BINS];     /* Processing time of passes */
+} scanPeriodicHist;
+
+typedef struct scanIoStats {
+    unsigned long requested;    /* scanIoRequest() calls with records to scan */
+    unsigned long coalesced;    /* Requests merged into a pass already queued */
+    unsigned long passes;       /* Scan passes run */
+    unsigned long deferred;     /* Passes held back by scanIoSetBatch() */
+    unsigned long overflows;    /* Requests refused by a full callback queue */
+    int nRecords;
+} scanIoStats;
+
 DBCORE_API long scanInit(void);
 DBCORE_API void scanRun(void);
 DBCORE_API void scanPause(void);
@@ -70,6 +106,12 @@ DBCORE_API void scanOnceQueueShow(const int reset);
 
 /*print periodic lists*/
 DBCORE_API int scanppl(double rate);
+DBCORE_API int scanPeriodicStatus(int scan, const int reset,
+    scanPeriodicStats *result);
+DBCORE_API int scanParallelThreads(int count, const char *rate);
+DBCORE_API int scanSpreadSlices(int count, const char *rate);
+DBCORE_API int scanPeriodicHistogram(int scan, scanPeriodicHist *result);
+DBCORE_API int scanHistShow(double rate, int reset);
 
 /*print event lists*/
 DBCORE_API int scanpel(const char *event_name);
@@ -81,6 +123,9 @@ DBCORE_API void scanIoInit(IOSCANPVT *ppios);
 DBCORE_API unsigned int scanIoRequest(IOSCANPVT pios);
 DBCORE_API unsigned int scanIoImmediate(IOSCANPVT pios, int prio);
 DBCORE_API void scanIoSetComplete(IOSCANPVT, io_scan_complete, void *usr);
+DBCORE_API void scanIoSetBatch(IOSCANPVT, double delay);
+DBCORE_API int scanIoStatus(IOSCANPVT, int prio, const int reset,
+    scanIoStats *result);
 
 #ifdef __cplusplus
 }
@@ -184,6 +184,8 @@ unsigned short recGblResetAlarms(void *precord)
     epicsEnum16 new_sevr = pdbc->nsev;
     epicsEnum16 val_mask = 0;
     epicsEnum16 stat_mask = 0;
+    db_post_field posts[4];
+    unsigned nposts = 0;
 
     if (new_sevr > INVALID_ALARM)
         new_sevr = INVALID_ALARM;
@@ -200,24 +202,26 @@ unsigned short recGblResetAlarms(void *precord)
 
     if (prev_sevr != new_sevr) {
         stat_mask = DBE_ALARM;
-        db_post_events(pdbc, &pdbc->sevr, DBE_VALUE);
+        DB_POST_FIELD(posts, nposts, &pdbc->sevr, DBE_VALUE);
     }
     if (prev_stat != new_stat) {
         stat_mask |= DBE_VALUE;
     }
     if (stat_mask) {
-        db_post_events(pdbc, &pdbc->stat, stat_mask);
-        db_post_events(pdbc, &pdbc->amsg, stat_mask);
+        DB_POST_FIELD(posts, nposts, &pdbc->stat, stat_mask);
+        DB_POST_FIELD(posts, nposts, &pdbc->amsg, stat_mask);
         val_mask = DBE_ALARM;
 
         if (!pdbc->ackt || new_sevr >= pdbc->acks) {
             pdbc->acks = new_sevr;
-            db_post_events(pdbc, &pdbc->acks, DBE_VALUE);
+            DB_POST_FIELD(posts, nposts, &pdbc->acks, DBE_VALUE);
         }
+    }
+    if (nposts)
+        db_post_events_many(pdbc, posts, nposts);
 
-        if (recGblAlarmHook) {
-            (*recGblAlarmHook)(pdbc, prev_sevr, prev_stat);
-        }
+    if (stat_mask && recGblAlarmHook) {
+        (*recGblAlarmHook)(pdbc, prev_sevr, prev_stat);
     }
     return val_mask;
 }
@@ -17,6 +17,7 @@
 
 #include "dbDefs.h"
 #include "ellLib.h"
+#include "epicsAtomic.h"
 #include "epicsMutex.h"
 #include "epicsStdio.h"
 #include "epicsString.h"
@@ -25,22 +26,61 @@
 #include "dbStaticLib.h"
 #include "dbStaticPvt.h"
 
+/*
+ * The directory is an open addressed hash table with linear probing.
+ * Each slot keeps the hash of its name, so that a probe only compares
+ * names whose hashes match.
+ *
+ * dbPvdFind() takes no lock.  Writers are serialized by the directory
+ * lock, fill in a slot's hash before publishing its entry, and never
+ * move a published entry.  When the table grows it is rebuilt and the
+ * new table published as a whole.  Old tables may still be in use by
+ * readers, so they are only freed by dbPvdFreeMem().  Since tables
+ * double in size, the old tables use less memory than the current one.
+ *
+ * Deleting a record while other threads are looking up names is no
+ * safer than before, the record node goes away with the entry.
+ *
+ * Each table also has a blocked Bloom filter of the names, with one
+ * byte per slot.  A name sets 3 bits in a 64 byte block, so testing
+ * for a name which is not present usually reads one cache line.  The
+ * bits of deleted names stay set until the table is rebuilt.
+ */
+
 typedef struct {
-    ELLLIST      list;
-    epicsMutexId lock;
-} dbPvdBucket;
+    unsigned int hash;
+    PVDENTRY     *ppvdNode;  /* NULL when empty, or PVD_DELETED */
+} dbPvdSlot;
+
+typedef struct dbPvdTable {
+    struct dbPvdTable *retired;  /* the previous table */
+    unsigned int size;           /* number of slots, a power of 2 */
+    unsigned int shift;          /* 32 - log2(size) */
+    epicsUInt32  *filter;        /* after the slots */
+    unsigned int filterShift;    /* 32 - log2(filter blocks) */
+    dbPvdSlot    slots[1];
+} dbPvdTable;
 
 typedef struct dbPvd {
-    unsigned int size;
-    unsigned int mask;
-    dbPvdBucket **buckets;
+    dbPvdTable   *table;
+    epicsMutexId lock;
+    unsigned int count;          /* entries */
+    unsigned int used;           /* entries and deleted slots */
+    unsigned int resizes;
 } dbPvd;
 
 unsigned int dbPvdHashTableSize = 0;
 
 #define MIN_SIZE 256
 #define DEFAULT_SIZE 512
-#define MAX_SIZE 65536
+#define MAX_SIZE (1u << 30)
+
+static PVDENTRY pvdDeleted;
+#define PVD_DELETED (&pvdDeleted)
+
+/* 512 bit filter blocks, one for 64 slots */
+#define FILTER_BLOCK_WORDS 16
+#define FILTER_BLOCK_SLOTS 64
 
 
 int dbPvdTableSize(int size)
@@ -53,13 +93,113 @@ int dbPvdTableSize(int size)
     if (size < MIN_SIZE)
         size = MIN_SIZE;
 
-    if (size > MAX_SIZE)
+    if ((unsigned int) size > MAX_SIZE)
         size = MAX_SIZE;
 
     dbPvdHashTableSize = size;
     return 0;
 }
 
+/* Spread the weak low bits of the string hash over the table */
+static unsigned int slotIndex(const dbPvdTable *ptab, unsigned int hash)
+{
+    return (hash * 2654435769u) >> ptab->shift;
+}
+
+static dbPvdTable *tableCreate(unsigned int size)
+{
+    size_t filterSize = size / FILTER_BLOCK_SLOTS *
+        FILTER_BLOCK_WORDS * sizeof(epicsUInt32);
+    dbPvdTable *ptab = dbCalloc(1, offsetof(dbPvdTable, slots) +
+        size * sizeof(dbPvdSlot) + filterSize);
+    unsigned int bits = 0;
+
+    while ((1u << bits) < size)
+        bits++;
+    ptab->size  = size;
+    ptab->shift = 32 - bits;
+    ptab->filter = (epicsUInt32 *) &ptab->slots[size];
+    ptab->filterShift = ptab->shift + 6;  /* log2(FILTER_BLOCK_SLOTS) */
+    return ptab;
+}
+
+/* The filter block for a hash, and the bits within it in *pbits */
+static epicsUInt32 *filterBlock(const dbPvdTable *ptab, unsigned int hash,
+    unsigned int *pbits)
+{
+    unsigned int mix = (hash ^ (hash >> 16)) * 0x85ebca6bu;
+
+    *pbits = mix ^ (mix >> 13);
+    return &ptab->filter[((hash * 2654435769u) >> ptab->filterShift) *
+        FILTER_BLOCK_WORDS];
+}
+
+static void filterAdd(dbPvdTable *ptab, unsigned int hash)
+{
+    unsigned int bits;
+    epicsUInt32 *pblock = filterBlock(ptab, hash, &bits);
+    int k;
+
+    for (k = 0; k < 3; k++, bits >>= 9)
+        pblock[(bits & 511) >> 5] |= 1u << (bits & 31);
+}
+
+static int filterTest(const dbPvdTable *ptab, unsigned int hash)
+{
+    unsigned int bits;
+    const epicsUInt32 *pblock = filterBlock(ptab, hash, &bits);
+    int k;
+
+    for (k = 0; k < 3; k++, bits >>= 9) {
+        if (!(pblock[(bits & 511) >> 5] & (1u << (bits & 31))))
+            return 0;
+    }
+    return 1;
+}
+
+static void slotPublish(dbPvdSlot *pslot, unsigned int hash,
+    PVDENTRY *ppvdNode)
+{
+    pslot->hash = hash;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetPtrT((EpicsAtomicPtrT *) &pslot->ppvdNode, ppvdNode);
+}
+
+/* Rebuild the table, large enough for one more entry.
+ * Called with the lock held.
+ */
+static void tableResize(dbPvd *ppvd)
+{
+    dbPvdTable *pold = ppvd->table;
+    dbPvdTable *pnew;
+    unsigned int size = pold->size;
+    unsigned int h;
+
+    /* at most half full afterwards, tables with many deleted
+     * slots are rebuilt at the same size */
+    while (size < MAX_SIZE && (ppvd->count + 1) * 2 > size)
+        size <<= 1;
+
+    pnew = tableCreate(size);
+    for (h = 0; h < pold->size; h++) {
+        dbPvdSlot *pslot = &pold->slots[h];
+        unsigned int i;
+
+        if (!pslot->ppvdNode || pslot->ppvdNode == PVD_DELETED)
+            continue;
+        i = slotIndex(pnew, pslot->hash);
+        while (pnew->slots[i].ppvdNode)
+            i = (i + 1) & (size - 1);
+        pnew->slots[i] = *pslot;
+        filterAdd(pnew, pslot->hash);
+    }
+    pnew->retired = pold;
+    epicsAtomicWriteMemoryBarrier();
+    epicsAtomicSetPtrT((EpicsAtomicPtrT *) &ppvd->table, pnew);
+    ppvd->used = ppvd->count;
+    ppvd->resizes++;
+}
+
 void dbPvdInitPvt(dbBase *pdbbase)
 {
     dbPvd *ppvd;
@@ -70,10 +210,9 @@ void dbPvdInitPvt(dbBase *pdbbase)
         dbPvdHashTableSize = DEFAULT_SIZE;
     }
 
-    ppvd = (dbPvd *)dbMalloc(sizeof(dbPvd));
-    ppvd->size    = dbPvdHashTableSize;
-    ppvd->mask    = dbPvdHashTableSize - 1;
-    ppvd->buckets = dbCalloc(ppvd->size, sizeof(dbPvdBucket *));
+    ppvd = dbCalloc(1, sizeof(dbPvd));
+    ppvd->table = tableCreate(dbPvdHashTableSize);
+    ppvd->lock  = epicsMutexMustCreate();
 
     pdbbase->ppvd = ppvd;
     return;
@@ -82,118 +221,153 @@ void dbPvdInitPvt(dbBase *pdbbase)
 PVDENTRY *dbPvdFind(dbBase *pdbbase, const char *name, size_t lenName)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
-    PVDENTRY *ppvdNode;
+    dbPvdTable *ptab;
+    unsigned int hash = epicsMemHash(name, lenName, 0);
+    unsigned int i;
+
+    ptab = epicsAtomicGetPtrT((EpicsAtomicPtrT *) &ppvd->table);
+    epicsAtomicReadMemoryBarrier();
 
-    pbucket = ppvd->buckets[epicsMemHash(name, lenName, 0) & ppvd->mask];
-    if (pbucket == NULL) return NULL;
+    /* never full, an empty slot ends the probe */
+    for (i = slotIndex(ptab, hash); ; i = (i + 1) & (ptab->size - 1)) {
+        dbPvdSlot *pslot = &ptab->slots[i];
+        PVDENTRY *ppvdNode =
+            epicsAtomicGetPtrT((EpicsAtomicPtrT *) &pslot->ppvdNode);
+        const char *recordname;
 
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        const char *recordname = ppvdNode->precnode->recordname;
+        if (!ppvdNode)
+            return NULL;
+        epicsAtomicReadMemoryBarrier();
+        if (ppvdNode == PVD_DELETED || pslot->hash != hash)
+            continue;
 
+        recordname = ppvdNode->precnode->recordname;
         if (strncmp(name, recordname, lenName) == 0 &&
-            strlen(recordname) == lenName)
-            break;
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
+            recordname[lenName] == '\0')
+            return ppvdNode;
     }
-    epicsMutexUnlock(pbucket->lock);
-    return ppvdNode;
 }
-
+
+int dbPvdMayExist(dbBase *pdbbase, const char *name, size_t lenName)
+{
+    dbPvd *ppvd = pdbbase->ppvd;
+    dbPvdTable *ptab;
+
+    ptab = epicsAtomicGetPtrT((EpicsAtomicPtrT *) &ppvd->table);
+    epicsAtomicReadMemoryBarrier();
+    return filterTest(ptab, epicsMemHash(name, lenName, 0));
+}
+
 PVDENTRY *dbPvdAdd(dbBase *pdbbase, dbRecordType *precordType,
     dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
+    dbPvdTable *ptab;
+    dbPvdSlot *pfree = NULL;
     PVDENTRY *ppvdNode;
     char *name = precnode->recordname;
-    unsigned int h;
-
-    h = epicsStrHash(name, 0) & ppvd->mask;
-    pbucket = ppvd->buckets[h];
-    if (pbucket == NULL) {
-        pbucket = dbCalloc(1, sizeof(dbPvdBucket));
-        ellInit(&pbucket->list);
-        pbucket->lock = epicsMutexCreate();
-        ppvd->buckets[h] = pbucket;
-    }
-
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        if (strcmp(name, ppvdNode->precnode->recordname) == 0) {
-            epicsMutexUnlock(pbucket->lock);
+    unsigned int hash = epicsStrHash(name, 0);
+    unsigned int i;
+
+    epicsMutexMustLock(ppvd->lock);
+    if ((ppvd->used + 1) * 4 > ppvd->table->size * 3)
+        tableResize(ppvd);
+    ptab = ppvd->table;
+
+    for (i = slotIndex(ptab, hash); ; i = (i + 1) & (ptab->size - 1)) {
+        dbPvdSlot *pslot = &ptab->slots[i];
+
+        if (!pslot->ppvdNode) {
+            if (!pfree) {
+                pfree = pslot;
+                ppvd->used++;
+            }
+            break;
+        }
+        if (pslot->ppvdNode == PVD_DELETED) {
+            if (!pfree)
+                pfree = pslot;
+        }
+        else if (pslot->hash == hash &&
+            strcmp(name, pslot->ppvdNode->precnode->recordname) == 0) {
+            epicsMutexUnlock(ppvd->lock);
             return NULL;
         }
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
     }
+
     ppvdNode = dbCalloc(1, sizeof(PVDENTRY));
     ppvdNode->precordType = precordType;
     ppvdNode->precnode = precnode;
-    ellAdd(&pbucket->list, (ELLNODE *)ppvdNode);
-    epicsMutexUnlock(pbucket->lock);
+    filterAdd(ptab, hash);
+    slotPublish(pfree, hash, ppvdNode);
+    ppvd->count++;
+    epicsMutexUnlock(ppvd->lock);
     return ppvdNode;
 }
 
 void dbPvdDelete(dbBase *pdbbase, dbRecordNode *precnode)
 {
     dbPvd *ppvd = pdbbase->ppvd;
-    dbPvdBucket *pbucket;
-    PVDENTRY *ppvdNode;
+    dbPvdTable *ptab;
     char *name = precnode->recordname;
+    unsigned int hash = epicsStrHash(name, 0);
+    unsigned int i;
 
-    pbucket = ppvd->buckets[epicsStrHash(name, 0) & ppvd->mask];
-    if (pbucket == NULL) return;
+    epicsMutexMustLock(ppvd->lock);
+    ptab = ppvd->table;
+    for (i = slotIndex(ptab, hash); ; i = (i + 1) & (ptab->size - 1)) {
+        dbPvdSlot *pslot = &ptab->slots[i];
+        PVDENTRY *ppvdNode = pslot->ppvdNode;
 
-    epicsMutexMustLock(pbucket->lock);
-    ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-    while (ppvdNode) {
-        if (ppvdNode->precnode &&
+        if (!ppvdNode)
+            break;
+        if (ppvdNode != PVD_DELETED && pslot->hash == hash &&
+            ppvdNode->precnode &&
             ppvdNode->precnode->recordname &&
             strcmp(name, ppvdNode->precnode->recordname) == 0) {
-            ellDelete(&pbucket->list, (ELLNODE *)ppvdNode);
+            epicsAtomicSetPtrT((EpicsAtomicPtrT *) &pslot->ppvdNode,
+                PVD_DELETED);
+            ppvd->count--;
             free(ppvdNode);
             break;
         }
-        ppvdNode = (PVDENTRY *) ellNext((ELLNODE *)ppvdNode);
     }
-    epicsMutexUnlock(pbucket->lock);
+    epicsMutexUnlock(ppvd->lock);
     return;
 }
 
 void dbPvdFreeMem(dbBase *pdbbase)
 {
     dbPvd *ppvd = pdbbase->ppvd;
+    dbPvdTable *ptab;
     unsigned int h;
 
     if (ppvd == NULL) return;
     pdbbase->ppvd = NULL;
 
-    for (h = 0; h < ppvd->size; h++) {
-        dbPvdBucket *pbucket = ppvd->buckets[h];
-        PVDENTRY *ppvdNode;
+    ptab = ppvd->table;
+    for (h = 0; h < ptab->size; h++) {
+        PVDENTRY *ppvdNode = ptab->slots[h].ppvdNode;
 
-        if (pbucket == NULL) continue;
-        epicsMutexMustLock(pbucket->lock);
-        ppvd->buckets[h] = NULL;
-        while ((ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list))) {
-            ellDelete(&pbucket->list, (ELLNODE *)ppvdNode);
+        if (ppvdNode && ppvdNode != PVD_DELETED)
             free(ppvdNode);
-        }
-        epicsMutexUnlock(pbucket->lock);
-        epicsMutexDestroy(pbucket->lock);
-        free(pbucket);
     }
-    free(ppvd->buckets);
+    while (ptab) {
+        dbPvdTable *pretired = ptab->retired;
+
+        free(ptab);
+        ptab = pretired;
+    }
+    epicsMutexDestroy(ppvd->lock);
     free(ppvd);
 }
 
 void dbPvdDump(dbBase *pdbbase, int verbose)
 {
-    unsigned int empty = 0;
+    unsigned int longest = 0, bitsSet = 0;
+    double probes = 0.0;
     dbPvd *ppvd;
+    dbPvdTable *ptab;
     unsigned int h;
 
     if (!pdbbase) {
@@ -203,27 +377,40 @@ void dbPvdDump(dbBase *pdbbase, int verbose)
     ppvd = pdbbase->ppvd;
     if (ppvd == NULL) return;
 
-    printf("Process Variable Directory has %u buckets", ppvd->size);
+    epicsMutexMustLock(ppvd->lock);
+    ptab = ppvd->table;
+    printf("Process Variable Directory has %u entries in %u slots",
+        ppvd->count, ptab->size);
 
-    for (h = 0; h < ppvd->size; h++) {
-        dbPvdBucket *pbucket = ppvd->buckets[h];
-        PVDENTRY *ppvdNode;
-        int i = 1;
+    for (h = 0; h < ptab->size; h++) {
+        dbPvdSlot *pslot = &ptab->slots[h];
+        unsigned int distance;
 
-        if (pbucket == NULL) {
-            empty++;
+        if (!pslot->ppvdNode || pslot->ppvdNode == PVD_DELETED)
             continue;
-        }
-        epicsMutexMustLock(pbucket->lock);
-        ppvdNode = (PVDENTRY *) ellFirst(&pbucket->list);
-        printf("\n [%4u] %4d  ", h, ellCount(&pbucket->list));
-        while (ppvdNode && verbose) {
-            if (!(++i % 4))
-                printf("\n         ");
-            printf("  %s", ppvdNode->precnode->recordname);
-            ppvdNode = (PVDENTRY *) ellNext((ELLNODE*)ppvdNode);
-        }
-        epicsMutexUnlock(pbucket->lock);
+        /* slots probed before this entry is found */
+        distance = (h - slotIndex(ptab, pslot->hash)) & (ptab->size - 1);
+        probes += distance + 1;
+        if (distance + 1 > longest)
+            longest = distance + 1;
+        if (verbose)
+            printf("\n [%8u] %3u  %s", h, distance + 1,
+                pslot->ppvdNode->precnode->recordname);
+    }
+    printf("\n%u deleted slots, resized %u times.\n",
+        ppvd->used - ppvd->count, ppvd->resizes);
+    if (ppvd->count)
+        printf("Lookups probe %.2f slots on average, %u at most.\n",
+            probes / ppvd->count, longest);
+
+    /* one filter byte per slot */
+    for (h = 0; h < ptab->size / sizeof(epicsUInt32); h++) {
+        epicsUInt32 word = ptab->filter[h];
+
+        for (; word; word &= word - 1)
+            bitsSet++;
     }
-    printf("\n%u buckets empty.\n", empty);
+    printf("Name filter has %u bytes, %.1f%% of its bits set.\n",
+        ptab->size, 100.0 * bitsSet / (8.0 * ptab->size));
+    epicsMutexUnlock(ppvd->lock);
 }
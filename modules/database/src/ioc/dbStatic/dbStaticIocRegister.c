@@ -199,7 +199,7 @@ static const iocshFuncDef dbPvdTableSizeFuncDef = {
     "dbPvdTableSize",
     1,
     dbPvdTableSizeArgs,
-    "Change the number of buckets in the process variable directory.\n\n"
+    "Set the initial number of slots in the process variable directory.\n\n"
     "The process variable directory size should be set before loading the database.\n"
     "The size of the process variable directory can automatically grow.\n"
     "The size must be a power of 2.\n\n"
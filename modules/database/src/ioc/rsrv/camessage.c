@@ -24,7 +24,10 @@
 #include <stdarg.h>
 #include <limits.h>
 
+#include "epicsAtomic.h"
+#include "epicsEndian.h"
 #include "epicsEvent.h"
+#include "epicsExit.h"
 #include "epicsMutex.h"
 #include "epicsStdio.h"
 #include "epicsString.h"
@@ -482,24 +485,148 @@ static void no_read_access_event ( struct client *pClient,
 /*
  *  read_reply()
  */
+/*
+ * read_reply_get ()
+ *
+ * Fetch the value into pPayload in network format, returns ECA_NORMAL,
+ * ECA_GETFAIL or the conversion status
+ */
+static int read_reply_get ( struct event_ext *pevext, struct dbChannel *dbch,
+    db_field_log *pfl, void *pPayload, long *pItemCount )
+{
+    int local_fl = 0;
+    int status;
+
+    /* If filters are involved in a read, create field log and run filters */
+    if (!pfl && (ellCount(&dbch->pre_chain) || ellCount(&dbch->post_chain))) {
+        pfl = db_create_read_log(dbch);
+        if (pfl) {
+            local_fl = 1;
+            pfl = dbChannelRunPreChain(dbch, pfl);
+            pfl = dbChannelRunPostChain(dbch, pfl);
+        }
+    }
+
+    status = dbChannel_get_count ( dbch, pevext->msg.m_dataType,
+                  pPayload, pItemCount, pfl);
+
+    if (local_fl) db_delete_field_log(pfl);
+
+    if ( status < 0 )
+        return ECA_GETFAIL;
+
+    return caNetConvert (
+        pevext->msg.m_dataType, pPayload, pPayload,
+        TRUE /* host -> net format */, *pItemCount );
+}
+
+/*
+ * read_scratch_get ()
+ *
+ * A buffer of the calling thread for values fetched before the send
+ * lock is taken, kept for its later reads.  Returns NULL if none.
+ */
+typedef struct {
+    void *pBuf;
+    size_t size;
+} read_scratch;
+
+static epicsThreadOnceId readScratchOnce = EPICS_THREAD_ONCE_INIT;
+static epicsThreadPrivateId readScratchId;
+
+static void read_scratch_init ( void *pArg )
+{
+    readScratchId = epicsThreadPrivateCreate ();
+}
+
+static void read_scratch_free ( void *pArg )
+{
+    read_scratch *pScr = pArg;
+
+    epicsThreadPrivateSet ( readScratchId, NULL );
+    free ( pScr->pBuf );
+    free ( pScr );
+}
+
+static void * read_scratch_get ( size_t size )
+{
+    read_scratch *pScr;
+
+    epicsThreadOnce ( &readScratchOnce, read_scratch_init, NULL );
+    if ( ! readScratchId ) {
+        return NULL;
+    }
+    pScr = epicsThreadPrivateGet ( readScratchId );
+    if ( ! pScr ) {
+        pScr = calloc ( 1, sizeof ( *pScr ) );
+        if ( ! pScr ) {
+            return NULL;
+        }
+        if ( epicsAtThreadExit ( read_scratch_free, pScr ) ) {
+            free ( pScr );
+            return NULL;
+        }
+        epicsThreadPrivateSet ( readScratchId, pScr );
+    }
+    if ( pScr->size < size ) {
+        /* the old contents are not needed */
+        free ( pScr->pBuf );
+        pScr->pBuf = malloc ( size );
+        pScr->size = pScr->pBuf ? size : 0u;
+    }
+    return pScr->pBuf;
+}
+
+/*
+ * read_reply_snapshot ()
+ *
+ * Take a reference to a large array snapshot which needs no conversion,
+ * so it can be sent without copying.  Returns the reference or NULL.
+ */
+static void * read_reply_snapshot ( struct event_ext *pevext,
+    struct dbChannel *dbch, db_field_log *pfl, int autosize,
+    long *pItemCount )
+{
+    unsigned type = pevext->msg.m_dataType;
+    long count;
+
+    if ( ! pfl || pfl->type != dbfl_type_ref || type >= DBR_STS_STRING ||
+            type != dbChannelFinalCAType ( dbch ) ||
+            pfl->field_size != dbr_value_size[type] ) {
+        return NULL;
+    }
+    if ( EPICS_BYTE_ORDER != EPICS_ENDIAN_BIG &&
+            type != DBR_CHAR && type != DBR_STRING ) {
+        return NULL;
+    }
+    count = autosize ? pfl->no_elements : pevext->msg.m_count;
+    if ( count > pfl->no_elements ||
+            (unsigned long) count * pfl->field_size < CAS_GATHER_MIN ) {
+        return NULL;
+    }
+    *pItemCount = count;
+    return db_field_log_hold_snapshot ( pfl );
+}
+
 static void read_reply ( void *pArg, struct dbChannel *dbch,
                        int eventsRemaining, db_field_log *pfl )
 {
     ca_uint32_t cid;
     void *pPayload;
+    void *pValue = NULL;
+    void *pScratch = NULL;
+    void *pSnap = NULL;
     struct event_ext *pevext = pArg;
     struct client *pClient = pevext->pciu->client;
     struct channel_in_use *pciu = pevext->pciu;
     const int readAccess = asCheckGet ( pciu->asClientPVT );
     int status;
     int autosize;
-    int local_fl = 0;
+    int gather = FALSE;
     long item_count;
     ca_uint32_t payload_size;
     dbAddr *paddr=&dbch->addr;
 
-    SEND_LOCK ( pClient );
-
     cid = ECA_NORMAL;
 
     /* If the client has requested a zero element count we interpret this as a
@@ -508,11 +635,45 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
     autosize = pevext->msg.m_count == 0;
     item_count =
         autosize ? paddr->no_elements : pevext->msg.m_count;
+
+    if ( readAccess ) {
+        pSnap = read_reply_snapshot ( pevext, dbch, pfl, autosize,
+            &item_count );
+    }
     payload_size = dbr_size_n(pevext->msg.m_dataType, item_count);
-    status = cas_copy_in_header(
-        pClient, pevext->msg.m_cmmd, payload_size,
-        pevext->msg.m_dataType, item_count, cid, pevext->msg.m_available,
-        &pPayload );
+
+    /* Large arrays, and with several event tasks for this client all
+     * values, are fetched and converted before taking the send lock so
+     * that they do not serialize on it.  Large arrays are then sent
+     * from their own buffer instead of being copied in, other values
+     * use the thread's buffer. */
+    if ( readAccess && ! pSnap ) {
+        if ( payload_size >= CAS_GATHER_MIN ) {
+            pScratch = malloc ( payload_size );
+            pValue = pScratch;
+        }
+        else if ( db_event_shard_count ( pClient->evuser ) > 1u ) {
+            pValue = read_scratch_get ( payload_size );
+        }
+        if ( pValue )
+            cid = read_reply_get ( pevext, dbch, pfl, pValue, &item_count );
+    }
+    gather = pSnap || ( pScratch && cid == ECA_NORMAL );
+
+    SEND_LOCK ( pClient );
+
+    if ( gather ) {
+        status = cas_copy_in_header_ext(
+            pClient, pevext->msg.m_cmmd, payload_size,
+            pevext->msg.m_dataType, item_count, ECA_NORMAL,
+            pevext->msg.m_available );
+    }
+    else {
+        status = cas_copy_in_header(
+            pClient, pevext->msg.m_cmmd, payload_size,
+            pevext->msg.m_dataType, item_count, ECA_NORMAL,
+            pevext->msg.m_available, &pPayload );
+    }
     if ( status != ECA_NORMAL ) {
         send_err ( &pevext->msg, status, pClient,
             "server unable to load read (or subscription update) response "
@@ -521,6 +682,8 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
         if ( ! eventsRemaining )
             cas_send_bs_msg ( pClient, FALSE );
         SEND_UNLOCK ( pClient );
+        free ( pScratch );
+        db_snapshot_release ( pSnap );
         return;
     }
 
@@ -530,27 +693,43 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
     if ( ! readAccess ) {
         no_read_access_event ( pClient, pevext );
         if ( ! eventsRemaining )
-            cas_send_bs_msg ( pClient, FALSE );
+            cas_send_event_msg ( pClient );
         SEND_UNLOCK ( pClient );
         return;
     }
 
-    /* If filters are involved in a read, create field log and run filters */
-    if (!pfl && (ellCount(&dbch->pre_chain) || ellCount(&dbch->post_chain))) {
-        pfl = db_create_read_log(dbch);
-        if (pfl) {
-            local_fl = 1;
-            pfl = dbChannelRunPreChain(dbch, pfl);
-            pfl = dbChannelRunPostChain(dbch, pfl);
-        }
+    if ( pSnap ) {
+        cas_commit_msg_ext ( pClient, pfl->u.r.field, payload_size,
+            db_snapshot_release, pSnap );
+        if ( ! eventsRemaining )
+            cas_send_event_msg ( pClient );
+        SEND_UNLOCK ( pClient );
+        return;
     }
 
-    status = dbChannel_get_count ( dbch, pevext->msg.m_dataType,
-                  pPayload, &item_count, pfl);
-
-    if (local_fl) db_delete_field_log(pfl);
+    if ( gather ) {
+        pPayload = pScratch;
+    }
+    else if ( pValue ) {
+        memcpy ( pPayload, pValue, payload_size );
+        free ( pScratch );
+    }
+    else {
+        cid = read_reply_get ( pevext, dbch, pfl, pPayload, &item_count );
+    }
 
-    if ( status < 0 ) {
+    if ( cid == ECA_NORMAL ) {
+        ca_uint32_t data_size =
+            dbr_size_n(pevext->msg.m_dataType, item_count);
+        if (autosize) {
+            payload_size = data_size;
+            cas_set_header_count(pClient, item_count);
+        }
+        else if (payload_size > data_size)
+            memset(
+                (char *) pPayload + data_size, 0, payload_size - data_size);
+    }
+    else {
         /* Clients recv the status of the operation directly to the
          * event/put/get callback.  (from CA_V41())
          *
@@ -565,32 +744,12 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
             cas_set_header_count(pClient, 0);
         }
         memset ( pPayload, 0, payload_size );
-        cas_set_header_cid ( pClient, ECA_GETFAIL );
-        cas_commit_msg ( pClient, payload_size );
+        cas_set_header_cid ( pClient, cid );
+    }
+    if ( gather ) {
+        cas_commit_msg_ext ( pClient, pScratch, payload_size, free, pScratch );
     }
     else {
-        int cacStatus = caNetConvert (
-            pevext->msg.m_dataType, pPayload, pPayload,
-            TRUE /* host -> net format */, item_count );
-        if ( cacStatus == ECA_NORMAL ) {
-            ca_uint32_t data_size =
-                dbr_size_n(pevext->msg.m_dataType, item_count);
-            if (autosize) {
-                payload_size = data_size;
-                cas_set_header_count(pClient, item_count);
-            }
-            else if (payload_size > data_size)
-                memset(
-                    (char *) pPayload + data_size, 0, payload_size - data_size);
-        }
-        else {
-            if (autosize) {
-                payload_size = dbr_size_n(pevext->msg.m_dataType, 0);
-                cas_set_header_count(pClient, 0);
-            }
-            memset ( pPayload, 0, payload_size );
-            cas_set_header_cid ( pClient, cacStatus );
-        }
         cas_commit_msg ( pClient, payload_size );
     }
 
@@ -599,7 +758,7 @@ static void read_reply ( void *pArg, struct dbChannel *dbch,
      * them up like db requests when the OPI does not keep up.
      */
     if ( ! eventsRemaining )
-        cas_send_bs_msg ( pClient, FALSE );
+        cas_send_event_msg ( pClient );
 
     SEND_UNLOCK ( pClient );
 
@@ -1500,6 +1659,7 @@ void rsrv_extra_labor ( void * pArg )
     write_notify_reply ( pClient );
     sendAllUpdateAS ( pClient );
     cas_send_bs_msg ( pClient, TRUE );
+    rsrv_poll_resume ( pClient );
 }
 
 /*
@@ -2190,10 +2350,16 @@ static int search_reply_udp ( caHdrLargeArray *mp, void *pPayload, struct client
     pName[mp->m_postsize-1] = '\0';
 
     /* Exit quickly if channel not on this node */
+    if (!dbChannelMayExist(pName)) {
+        epicsAtomicIncrSizeT ( &rsrvSearchFiltered );
+        return RSRV_OK;
+    }
     if (dbChannelTest(pName)) {
+        epicsAtomicIncrSizeT ( &rsrvSearchMissed );
         DLOG ( 2, ( "CAS: Lookup for channel \"%s\" failed\n", pName ) );
         return RSRV_OK;
     }
+    epicsAtomicIncrSizeT ( &rsrvSearchFound );
 
     /*
      * stop further use of server if memory becomes scarce
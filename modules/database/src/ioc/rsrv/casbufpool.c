@@ -0,0 +1,175 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ *  Large message buffers for CA server TCP clients, kept in power of
+ *  two size classes.  Clients return them once large transfers have
+ *  stopped, and only a few idle buffers of each class are retained.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbDefs.h"
+#include "epicsMutex.h"
+#include "errlog.h"
+
+#include "rsrv.h"
+#include "server.h"
+
+/* the smallest class holds twice MAX_TCP */
+#define POOL_MIN_SHIFT 15u
+#define POOL_CLASSES ( 32u - POOL_MIN_SHIFT )
+/* idle bytes retained in each class, beyond the one always kept */
+#define POOL_IDLE_BYTES ( 1024u * 1024u )
+
+typedef struct pool_class {
+    void            *idle;      /* linked through the first word */
+    unsigned        nIdle;
+    unsigned        nInUse;
+    unsigned        highWater;  /* of nInUse */
+    unsigned long   nAlloc;     /* from the heap */
+} pool_class;
+
+static pool_class poolClasses[POOL_CLASSES];
+static epicsMutexId poolLock;
+static ca_uint32_t poolMaxSize;
+
+int rsrv_buf_pool_init ( ca_uint32_t maxSize )
+{
+    poolLock = epicsMutexCreate ();
+    if ( ! poolLock ) {
+        return RSRV_ERROR;
+    }
+    poolMaxSize = maxSize;
+    return RSRV_OK;
+}
+
+static unsigned pool_class_index ( ca_uint32_t size )
+{
+    unsigned shift = POOL_MIN_SHIFT;
+
+    while ( shift < 31u && ( 1u << shift ) < size ) {
+        shift++;
+    }
+    return shift - POOL_MIN_SHIFT;
+}
+
+static ca_uint32_t pool_class_size ( unsigned index )
+{
+    ca_uint32_t size = 1u << ( index + POOL_MIN_SHIFT );
+
+    return poolMaxSize && size > poolMaxSize ? poolMaxSize : size;
+}
+
+/*
+ *  rsrv_buf_alloc()
+ *
+ *  Returns a buffer of at least size bytes and its actual size, or NULL
+ *  if size is over the limit or memory is short
+ */
+char * rsrv_buf_alloc ( ca_uint32_t size, unsigned *pActual )
+{
+    pool_class *pc;
+    unsigned index;
+    void *buf;
+
+    if ( size > ( 1u << 31 ) || ( poolMaxSize && size > poolMaxSize ) ) {
+        return NULL;
+    }
+    index = pool_class_index ( size );
+    pc = &poolClasses[index];
+
+    epicsMutexMustLock ( poolLock );
+    buf = pc->idle;
+    if ( buf ) {
+        pc->idle = *(void **) buf;
+        pc->nIdle--;
+    }
+    else {
+        buf = malloc ( pool_class_size ( index ) );
+        if ( buf ) {
+            pc->nAlloc++;
+        }
+    }
+    if ( buf ) {
+        if ( ++pc->nInUse > pc->highWater ) {
+            pc->highWater = pc->nInUse;
+        }
+    }
+    epicsMutexUnlock ( poolLock );
+
+    *pActual = pool_class_size ( index );
+    return buf;
+}
+
+void rsrv_buf_free ( char *buf, unsigned size )
+{
+    unsigned index = pool_class_index ( size );
+    pool_class *pc = &poolClasses[index];
+    int keep;
+
+    assert ( pool_class_size ( index ) == size );
+
+    epicsMutexMustLock ( poolLock );
+    assert ( pc->nInUse > 0u );
+    pc->nInUse--;
+    keep = ! pc->nIdle ||
+        ( pc->nIdle + 1u ) * (size_t) size <= POOL_IDLE_BYTES;
+    if ( keep ) {
+        *(void **) buf = pc->idle;
+        pc->idle = buf;
+        pc->nIdle++;
+    }
+    epicsMutexUnlock ( poolLock );
+
+    if ( ! keep ) {
+        free ( buf );
+    }
+}
+
+void casBufStatsFetch ( size_t *pBytesInUse, size_t *pBytesIdle )
+{
+    size_t inUse = 0u, idle = 0u;
+    unsigned i;
+
+    if ( poolLock ) {
+        epicsMutexMustLock ( poolLock );
+        for ( i = 0u; i < POOL_CLASSES; i++ ) {
+            inUse += (size_t) poolClasses[i].nInUse * pool_class_size ( i );
+            idle += (size_t) poolClasses[i].nIdle * pool_class_size ( i );
+        }
+        epicsMutexUnlock ( poolLock );
+    }
+    *pBytesInUse = inUse;
+    *pBytesIdle = idle;
+}
+
+void rsrv_buf_pool_show ( unsigned level )
+{
+    size_t inUse, idle;
+    unsigned i;
+
+    if ( ! poolLock ) {
+        return;
+    }
+    casBufStatsFetch ( &inUse, &idle );
+    printf ( "Large buffers: %lu bytes in use, %lu bytes idle\n",
+        (unsigned long) inUse, (unsigned long) idle );
+
+    epicsMutexMustLock ( poolLock );
+    for ( i = 0u; i < POOL_CLASSES; i++ ) {
+        pool_class *pc = &poolClasses[i];
+
+        if ( ! pc->highWater && level == 0u ) {
+            continue;
+        }
+        printf ( "    %10u bytes: %u in use, %u idle, high water %u, "
+            "%lu allocated\n", pool_class_size ( i ), pc->nInUse,
+            pc->nIdle, pc->highWater, pc->nAlloc );
+    }
+    epicsMutexUnlock ( poolLock );
+}
@@ -30,23 +30,190 @@
 #include "caerr.h"
 #include "net_convert.h"
 
+#include "rsrv.h"
 #include "server.h"
 
+#if ! defined ( _WIN32 ) && ! defined ( vxWorks )
+#   include <sys/uio.h>
+#   define CAS_SENDMSG
+#endif
+
+#ifndef MSG_DONTWAIT
+#   define MSG_DONTWAIT 0
+#endif
+
+double rsrvCoalesceWindow = 0.0;
+
+void cas_release_send_segs ( struct client *pclient )
+{
+    unsigned i;
+
+    for ( i = 0u; i < pclient->nSendSegs; i++ ) {
+        cas_send_seg *pSeg = &pclient->sendSegs[i];
+        if ( pSeg->release ) {
+            pSeg->release ( pSeg->arg );
+        }
+    }
+    pclient->nSendSegs = 0u;
+}
+
 /*
- *  cas_send_bs_msg()
- *
- *  (channel access server send message)
- *
+ * One send() of the buffered bytes, or a gathered sendmsg() of the
+ * buffer interleaved with the segments
+ */
+static int cas_send_once ( struct client *pclient, int flags )
+{
+    unsigned nSegs = pclient->nSendSegs;
+
+    if ( ! nSegs ) {
+        return send ( pclient->sock, pclient->send.buf, pclient->send.stk,
+            flags );
+    }
+    else {
+#ifdef CAS_SENDMSG
+        struct iovec iov[2u * CAS_SEND_SEGS + 1u];
+        struct msghdr msg;
+        unsigned i, niov = 0u, pos = 0u;
+
+        for ( i = 0u; i < nSegs; i++ ) {
+            cas_send_seg *pSeg = &pclient->sendSegs[i];
+            if ( pSeg->offset > pos ) {
+                iov[niov].iov_base = &pclient->send.buf[pos];
+                iov[niov++].iov_len = pSeg->offset - pos;
+                pos = pSeg->offset;
+            }
+            iov[niov].iov_base = (void *) pSeg->pData;
+            iov[niov++].iov_len = pSeg->size;
+        }
+        if ( pclient->send.stk > pos ) {
+            iov[niov].iov_base = &pclient->send.buf[pos];
+            iov[niov++].iov_len = pclient->send.stk - pos;
+        }
+        memset ( &msg, 0, sizeof ( msg ) );
+        msg.msg_iov = iov;
+        msg.msg_iovlen = niov;
+        return sendmsg ( pclient->sock, &msg, flags );
+#else
+        /* no gather, send each piece in turn */
+        cas_send_seg *pSeg = &pclient->sendSegs[0];
+        if ( pSeg->offset ) {
+            return send ( pclient->sock, pclient->send.buf, pSeg->offset,
+                flags );
+        }
+        return send ( pclient->sock, pSeg->pData, pSeg->size, flags );
+#endif
+    }
+}
+
+/*
+ * Discard what was sent from the front of the buffer and segments
+ */
+static void cas_consume ( struct client *pclient, unsigned transferSize )
+{
+    unsigned bufDone = 0u, segsDone = 0u, i;
+
+    pclient->sendBytes += transferSize;
+
+    while ( transferSize ) {
+        unsigned gap, n;
+
+        if ( segsDone < pclient->nSendSegs ) {
+            gap = pclient->sendSegs[segsDone].offset - bufDone;
+        }
+        else {
+            gap = pclient->send.stk - bufDone;
+        }
+        n = transferSize < gap ? transferSize : gap;
+        bufDone += n;
+        transferSize -= n;
+
+        if ( transferSize && segsDone < pclient->nSendSegs ) {
+            cas_send_seg *pSeg = &pclient->sendSegs[segsDone];
+            n = transferSize < pSeg->size ? transferSize : pSeg->size;
+            pSeg->pData += n;
+            pSeg->size -= n;
+            transferSize -= n;
+            pclient->sendGathered += n;
+            if ( ! pSeg->size ) {
+                if ( pSeg->release ) {
+                    pSeg->release ( pSeg->arg );
+                }
+                segsDone++;
+            }
+        }
+        else {
+            assert ( ! transferSize );
+        }
+    }
+
+    if ( segsDone ) {
+        pclient->nSendSegs -= segsDone;
+        memmove ( pclient->sendSegs, &pclient->sendSegs[segsDone],
+            pclient->nSendSegs * sizeof ( pclient->sendSegs[0] ) );
+    }
+    if ( bufDone ) {
+        pclient->send.stk -= bufDone;
+        memmove ( pclient->send.buf, &pclient->send.buf[bufDone],
+            pclient->send.stk );
+        for ( i = 0u; i < pclient->nSendSegs; i++ ) {
+            pclient->sendSegs[i].offset -= bufDone;
+        }
+    }
+}
+
+/*
+ * Copy the segments into the send buffer so that more can be queued
+ * without sending.  Returns false if the buffer can't grow to hold them.
  *
- * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ * SEND_LOCK() must be held by the caller
  */
-void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+static int cas_flatten_send_segs ( struct client *pclient )
+{
+    unsigned total = 0u, end, i;
+
+    for ( i = 0u; i < pclient->nSendSegs; i++ ) {
+        total += pclient->sendSegs[i].size;
+    }
+    if ( total > pclient->send.maxstk - pclient->send.stk ) {
+        casExpandSendBuffer ( pclient, pclient->send.stk + total );
+        if ( total > pclient->send.maxstk - pclient->send.stk ) {
+            return FALSE;
+        }
+    }
+
+    /* from the last segment back, open its gap and fill it */
+    end = pclient->send.stk;
+    for ( i = pclient->nSendSegs; i-- > 0u; ) {
+        cas_send_seg *pSeg = &pclient->sendSegs[i];
+        char *pGap = &pclient->send.buf[pSeg->offset + total - pSeg->size];
+
+        memmove ( pGap + pSeg->size, &pclient->send.buf[pSeg->offset],
+            end - pSeg->offset );
+        memcpy ( pGap, pSeg->pData, pSeg->size );
+        end = pSeg->offset;
+        total -= pSeg->size;
+    }
+    for ( i = 0u; i < pclient->nSendSegs; i++ ) {
+        pclient->send.stk += pclient->sendSegs[i].size;
+    }
+    cas_release_send_segs ( pclient );
+    return TRUE;
+}
+
+/*
+ * With nowait set, send what the socket will take now and leave the
+ * rest queued
+ */
+static void cas_send_msg ( struct client *pclient, int lock_needed,
+    int nowait )
 {
+    unsigned used;
     int status;
 
     if ( lock_needed ) {
         SEND_LOCK ( pclient );
     }
+    used = pclient->send.stk;
 
     if ( CASDEBUG > 2 && pclient->send.stk ) {
         errlogPrintf ( "CAS: Sending a message of %d bytes\n", pclient->send.stk );
@@ -58,26 +225,23 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 (int)pclient->sock, (unsigned) pclient->addr.sin_addr.s_addr );
         }
         pclient->send.stk = 0u;
+        cas_release_send_segs ( pclient );
         if(lock_needed)
             SEND_UNLOCK(pclient);
         return;
     }
 
-    while ( pclient->send.stk && ! pclient->disconnect ) {
-        status = send ( pclient->sock, pclient->send.buf, pclient->send.stk, 0 );
+    while ( ( pclient->send.stk || pclient->nSendSegs ) &&
+            ! pclient->disconnect ) {
+        status = cas_send_once ( pclient, nowait ? MSG_DONTWAIT : 0 );
         if ( status >= 0 ) {
-            unsigned transferSize = (unsigned) status;
-            if ( transferSize >= pclient->send.stk ) {
-                pclient->send.stk = 0;
+            pclient->sendCalls++;
+            cas_consume ( pclient, (unsigned) status );
+            if ( ! pclient->send.stk && ! pclient->nSendSegs ) {
                 epicsTimeGetCurrent ( &pclient->time_at_last_send );
+                casShrinkSendBuffer ( pclient, used );
                 break;
             }
-            else {
-                unsigned bytesLeft = pclient->send.stk - transferSize;
-                memmove ( pclient->send.buf, &pclient->send.buf[transferSize],
-                    bytesLeft );
-                pclient->send.stk = bytesLeft;
-            }
         }
         else {
             int causeWasSocketHangup = 0;
@@ -86,6 +250,7 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
 
             if ( pclient->disconnect ) {
                 pclient->send.stk = 0u;
+                cas_release_send_segs ( pclient );
                 break;
             }
 
@@ -93,6 +258,11 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
                 continue;
             }
 
+            if ( nowait && ( anerrno == SOCK_EWOULDBLOCK ||
+                    anerrno == SOCK_ENOBUFS ) ) {
+                break;
+            }
+
             if ( anerrno == SOCK_ENOBUFS ) {
                 errlogPrintf (
                     "CAS: Out of network buffers, retrying send in 15 seconds\n" );
@@ -118,6 +288,7 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
             }
             pclient->disconnect = TRUE;
             pclient->send.stk = 0u;
+            cas_release_send_segs ( pclient );
 
             /*
              * wakeup the receive thread
@@ -164,6 +335,67 @@ void cas_send_bs_msg ( struct client *pclient, int lock_needed )
     return;
 }
 
+/*
+ *  cas_send_bs_msg()
+ *
+ *  (channel access server send message)
+ *
+ *  Doesn't wait when called from an epoll worker, cf. caspoll.c
+ *
+ * Set lock_needed=1 unless SEND_LOCK() is held by caller
+ */
+void cas_send_bs_msg ( struct client *pclient, int lock_needed )
+{
+    cas_send_msg ( pclient, lock_needed, rsrv_poll_in_worker () );
+}
+
+/*
+ *  cas_send_event_msg()
+ *
+ *  Flush after the event queue has drained.  With rsrvCoalesceWindow
+ *  set, small updates arriving within the window of the last send are
+ *  left in the buffer for the flush timer to send together.
+ *
+ *  SEND_LOCK() must be held by the caller
+ */
+void cas_send_event_msg ( struct client *pclient )
+{
+    epicsTimeStamp now;
+    double since;
+
+    if ( ! pclient->flushTimer || pclient->nSendSegs ||
+            pclient->send.stk >= pclient->send.maxstk / 2u ) {
+        cas_send_bs_msg ( pclient, FALSE );
+        return;
+    }
+    if ( pclient->flushPending || ! pclient->send.stk ) {
+        return;
+    }
+
+    epicsTimeGetCurrent ( &now );
+    since = epicsTimeDiffInSeconds ( &now, &pclient->time_at_last_send );
+    if ( since < 0.0 || since >= rsrvCoalesceWindow ) {
+        cas_send_bs_msg ( pclient, FALSE );
+        return;
+    }
+
+    pclient->flushPending = TRUE;
+    pclient->sendDeferred++;
+    epicsTimerStartDelay ( pclient->flushTimer, rsrvCoalesceWindow - since );
+}
+
+void cas_flush_timer ( void *pParm )
+{
+    struct client *pclient = ( struct client * ) pParm;
+
+    SEND_LOCK ( pclient );
+    if ( pclient->flushPending ) {
+        pclient->flushPending = FALSE;
+        cas_send_bs_msg ( pclient, FALSE );
+    }
+    SEND_UNLOCK ( pclient );
+}
+
 /*
  *  cas_send_dg_msg()
  *
@@ -200,8 +432,13 @@ void cas_send_dg_msg ( struct client * pclient )
         sizeDG -= sizeof (caHdr);
     }
 
-    status = sendto ( pclient->sock, pDG, sizeDG, 0,
-       (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
+    if ( pclient->pDgBatch ) {
+        status = cas_dg_batch_send ( pclient, pDG, sizeDG );
+    }
+    else {
+        status = sendto ( pclient->sock, pDG, sizeDG, 0,
+           (struct sockaddr *)&pclient->addr, sizeof(pclient->addr) );
+    }
     if ( status >= 0 ) {
         if ( status >= sizeDG ) {
             epicsTimeGetCurrent ( &pclient->time_at_last_send );
@@ -247,10 +484,11 @@ void cas_send_dg_msg ( struct client * pclient )
  *  Returns a valid ptr to message body or NULL if the msg
  *  will not fit.
  */
-int cas_copy_in_header (
+static int cas_alloc_header (
     struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
     ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
-    ca_uint32_t responseSpecific, void **ppPayload )
+    ca_uint32_t responseSpecific, ca_uint32_t bufferedSize,
+    void **ppPayload )
 {
     unsigned    msgSize;
     ca_uint32_t alignedPayloadSize;
@@ -262,7 +500,7 @@ int cas_copy_in_header (
 
     alignedPayloadSize = CA_MESSAGE_ALIGN ( payloadSize );
 
-    msgSize = alignedPayloadSize + sizeof ( caHdr );
+    msgSize = CA_MESSAGE_ALIGN ( bufferedSize ) + sizeof ( caHdr );
     if ( alignedPayloadSize >= 0xffff || nElem >= 0xffff ) {
         if ( ! CA_V49 ( pclient->minor_version_number ) ) {
             return ECA_16KARRAYCLIENT;
@@ -270,16 +508,16 @@ int cas_copy_in_header (
         msgSize += 2 * sizeof ( ca_uint32_t );
     }
 
-    if ( msgSize > pclient->send.maxstk ) {
-        casExpandSendBuffer ( pclient, msgSize );
-        if ( msgSize > pclient->send.maxstk ) {
-            return ECA_TOLARGE;
-        }
+    if ( msgSize > pclient->send.maxstk && pclient->proto != IPPROTO_TCP ) {
+        return ECA_TOLARGE;
     }
 
-    if ( pclient->send.stk > pclient->send.maxstk - msgSize ) {
+    /* flush before expanding, which a flush may undo */
+    if ( msgSize > pclient->send.maxstk ||
+            pclient->send.stk > pclient->send.maxstk - msgSize ) {
         if ( pclient->disconnect ) {
             pclient->send.stk = 0;
+            cas_release_send_segs ( pclient );
         }
         else{
             if ( pclient->proto == IPPROTO_TCP) {
@@ -294,6 +532,24 @@ int cas_copy_in_header (
         }
     }
 
+    /* an epoll worker's flush may leave data, grow past it and only
+     * wait for the send if that fails, which a worker must not */
+    if ( pclient->proto == IPPROTO_TCP &&
+            msgSize > pclient->send.maxstk - pclient->send.stk ) {
+        casExpandSendBuffer ( pclient, pclient->send.stk + msgSize );
+        if ( msgSize > pclient->send.maxstk - pclient->send.stk &&
+                pclient->send.stk && ! rsrv_poll_in_worker () ) {
+            cas_send_msg ( pclient, FALSE, FALSE );
+            if ( msgSize > pclient->send.maxstk ) {
+                casExpandSendBuffer ( pclient, msgSize );
+            }
+        }
+    }
+    if ( msgSize > pclient->send.maxstk ||
+            pclient->send.stk > pclient->send.maxstk - msgSize ) {
+        return ECA_TOLARGE;
+    }
+
     pMsg = (caHdr *) &pclient->send.buf[pclient->send.stk];
     pMsg->m_cmmd = htons(response);
     pMsg->m_dataType = htons(dataType);
@@ -315,14 +571,55 @@ int cas_copy_in_header (
             *ppPayload = (void *) (pW32 + 2);
     }
 
+    return ECA_NORMAL;
+}
+
+int cas_copy_in_header (
+    struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
+    ca_uint32_t responseSpecific, void **ppPayload )
+{
+    int status = cas_alloc_header ( pclient, response, payloadSize,
+        dataType, nElem, cid, responseSpecific, payloadSize, ppPayload );
+
     /* zero out pad bytes */
-    if ( alignedPayloadSize > payloadSize ) {
+    if ( status == ECA_NORMAL &&
+            CA_MESSAGE_ALIGN ( payloadSize ) > payloadSize ) {
         char *p = ( char * ) *ppPayload;
         memset ( p + payloadSize, '\0',
-            alignedPayloadSize - payloadSize );
+            CA_MESSAGE_ALIGN ( payloadSize ) - payloadSize );
     }
 
-    return ECA_NORMAL;
+    return status;
+}
+
+/*
+ *  cas_copy_in_header_ext()
+ *
+ *  As cas_copy_in_header(), but only the header and pad bytes are
+ *  buffered.  The payload is passed to cas_commit_msg_ext() and sent
+ *  from where it is.  TCP only.
+ */
+int cas_copy_in_header_ext (
+    struct client *pclient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
+    ca_uint32_t responseSpecific )
+{
+    if ( pclient->proto != IPPROTO_TCP ) {
+        return ECA_INTERNAL;
+    }
+    if ( pclient->nSendSegs >= CAS_SEND_SEGS ) {
+        cas_send_bs_msg ( pclient, FALSE );
+    }
+    if ( pclient->nSendSegs >= CAS_SEND_SEGS &&
+            ! cas_flatten_send_segs ( pclient ) ) {
+        if ( rsrv_poll_in_worker () ) {
+            return ECA_TOLARGE;
+        }
+        cas_send_msg ( pclient, FALSE, FALSE );
+    }
+    return cas_alloc_header ( pclient, response, payloadSize,
+        dataType, nElem, cid, responseSpecific, 8u, NULL );
 }
 
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t cid )
@@ -365,6 +662,51 @@ void cas_commit_msg ( struct client *pClient, ca_uint32_t size )
     pClient->send.stk += size;
 }
 
+/*
+ * Commit a message started with cas_copy_in_header_ext().  The size
+ * bytes at pData must stay valid until release(arg) is called, which
+ * happens once they are sent or the client disconnects.
+ */
+void cas_commit_msg_ext ( struct client *pClient, const void *pData,
+    ca_uint32_t size, void ( *release ) ( void * ), void *arg )
+{
+    caHdr * pMsg = ( caHdr * ) &pClient->send.buf[pClient->send.stk];
+    ca_uint32_t alignedSize = CA_MESSAGE_ALIGN ( size );
+    unsigned hdrSize = sizeof ( caHdr );
+    cas_send_seg *pSeg;
+
+    if ( pMsg->m_postsize == htons ( 0xffff ) ) {
+        ca_uint32_t * pLW = ( ca_uint32_t * ) ( pMsg + 1 );
+        assert ( alignedSize <= ntohl ( *pLW ) );
+        pLW[0] = htonl ( alignedSize );
+        hdrSize += 2 * sizeof ( *pLW );
+    }
+    else {
+        assert ( alignedSize <= ntohs ( pMsg->m_postsize ) );
+        pMsg->m_postsize = htons ( (ca_uint16_t) alignedSize );
+    }
+    assert ( pClient->nSendSegs < CAS_SEND_SEGS );
+
+    if ( ! size ) {
+        pClient->send.stk += hdrSize;
+        if ( release ) {
+            release ( arg );
+        }
+        return;
+    }
+
+    pSeg = &pClient->sendSegs[pClient->nSendSegs++];
+    pSeg->offset = pClient->send.stk + hdrSize;
+    pSeg->pData = ( const char * ) pData;
+    pSeg->size = size;
+    pSeg->release = release;
+    pSeg->arg = arg;
+
+    /* pad bytes follow the segment */
+    memset ( &pClient->send.buf[pSeg->offset], '\0', alignedSize - size );
+    pClient->send.stk = pSeg->offset + alignedSize - size;
+}
+
 /*
  * this assumes that we have already checked to see
  * if sufficent bytes are available
@@ -23,11 +23,13 @@
 #include <errno.h>
 
 #include "addrList.h"
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMutex.h"
 #include "epicsSignal.h"
 #include "epicsStdio.h"
 #include "epicsTime.h"
+#include "epicsTimer.h"
 #include "errlog.h"
 #include "freeList.h"
 #include "osiPoolStatus.h"
@@ -56,7 +58,7 @@ epicsThreadPrivateId rsrvCurrentClient;
  *  CA server task
  *
  *  Waits for connections at the CA port and spawns a task to
- *  handle each of them
+ *  handle each of them, or hands them to the epoll workers
  *
  */
 static void req_server (void *pParm)
@@ -106,6 +108,18 @@ static void req_server (void *pParm)
             ellAdd ( &clientQ, &pClient->node );
             UNLOCK_CLIENTQ;
 
+            if ( rsrv_poll_workers () ) {
+                if ( rsrv_poll_add ( pClient ) != RSRV_OK ) {
+                    LOCK_CLIENTQ;
+                    ellDelete ( &clientQ, &pClient->node );
+                    UNLOCK_CLIENTQ;
+                    destroy_tcp_client ( pClient );
+                    errlogPrintf ( "CAS: epoll registration for new client failed\n" );
+                    epicsThreadSleep ( 15.0 );
+                }
+                continue;
+            }
+
             id = epicsThreadCreate ( "CAS-client", epicsThreadPriorityCAServerLow,
                     epicsThreadGetStackSize ( epicsThreadStackBig ),
                     camsgtask, pClient );
@@ -466,6 +480,33 @@ void rsrv_build_addr_lists(void)
     }
 }
 
+/*
+ * Start the cast_server() threads for one socket, which share it
+ */
+static void rsrv_start_udp(rsrv_iface_config *conf, const char *name)
+{
+    int i;
+
+    epicsThreadMustCreate(name, threadPrios[4],
+            epicsThreadGetStackSize(epicsThreadStackMedium),
+            &cast_server, conf);
+
+    epicsEventMustWait(casudp_startStopEvent);
+
+    conf->startextra = 1;
+    for (i = 1; i < rsrvSearchThreads; i++) {
+        char extra[32];
+
+        epicsSnprintf(extra, sizeof(extra), "%s-%d", name, i);
+        epicsThreadMustCreate(extra, threadPrios[4],
+                epicsThreadGetStackSize(epicsThreadStackMedium),
+                &cast_server, conf);
+
+        epicsEventMustWait(casudp_startStopEvent);
+    }
+    conf->startextra = 0;
+}
+
 /*
  * rsrv_init ()
  */
@@ -535,16 +576,30 @@ void rsrv_init (void)
     if(envGetBoolConfigParam(&EPICS_CA_AUTO_ARRAY_BYTES, &autoMaxBytes))
         autoMaxBytes = 1;
 
-    if (!autoMaxBytes)
-        freeListInitPvt ( &rsrvLargeBufFreeListTCP, rsrvSizeofLargeBufTCP, 1 );
-    else
-        rsrvLargeBufFreeListTCP = NULL;
+    if ( rsrv_buf_pool_init ( autoMaxBytes ? 0u : rsrvSizeofLargeBufTCP ) ) {
+        cantProceed ( "RSRV failed to allocate large buffer pool\n" );
+    }
     pCaBucket = bucketCreate(CAS_HASH_TABLE_SIZE);
     if (!pCaBucket)
         cantProceed("RSRV failed to allocate ID lookup table\n");
 
     rsrv_build_addr_lists();
 
+    if ( rsrvPollWorkers > 0 &&
+            rsrv_poll_init ( (unsigned) rsrvPollWorkers ) != RSRV_OK ) {
+        errlogPrintf ( "CAS: epoll workers not available, "
+            "using a thread per client\n" );
+    }
+
+    if ( rsrvCoalesceWindow > 0.0 ) {
+        rsrvTimerQueue = epicsTimerQueueAllocate (
+            1, epicsThreadPriorityCAServerLow );
+        if ( ! rsrvTimerQueue ) {
+            errlogPrintf ( "CAS: no timer queue, "
+                "monitor updates will not be coalesced\n" );
+        }
+    }
+
     castcp_startStopEvent = epicsEventMustCreate(epicsEventEmpty);
     casudp_startStopEvent = epicsEventMustCreate(epicsEventEmpty);
     beacon_startStopEvent = epicsEventMustCreate(epicsEventEmpty);
@@ -721,21 +776,13 @@ void rsrv_init (void)
 
             epicsEventMustWait(castcp_startStopEvent);
 
-            epicsThreadMustCreate("CAS-UDP", threadPrios[4],
-                    epicsThreadGetStackSize(epicsThreadStackMedium),
-                    &cast_server, conf);
-
-            epicsEventMustWait(casudp_startStopEvent);
+            rsrv_start_udp(conf, "CAS-UDP");
 
 #if !(defined(_WIN32) || defined(__CYGWIN__))
             if(conf->udpbcast != INVALID_SOCKET) {
                 conf->startbcast = 1;
 
-                epicsThreadMustCreate("CAS-UDP2", threadPrios[4],
-                        epicsThreadGetStackSize(epicsThreadStackMedium),
-                        &cast_server, conf);
-
-                epicsEventMustWait(casudp_startStopEvent);
+                rsrv_start_udp(conf, "CAS-UDP2");
 
                 conf->startbcast = 0;
             }
@@ -780,6 +827,12 @@ void rsrv_pause (void)
     castcp_ctl = ctlPause;
 }
 
+static
+void rsrv_stop (void)
+{
+    rsrv_poll_stop ();
+}
+
 static unsigned countChanListBytes (
     struct client *client, ELLLIST * pList )
 {
@@ -850,6 +903,17 @@ static void log_one_client (struct client *client, unsigned level)
         client->priority,
         n, n == 1 ? "" : "s" );
 
+    if ( level >= 2u && client->proto == IPPROTO_TCP ) {
+        epicsUInt64 calls = client->sendCalls;
+        printf ( "\tSent %llu bytes in %llu calls (%.0f bytes/call), "
+            "%llu gathered, %llu flushes deferred\n",
+            (unsigned long long) client->sendBytes,
+            (unsigned long long) calls,
+            calls ? (double) client->sendBytes / calls : 0.0,
+            (unsigned long long) client->sendGathered,
+            (unsigned long long) client->sendDeferred );
+    }
+
     if ( level >= 3u ) {
         double         send_delay;
         double         recv_delay;
@@ -970,6 +1034,19 @@ void casr (unsigned level)
 
             iface = (rsrv_iface_config *) ellNext(&iface->node);
         }
+        if (rsrvSearchThreads > 1)
+            printf("%d threads for each CAS-UDP name server\n",
+                rsrvSearchThreads);
+        printf("Name searches: %lu found, %lu rejected by the name filter, "
+            "%lu more not found\n",
+            (unsigned long) epicsAtomicGetSizeT(&rsrvSearchFound),
+            (unsigned long) epicsAtomicGetSizeT(&rsrvSearchFiltered),
+            (unsigned long) epicsAtomicGetSizeT(&rsrvSearchMissed));
+        rsrv_poll_show ( level - 1 );
+    }
+
+    if (level>=2) {
+        rsrv_buf_pool_show ( level - 2 );
     }
 
     if (level>=1) {
@@ -1027,10 +1104,6 @@ void casr (unsigned level)
                     freeListItemsAvail (rsrvEventFreeList);
         bytes_reserved += MAX_TCP *
                     freeListItemsAvail ( rsrvSmallBufFreeListTCP );
-        if(rsrvLargeBufFreeListTCP) {
-            bytes_reserved += rsrvSizeofLargeBufTCP *
-                        freeListItemsAvail ( rsrvLargeBufFreeListTCP );
-        }
         bytes_reserved += rsrvSizeOfPutNotify ( 0 ) *
                     freeListItemsAvail ( rsrvPutNotifyFreeList );
         printf( "Free-lists total %u bytes, comprising\n",
@@ -1040,11 +1113,9 @@ void casr (unsigned level)
             (unsigned int) freeListItemsAvail ( rsrvChanFreeList ),
             (unsigned int) freeListItemsAvail ( rsrvEventFreeList ),
             (unsigned int) freeListItemsAvail ( rsrvPutNotifyFreeList ));
-        printf( "    %u small (%u byte) buffers, %u jumbo (%u byte) buffers\n",
+        printf( "    %u small (%u byte) buffers\n",
             (unsigned int) freeListItemsAvail ( rsrvSmallBufFreeListTCP ),
-            MAX_TCP,
-            (unsigned int)(rsrvLargeBufFreeListTCP ? freeListItemsAvail ( rsrvLargeBufFreeListTCP ) : -1),
-            rsrvSizeofLargeBufTCP );
+            MAX_TCP );
         printf( "Server resource id table:\n");
         LOCK_CLIENTQ;
         bucketShow (pCaBucket);
@@ -1065,20 +1136,25 @@ void destroy_client ( struct client *client )
         taskwdRemove ( client->tid );
     }
 
+    if ( client->flushTimer ) {
+        /* waits for an expiration in progress */
+        epicsTimerQueueDestroyTimer ( rsrvTimerQueue, client->flushTimer );
+        client->flushTimer = NULL;
+    }
+
     if ( client->sock != INVALID_SOCKET ) {
         epicsSocketDestroy ( client->sock );
     }
 
+    cas_release_send_segs ( client );
+
     if ( client->proto == IPPROTO_TCP ) {
         if ( client->send.buf ) {
             if ( client->send.type == mbtSmallTCP ) {
                 freeListFree ( rsrvSmallBufFreeListTCP,  client->send.buf );
             }
             else if ( client->send.type == mbtLargeTCP ) {
-                if(rsrvLargeBufFreeListTCP)
-                    freeListFree ( rsrvLargeBufFreeListTCP,  client->send.buf );
-                else
-                    free(client->send.buf);
+                rsrv_buf_free ( client->send.buf, client->send.maxstk );
             }
             else {
                 errlogPrintf ( "CAS: Corrupt send buffer free list type code=%u during client cleanup?\n",
@@ -1090,10 +1166,7 @@ void destroy_client ( struct client *client )
                 freeListFree ( rsrvSmallBufFreeListTCP,  client->recv.buf );
             }
             else if ( client->recv.type == mbtLargeTCP ) {
-                if(rsrvLargeBufFreeListTCP)
-                    freeListFree ( rsrvLargeBufFreeListTCP,  client->recv.buf );
-                else
-                    free(client->recv.buf);
+                rsrv_buf_free ( client->recv.buf, client->recv.maxstk );
             }
             else {
                 errlogPrintf ( "CAS: Corrupt recv buffer free list type code=%u during client cleanup?\n",
@@ -1327,74 +1400,74 @@ void casAttachThreadToClient ( struct client *pClient )
 static
 void casExpandBuffer ( struct message_buffer *buf, ca_uint32_t size, int sendbuf )
 {
-    char *newbuf = NULL;
+    char *newbuf;
     unsigned newsize;
-    enum messageBufferType newtype;
 
     assert (size > MAX_TCP);
 
     if ( size <= buf->maxstk || buf->type == mbtUDP ) return;
 
     /* try to alloc new buffer */
-    if (size <= MAX_TCP) {
-        return; /* shouldn't happen */
+    newbuf = rsrv_buf_alloc ( size, &newsize );
+    if ( ! newbuf ) return;
 
-    } else if(!rsrvLargeBufFreeListTCP) {
-        // round up to multiple of 4K
-        size = ((size-1)|0xfff)+1;
+    /* copy existing buffer */
+    if (sendbuf) {
+        /* send buffer uses [0, stk) */
+        memcpy ( newbuf, buf->buf, buf->stk );
+    } else {
+        /* recv buffer uses [stk, cnt) */
+        unsigned used;
+        assert ( buf->cnt >= buf->stk );
+        used = buf->cnt - buf->stk;
 
-        if (buf->type==mbtLargeTCP) {
-            newbuf = realloc (buf->buf, size);
-            if(newbuf)
-                buf->buf = newbuf;
-        } else {
-            newbuf = malloc (size);
-        }
-        newtype = mbtLargeTCP;
-        newsize = size;
+        memcpy ( newbuf, &buf->buf[buf->stk], used );
 
-    } else if (size <= rsrvSizeofLargeBufTCP) {
-        newbuf = freeListCalloc ( rsrvLargeBufFreeListTCP );
-        newsize = rsrvSizeofLargeBufTCP;
-        newtype = mbtLargeTCP;
+        buf->cnt = used;
+        buf->stk = 0;
     }
 
-    if (newbuf) {
-        /* copy existing buffer */
-        if (sendbuf) {
-            /* send buffer uses [0, stk) */
-            if (!rsrvLargeBufFreeListTCP && buf->type==mbtLargeTCP) {
-                /* realloc already copied */
-            } else {
-                memcpy ( newbuf, buf->buf, buf->stk );
-            }
-        } else {
-            /* recv buffer uses [stk, cnt) */
-            unsigned used;
-            assert ( buf->cnt >= buf->stk );
-            used = buf->cnt - buf->stk;
-
-            /* buf->buf may be the same as newbuf if realloc() used */
-            memmove ( newbuf, &buf->buf[buf->stk], used );
+    /* free existing buffer */
+    if(buf->type==mbtSmallTCP) {
+        freeListFree ( rsrvSmallBufFreeListTCP,  buf->buf );
+    } else {
+        rsrv_buf_free ( buf->buf, buf->maxstk );
+    }
 
-            buf->cnt = used;
-            buf->stk = 0;
+    buf->buf = newbuf;
+    buf->type = mbtLargeTCP;
+    buf->maxstk = newsize;
+    epicsTimeGetCurrent ( &buf->lastLarge );
+}
 
-        }
+/*
+ * Return an empty large buffer to the pool once it has not been needed
+ * for a while.  used is what the buffer held before it emptied, and now
+ * is the time it emptied.
+ */
+static
+void casShrinkBuffer ( struct message_buffer *buf, unsigned used,
+    const epicsTimeStamp *now )
+{
+    char *newbuf;
 
-        /* free existing buffer */
-        if(buf->type==mbtSmallTCP) {
-            freeListFree ( rsrvSmallBufFreeListTCP,  buf->buf );
-        } else if(rsrvLargeBufFreeListTCP && buf->type==mbtLargeTCP) {
-            freeListFree ( rsrvLargeBufFreeListTCP,  buf->buf );
-        } else {
-            /* realloc() already free()'d if necessary */
-        }
+    if ( buf->type != mbtLargeTCP ) return;
 
-        buf->buf = newbuf;
-        buf->type = newtype;
-        buf->maxstk = newsize;
+    if ( used > MAX_TCP ) {
+        buf->lastLarge = *now;
+        return;
     }
+    if ( epicsTimeDiffInSeconds ( now, &buf->lastLarge ) < CAS_SHRINK_DELAY ) {
+        return;
+    }
+
+    newbuf = freeListMalloc ( rsrvSmallBufFreeListTCP );
+    if ( ! newbuf ) return;
+
+    rsrv_buf_free ( buf->buf, buf->maxstk );
+    buf->buf = newbuf;
+    buf->type = mbtSmallTCP;
+    buf->maxstk = MAX_TCP;
 }
 
 void casExpandSendBuffer ( struct client *pClient, ca_uint32_t size )
@@ -1407,6 +1480,20 @@ void casExpandRecvBuffer ( struct client *pClient, ca_uint32_t size )
     casExpandBuffer (&pClient->recv, size, 0);
 }
 
+/* send lock must be held, the buffer empty and time_at_last_send current */
+void casShrinkSendBuffer ( struct client *pClient, unsigned used )
+{
+    assert ( ! pClient->send.stk && ! pClient->nSendSegs );
+    casShrinkBuffer (&pClient->send, used, &pClient->time_at_last_send);
+}
+
+/* receive buffer must be empty and time_at_last_recv current */
+void casShrinkRecvBuffer ( struct client *pClient, unsigned used )
+{
+    assert ( pClient->recv.cnt == 0u );
+    casShrinkBuffer (&pClient->recv, used, &pClient->time_at_last_recv);
+}
+
 /*
  *  create_tcp_client ()
  */
@@ -1513,6 +1600,11 @@ struct client *create_tcp_client (SOCKET sock , const osiSockAddr *peerAddr)
         }
     }
 
+    if ( rsrvTimerQueue ) {
+        client->flushTimer = epicsTimerQueueCreateTimer ( rsrvTimerQueue,
+            cas_flush_timer, client );
+    }
+
     status = db_start_events ( client->evuser, "CAS-event",
                 NULL, NULL, priorityOfEvents );
     if ( status != DB_EVENT_OK ) {
@@ -1560,7 +1652,8 @@ static dbServer rsrv_server = {
     casClientInitiatingCurrentThread,
     rsrv_init,
     rsrv_run,
-    rsrv_pause
+    rsrv_pause,
+    rsrv_stop
 };
 
 void rsrv_register_server(void)
@@ -0,0 +1,413 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS Base is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ *  CA server TCP input serviced by a fixed pool of epoll workers
+ *  instead of one camsgtask() thread per client (Linux only).
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsMutex.h"
+#include "epicsSignal.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "errlog.h"
+#include "osiSock.h"
+#include "taskwd.h"
+
+#include "db_access.h"
+#include "rsrv.h"
+#include "server.h"
+
+int rsrvPollWorkers = 0;
+
+#if defined(__linux__)
+
+#include <unistd.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+
+#define POLL_EVENTS 64
+
+typedef struct {
+    int             epfd;
+    int             wakefd;     /* eventfd, stopping or clients to drop */
+    epicsThreadId   tid;
+    int             nclients;   /* for load balancing */
+    epicsMutexId    dropLock;
+    struct client   *dropList;  /* failed to resume, guarded by dropLock */
+} poll_worker;
+
+static poll_worker *pollWorkers;
+static unsigned nPollWorkers;
+static int pollStop;
+static epicsThreadPrivateId pollWorkerSelf;
+
+/*
+ *  rsrv_poll_park()
+ *
+ *  Hand a client whose output can not go out now to its event task.
+ *  Its input is not serviced until rsrv_extra_labor() has flushed and
+ *  called rsrv_poll_resume(), so the worker never waits on a slow client.
+ */
+static void rsrv_poll_park ( poll_worker *pw, struct client *client )
+{
+    epoll_ctl ( pw->epfd, EPOLL_CTL_DEL, client->sock, NULL );
+    epicsAtomicSetIntT ( &client->pollParked, 1 );
+    db_post_extra_labor ( client->evuser );
+}
+
+static void poll_drop ( poll_worker *pw, struct client *client )
+{
+    epoll_ctl ( pw->epfd, EPOLL_CTL_DEL, client->sock, NULL );
+    epicsAtomicDecrIntT ( &pw->nclients );
+
+    LOCK_CLIENTQ;
+    ellDelete ( &clientQ, &client->node );
+    UNLOCK_CLIENTQ;
+
+    epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+    destroy_tcp_client ( client );
+}
+
+/*
+ *  rsrv_poll_task()
+ *
+ *  Services the input of the clients assigned to one worker
+ */
+static void rsrv_poll_task ( void *pParm )
+{
+    poll_worker *pw = (poll_worker *) pParm;
+    struct epoll_event events[POLL_EVENTS];
+
+    epicsSignalInstallSigAlarmIgnore ();
+    epicsSignalInstallSigPipeIgnore ();
+    taskwdInsert ( epicsThreadGetIdSelf (), NULL, NULL );
+    epicsThreadPrivateSet ( pollWorkerSelf, pw );
+
+    while ( ! epicsAtomicGetIntT ( &pollStop ) ) {
+        int i, n;
+
+        n = epoll_wait ( pw->epfd, events, POLL_EVENTS, -1 );
+        if ( n < 0 ) {
+            char sockErrBuf[64];
+
+            if ( errno == EINTR ) {
+                continue;
+            }
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            errlogPrintf ( "CAS: epoll_wait " ERL_ERROR ": %s\n",
+                sockErrBuf );
+            epicsThreadSleep ( 1.0 );
+            continue;
+        }
+
+        for ( i = 0; i < n; i++ ) {
+            struct client *client = (struct client *) events[i].data.ptr;
+            unsigned space;
+            long nchars;
+
+            if ( ! client ) {
+                /* wakefd, rsrv_poll_stop() or rsrv_poll_resume() */
+                epicsUInt64 count;
+                struct client *pDrop;
+
+                if ( read ( pw->wakefd, &count, sizeof ( count ) ) < 0 ) {
+                    count = 0u;
+                }
+                epicsMutexMustLock ( pw->dropLock );
+                pDrop = pw->dropList;
+                pw->dropList = NULL;
+                epicsMutexUnlock ( pw->dropLock );
+                while ( pDrop ) {
+                    struct client *pNext = pDrop->pollDropNext;
+                    poll_drop ( pw, pDrop );
+                    pDrop = pNext;
+                }
+                continue;
+            }
+
+            /* the event task holds the send lock while it sends,
+             * possibly to this client, so leave it the replies too */
+            if ( epicsMutexTryLock ( client->lock ) != epicsMutexLockOK ) {
+                rsrv_poll_park ( pw, client );
+                continue;
+            }
+            SEND_UNLOCK ( client );
+
+            epicsThreadPrivateSet ( rsrvCurrentClient, client );
+            space = client->recv.maxstk - client->recv.cnt;
+
+            nchars = camsg_recv ( client, MSG_DONTWAIT );
+            if ( nchars < 0 || castcp_ctl != ctlRun || client->disconnect ) {
+                poll_drop ( pw, client );
+                continue;
+            }
+            if ( client->pollBackoff ) {
+                rsrv_poll_park ( pw, client );
+                continue;
+            }
+
+            /*
+             * allow message to batch up if more are coming,
+             * epoll reports the socket again while data remains.
+             * Sends from here do not wait, what the socket will not
+             * take now is left for the event task.
+             */
+            if ( (unsigned long) nchars < space ) {
+                SEND_LOCK ( client );
+                cas_send_bs_msg ( client, FALSE );
+                if ( client->send.stk || client->nSendSegs ) {
+                    rsrv_poll_park ( pw, client );
+                }
+                SEND_UNLOCK ( client );
+            }
+        }
+        epicsThreadPrivateSet ( rsrvCurrentClient, NULL );
+    }
+    taskwdRemove ( 0 );
+}
+
+int rsrv_poll_init ( unsigned nWorkers )
+{
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    unsigned i;
+
+    if ( nWorkers == 0u ) {
+        return RSRV_OK;
+    }
+
+    pollWorkers = calloc ( nWorkers, sizeof ( *pollWorkers ) );
+    pollWorkerSelf = epicsThreadPrivateCreate ();
+    if ( ! pollWorkers || ! pollWorkerSelf ) {
+        free ( pollWorkers );
+        pollWorkers = NULL;
+        return RSRV_ERROR;
+    }
+
+    opts.priority = epicsThreadPriorityCAServerLow;
+    opts.stackSize = epicsThreadGetStackSize ( epicsThreadStackBig );
+    opts.joinable = 1;
+
+    for ( i = 0u; i < nWorkers; i++ ) {
+        poll_worker *pw = &pollWorkers[i];
+        struct epoll_event ev;
+        char name[32];
+
+        pw->dropLock = epicsMutexCreate ();
+        if ( ! pw->dropLock ) {
+            break;
+        }
+        pw->epfd = epoll_create1 ( EPOLL_CLOEXEC );
+        if ( pw->epfd < 0 ) {
+            epicsMutexDestroy ( pw->dropLock );
+            break;
+        }
+        pw->wakefd = eventfd ( 0, EFD_CLOEXEC | EFD_NONBLOCK );
+        memset ( &ev, 0, sizeof ( ev ) );
+        ev.events = EPOLLIN;
+        ev.data.ptr = NULL;
+        if ( pw->wakefd < 0 ||
+                epoll_ctl ( pw->epfd, EPOLL_CTL_ADD, pw->wakefd, &ev ) ) {
+            if ( pw->wakefd >= 0 ) {
+                close ( pw->wakefd );
+            }
+            close ( pw->epfd );
+            epicsMutexDestroy ( pw->dropLock );
+            break;
+        }
+        epicsSnprintf ( name, sizeof ( name ), "CAS-poll-%u", i );
+        pw->tid = epicsThreadCreateOpt ( name, rsrv_poll_task, pw, &opts );
+        if ( ! pw->tid ) {
+            close ( pw->wakefd );
+            close ( pw->epfd );
+            epicsMutexDestroy ( pw->dropLock );
+            break;
+        }
+    }
+
+    if ( i == 0u ) {
+        free ( pollWorkers );
+        pollWorkers = NULL;
+        return RSRV_ERROR;
+    }
+    /* run with the workers we have */
+    nPollWorkers = i;
+    return RSRV_OK;
+}
+
+/*
+ *  rsrv_poll_stop()
+ *
+ *  Wake and join the workers.  Their clients are left as they are.
+ *  The epoll sets stay open, an event task may still resume a parked
+ *  client into one.  A client that then fails to resume is left on
+ *  the drop list.
+ */
+void rsrv_poll_stop ( void )
+{
+    unsigned i;
+
+    if ( ! nPollWorkers ) {
+        return;
+    }
+    epicsAtomicSetIntT ( &pollStop, 1 );
+    for ( i = 0u; i < nPollWorkers; i++ ) {
+        epicsUInt64 one = 1u;
+        if ( write ( pollWorkers[i].wakefd, &one, sizeof ( one ) ) !=
+                sizeof ( one ) ) {
+            errlogPrintf ( "CAS: unable to wake epoll worker %u\n", i );
+        }
+    }
+    for ( i = 0u; i < nPollWorkers; i++ ) {
+        epicsThreadMustJoin ( pollWorkers[i].tid );
+    }
+    nPollWorkers = 0u;
+}
+
+unsigned rsrv_poll_workers ( void )
+{
+    return nPollWorkers;
+}
+
+/*
+ *  rsrv_poll_in_worker()
+ *
+ *  True when called by an epoll worker, whose sends must not wait
+ */
+int rsrv_poll_in_worker ( void )
+{
+    return pollWorkerSelf && epicsThreadPrivateGet ( pollWorkerSelf );
+}
+
+/*
+ *  rsrv_poll_resume()
+ *
+ *  Service the input of a parked client again, called by its event
+ *  task once the output has gone.  A client out of network buffers
+ *  waits here instead of in the worker.  One that can not be serviced
+ *  again is handed back to its worker to be dropped.
+ */
+void rsrv_poll_resume ( struct client *client )
+{
+    poll_worker *pw = (poll_worker *) client->pollWorker;
+    struct epoll_event ev;
+    epicsUInt64 one = 1u;
+
+    if ( epicsAtomicCmpAndSwapIntT ( &client->pollParked, 1, 0 ) != 1 ) {
+        return;
+    }
+    if ( client->pollBackoff ) {
+        client->pollBackoff = FALSE;
+        epicsThreadSleep ( 15.0 );
+    }
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.ptr = client;
+    if ( ! epoll_ctl ( pw->epfd, EPOLL_CTL_ADD, client->sock, &ev ) ) {
+        return;
+    }
+    client->disconnect = TRUE;
+    epicsMutexMustLock ( pw->dropLock );
+    client->pollDropNext = pw->dropList;
+    pw->dropList = client;
+    epicsMutexUnlock ( pw->dropLock );
+    if ( write ( pw->wakefd, &one, sizeof ( one ) ) != sizeof ( one ) ) {
+        errlogPrintf ( "CAS: unable to wake epoll worker\n" );
+    }
+}
+
+/*
+ *  rsrv_poll_add()
+ *
+ *  Assign a client, already on clientQ, to the least loaded worker
+ */
+int rsrv_poll_add ( struct client *client )
+{
+    poll_worker *pw = NULL;
+    struct epoll_event ev;
+    unsigned i;
+
+    for ( i = 0u; i < nPollWorkers; i++ ) {
+        if ( ! pw || epicsAtomicGetIntT ( &pollWorkers[i].nclients ) <
+                epicsAtomicGetIntT ( &pw->nclients ) ) {
+            pw = &pollWorkers[i];
+        }
+    }
+    if ( ! pw ) {
+        return RSRV_ERROR;
+    }
+
+    memset ( &ev, 0, sizeof ( ev ) );
+    ev.events = EPOLLIN | EPOLLRDHUP;
+    ev.data.ptr = client;
+
+    client->pollWorker = pw;
+    epicsAtomicIncrIntT ( &pw->nclients );
+    if ( epoll_ctl ( pw->epfd, EPOLL_CTL_ADD, client->sock, &ev ) ) {
+        epicsAtomicDecrIntT ( &pw->nclients );
+        return RSRV_ERROR;
+    }
+    return RSRV_OK;
+}
+
+void rsrv_poll_show ( unsigned level )
+{
+    unsigned i;
+
+    if ( ! nPollWorkers ) {
+        return;
+    }
+    printf ( "%u epoll workers servicing client input\n", nPollWorkers );
+    if ( level > 0u ) {
+        for ( i = 0u; i < nPollWorkers; i++ ) {
+            printf ( "    worker %u: %d clients\n", i,
+                epicsAtomicGetIntT ( &pollWorkers[i].nclients ) );
+        }
+    }
+}
+
+#else /* __linux__ */
+
+int rsrv_poll_init ( unsigned nWorkers )
+{
+    return nWorkers ? RSRV_ERROR : RSRV_OK;
+}
+
+void rsrv_poll_stop ( void )
+{
+}
+
+unsigned rsrv_poll_workers ( void )
+{
+    return 0u;
+}
+
+int rsrv_poll_in_worker ( void )
+{
+    return FALSE;
+}
+
+void rsrv_poll_resume ( struct client *client )
+{
+}
+
+int rsrv_poll_add ( struct client *client )
+{
+    return RSRV_ERROR;
+}
+
+void rsrv_poll_show ( unsigned level )
+{
+}
+
+#endif /* __linux__ */
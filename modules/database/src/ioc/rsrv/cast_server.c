@@ -51,6 +51,12 @@
 
 #define TIMEOUT 60.0 /* sec */
 
+#if defined(__linux__) && defined(MSG_WAITFORONE)
+#   define CAS_UDP_BATCH 16u
+#endif
+
+int rsrvSearchThreads = 1;
+
 /*
  * clean_addrq
  */
@@ -107,6 +113,272 @@ static void clean_addrq(struct client *client)
 
 }
 
+static int cast_ignore ( const struct sockaddr_in *pAddr )
+{
+    size_t idx;
+
+    for(idx=0; casIgnoreAddrs[idx]; idx++)
+    {
+        if(pAddr->sin_addr.s_addr==casIgnoreAddrs[idx]) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
+/*
+ * Process one datagram of nchars bytes from pAddr, already
+ * received into client->recv.buf
+ */
+static void cast_process ( struct client *client, int nchars,
+    const struct sockaddr_in *pAddr )
+{
+    int status;
+    int count=0;
+
+    client->recv.cnt = (unsigned) nchars;
+    client->recv.stk = 0ul;
+    epicsTimeGetCurrent(&client->time_at_last_recv);
+
+    client->minor_version_number = CA_UKN_MINOR_VERSION;
+    client->seqNoOfReq = 0;
+
+    /*
+     * If we are talking to a new client flush to the old one
+     * in case we are holding UDP messages waiting to
+     * see if the next message is for this same client.
+     */
+    if (client->send.stk>sizeof(caHdr)) {
+        status = memcmp(&client->addr,
+            pAddr, sizeof(*pAddr));
+        if(status){
+            /*
+             * if the address is different
+             */
+            cas_send_dg_msg(client);
+            client->addr = *pAddr;
+        }
+    }
+    else {
+        client->addr = *pAddr;
+    }
+
+    if (CASDEBUG>1) {
+        char    buf[40];
+
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+        errlogPrintf ("CAS: cast server msg of %d bytes from addr %s\n",
+            client->recv.cnt, buf);
+    }
+
+    if (CASDEBUG>2)
+        count = ellCount (&client->chanList);
+
+    status = camessage ( client );
+    if(status == RSRV_OK){
+        if(client->recv.cnt !=
+            client->recv.stk){
+            char buf[40];
+
+            ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+
+            epicsPrintf ("CAS: partial (damaged?) UDP msg of %d bytes from %s ?\n",
+                client->recv.cnt - client->recv.stk, buf);
+
+            epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
+                &client->time_at_last_recv);
+            epicsPrintf ("CAS: message received at %s\n", buf);
+        }
+    }
+    else if (CASDEBUG>0){
+        char buf[40];
+
+        ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
+
+        epicsPrintf ("CAS: invalid (damaged?) UDP request from %s ?\n", buf);
+
+        epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
+            &client->time_at_last_recv);
+        epicsPrintf ("CAS: message received at %s\n", buf);
+    }
+
+    if (CASDEBUG>2) {
+        if ( ellCount (&client->chanList) ) {
+            errlogPrintf ("CAS: Fnd %d name matches (%d tot)\n",
+                ellCount(&client->chanList)-count,
+                ellCount(&client->chanList));
+        }
+    }
+}
+
+/*
+ * allow messages to batch up if more are coming
+ */
+static void cast_flush_idle ( struct client *client, SOCKET recv_sock )
+{
+    osiSockIoctl_t nchars = 0; /* suppress purify warning */
+    int status = socket_ioctl(recv_sock, FIONREAD, &nchars);
+
+    if (status<0) {
+        errlogPrintf ("CA cast server: Unable to fetch N characters pending\n");
+        cas_send_dg_msg (client);
+        clean_addrq (client);
+    }
+    else if (nchars == 0) {
+        cas_send_dg_msg (client);
+        clean_addrq (client);
+    }
+}
+
+static void cast_recv_error ( void )
+{
+    if (SOCKERRNO != SOCK_EINTR) {
+        char sockErrBuf[64];
+        epicsSocketConvertErrnoToString (
+            sockErrBuf, sizeof ( sockErrBuf ) );
+        epicsPrintf ("CAS: UDP recv error: %s\n",
+                sockErrBuf);
+        epicsThreadSleep(1.0);
+    }
+}
+
+#ifdef CAS_UDP_BATCH
+
+/*
+ * UDP replies queued to be sent together by sendmmsg()
+ */
+struct cas_dg_batch {
+    unsigned            n;
+    struct mmsghdr      msgs[CAS_UDP_BATCH];
+    struct iovec        iov[CAS_UDP_BATCH];
+    struct sockaddr_in  addrs[CAS_UDP_BATCH];
+    char                bufs[CAS_UDP_BATCH][MAX_UDP_SEND];
+};
+
+int cas_dg_batch_send ( struct client *client, const char *pDG, int sizeDG )
+{
+    struct cas_dg_batch *pb = client->pDgBatch;
+    unsigned n;
+
+    if ( sizeDG > (int) MAX_UDP_SEND ) {
+        return sendto ( client->sock, pDG, sizeDG, 0,
+            (struct sockaddr *)&client->addr, sizeof(client->addr) );
+    }
+    if ( pb->n == CAS_UDP_BATCH ) {
+        cas_dg_batch_flush ( client );
+    }
+
+    n = pb->n++;
+    memcpy ( pb->bufs[n], pDG, sizeDG );
+    pb->iov[n].iov_base = pb->bufs[n];
+    pb->iov[n].iov_len = sizeDG;
+    pb->addrs[n] = client->addr;
+    memset ( &pb->msgs[n], 0, sizeof ( pb->msgs[n] ) );
+    pb->msgs[n].msg_hdr.msg_name = &pb->addrs[n];
+    pb->msgs[n].msg_hdr.msg_namelen = sizeof ( pb->addrs[n] );
+    pb->msgs[n].msg_hdr.msg_iov = &pb->iov[n];
+    pb->msgs[n].msg_hdr.msg_iovlen = 1;
+    return sizeDG;
+}
+
+void cas_dg_batch_flush ( struct client *client )
+{
+    struct cas_dg_batch *pb = client->pDgBatch;
+    unsigned sent = 0u;
+
+    while ( pb && sent < pb->n ) {
+        int status = sendmmsg ( client->sock, &pb->msgs[sent],
+            pb->n - sent, 0 );
+        if ( status < 0 ) {
+            char sockErrBuf[64];
+            char buf[40];
+
+            if ( SOCKERRNO == SOCK_EINTR ) {
+                continue;
+            }
+            epicsSocketConvertErrnoToString (
+                sockErrBuf, sizeof ( sockErrBuf ) );
+            ipAddrToDottedIP ( &pb->addrs[sent], buf, sizeof(buf) );
+            errlogPrintf( "CAS: UDP send to %s failed: %s\n",
+                buf, sockErrBuf);
+            /* drop it and carry on with the rest */
+            status = 1;
+        }
+        sent += (unsigned) status;
+    }
+    if ( pb ) {
+        pb->n = 0u;
+    }
+}
+
+/*
+ * Receive up to CAS_UDP_BATCH datagrams with each recvmmsg(), and send
+ * their replies with one sendmmsg().  Returns only if the buffers
+ * can't be allocated.
+ */
+static void cast_server_batched ( struct client *client, SOCKET recv_sock )
+{
+    struct mmsghdr msgs[CAS_UDP_BATCH];
+    struct iovec iov[CAS_UDP_BATCH];
+    struct sockaddr_in addrs[CAS_UDP_BATCH];
+    char *bufs = malloc ( CAS_UDP_BATCH * MAX_UDP_RECV );
+    struct cas_dg_batch *pb = calloc ( 1, sizeof ( *pb ) );
+    unsigned i;
+
+    if ( ! bufs || ! pb ) {
+        free ( bufs );
+        free ( pb );
+        return;
+    }
+    client->pDgBatch = pb;
+
+    while (TRUE) {
+        int n;
+
+        for ( i = 0u; i < CAS_UDP_BATCH; i++ ) {
+            iov[i].iov_base = &bufs[i * MAX_UDP_RECV];
+            iov[i].iov_len = MAX_UDP_RECV;
+            memset ( &msgs[i], 0, sizeof ( msgs[i] ) );
+            msgs[i].msg_hdr.msg_name = &addrs[i];
+            msgs[i].msg_hdr.msg_namelen = sizeof ( addrs[i] );
+            msgs[i].msg_hdr.msg_iov = &iov[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+
+        n = recvmmsg ( recv_sock, msgs, CAS_UDP_BATCH, MSG_WAITFORONE, NULL );
+        if ( n < 0 ) {
+            cast_recv_error ();
+        }
+
+        for ( i = 0u; n > 0 && i < (unsigned) n; i++ ) {
+            unsigned len = msgs[i].msg_len;
+
+            if ( cast_ignore ( &addrs[i] ) || casudp_ctl != ctlRun ) {
+                continue;
+            }
+            memcpy ( client->recv.buf, &bufs[i * MAX_UDP_RECV], len );
+            cast_process ( client, (int) len, &addrs[i] );
+        }
+
+        cast_flush_idle ( client, recv_sock );
+        cas_dg_batch_flush ( client );
+    }
+}
+
+#else /* CAS_UDP_BATCH */
+
+int cas_dg_batch_send ( struct client *client, const char *pDG, int sizeDG )
+{
+    return sendto ( client->sock, pDG, sizeDG, 0,
+        (struct sockaddr *)&client->addr, sizeof(client->addr) );
+}
+
+void cas_dg_batch_flush ( struct client *client )
+{
+}
+
+#endif /* CAS_UDP_BATCH */
+
 /*
  * CAST_SERVER
  *
@@ -117,11 +389,9 @@ void cast_server(void *pParm)
 {
     rsrv_iface_config *conf = pParm;
     int                 status;
-    int                 count=0;
     int                 mysocket=0;
     struct sockaddr_in  new_recv_addr;
     osiSocklen_t        recv_addr_size;
-    osiSockIoctl_t      nchars;
     SOCKET              recv_sock, reply_sock;
     struct client      *client;
 
@@ -143,11 +413,13 @@ void cast_server(void *pParm)
     }
     if (conf->startbcast) {
         recv_sock = conf->udpbcast;
-        conf->bclient = client;
+        if (!conf->startextra)
+            conf->bclient = client;
     }
     else {
         recv_sock = conf->udp;
-        conf->client = client;
+        if (!conf->startextra)
+            conf->client = client;
     }
     client->udpRecv = recv_sock;
 
@@ -163,6 +435,10 @@ void cast_server(void *pParm)
 
     epicsEventSignal(casudp_startStopEvent);
 
+#ifdef CAS_UDP_BATCH
+    cast_server_batched ( client, recv_sock );
+#endif
+
     while (TRUE) {
         status = recvfrom (
             recv_sock,
@@ -172,116 +448,17 @@ void cast_server(void *pParm)
             (struct sockaddr *)&new_recv_addr,
             &recv_addr_size);
         if (status < 0) {
-            if (SOCKERRNO != SOCK_EINTR) {
-                char sockErrBuf[64];
-                epicsSocketConvertErrnoToString (
-                    sockErrBuf, sizeof ( sockErrBuf ) );
-                epicsPrintf ("CAS: UDP recv error: %s\n",
-                        sockErrBuf);
-                epicsThreadSleep(1.0);
-            }
-
-        } else {
-            size_t idx;
-            for(idx=0; casIgnoreAddrs[idx]; idx++)
-            {
-                if(new_recv_addr.sin_addr.s_addr==casIgnoreAddrs[idx]) {
-                    status = -1; /* ignore */
-                    break;
-                }
-            }
+            cast_recv_error ();
+        }
+        else if (cast_ignore (&new_recv_addr)) {
+            status = -1;
         }
 
         if (status >= 0 && casudp_ctl == ctlRun) {
-            client->recv.cnt = (unsigned) status;
-            client->recv.stk = 0ul;
-            epicsTimeGetCurrent(&client->time_at_last_recv);
-
-            client->minor_version_number = CA_UKN_MINOR_VERSION;
-            client->seqNoOfReq = 0;
-
-            /*
-             * If we are talking to a new client flush to the old one
-             * in case we are holding UDP messages waiting to
-             * see if the next message is for this same client.
-             */
-            if (client->send.stk>sizeof(caHdr)) {
-                status = memcmp(&client->addr,
-                    &new_recv_addr, recv_addr_size);
-                if(status){
-                    /*
-                     * if the address is different
-                     */
-                    cas_send_dg_msg(client);
-                    client->addr = new_recv_addr;
-                }
-            }
-            else {
-                client->addr = new_recv_addr;
-            }
-
-            if (CASDEBUG>1) {
-                char    buf[40];
-
-                ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-                errlogPrintf ("CAS: cast server msg of %d bytes from addr %s\n",
-                    client->recv.cnt, buf);
-            }
-
-            if (CASDEBUG>2)
-                count = ellCount (&client->chanList);
-
-            status = camessage ( client );
-            if(status == RSRV_OK){
-                if(client->recv.cnt !=
-                    client->recv.stk){
-                    char buf[40];
-
-                    ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-
-                    epicsPrintf ("CAS: partial (damaged?) UDP msg of %d bytes from %s ?\n",
-                        client->recv.cnt - client->recv.stk, buf);
-
-                    epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
-                        &client->time_at_last_recv);
-                    epicsPrintf ("CAS: message received at %s\n", buf);
-                }
-            }
-            else if (CASDEBUG>0){
-                char buf[40];
-
-                ipAddrToDottedIP (&client->addr, buf, sizeof(buf));
-
-                epicsPrintf ("CAS: invalid (damaged?) UDP request from %s ?\n", buf);
-
-                epicsTimeToStrftime(buf, sizeof(buf), "%Y-%m-%d %H:%M:%S",
-                    &client->time_at_last_recv);
-                epicsPrintf ("CAS: message received at %s\n", buf);
-            }
-
-            if (CASDEBUG>2) {
-                if ( ellCount (&client->chanList) ) {
-                    errlogPrintf ("CAS: Fnd %d name matches (%d tot)\n",
-                        ellCount(&client->chanList)-count,
-                        ellCount(&client->chanList));
-                }
-            }
+            cast_process ( client, status, &new_recv_addr );
         }
 
-        /*
-         * allow messages to batch up if more are coming
-         */
-        nchars = 0; /* suppress purify warning */
-        status = socket_ioctl(recv_sock, FIONREAD, &nchars);
-        if (status<0) {
-            errlogPrintf ("CA cast server: Unable to fetch N characters pending\n");
-            cas_send_dg_msg (client);
-            clean_addrq (client);
-        }
-        else if (nchars == 0) {
-            cas_send_dg_msg (client);
-            clean_addrq (client);
-        }
+        cast_flush_idle ( client, recv_sock );
     }
 
     /* ATM never reached, just a placeholder */
@@ -30,11 +30,22 @@ extern "C" {
 
 DBCORE_API void rsrv_register_server(void);
 
+/* Number of epoll workers servicing TCP client input, read when the
+ * server starts.  0 runs a thread for each client. */
+DBCORE_API extern int rsrvPollWorkers;
+/* Minimum seconds between flushes of monitor updates to a client, read
+ * when the server starts.  0 flushes each time the event queue drains. */
+DBCORE_API extern double rsrvCoalesceWindow;
+/* Threads receiving UDP name searches on each socket */
+DBCORE_API extern int rsrvSearchThreads;
+
 DBCORE_API void casr (unsigned level);
 DBCORE_API int casClientInitiatingCurrentThread (
                         char * pBuf, size_t bufSize );
 DBCORE_API void casStatsFetch (
                         unsigned *pChanCount, unsigned *pConnCount );
+DBCORE_API void casBufStatsFetch (
+                        size_t *pBytesInUse, size_t *pBytesIdle );
 
 #ifdef __cplusplus
 }
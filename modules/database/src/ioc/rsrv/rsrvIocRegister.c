@@ -38,4 +38,7 @@ void rsrvRegistrar(void)
 }
 
 epicsExportAddress(int, CASDEBUG);
+epicsExportAddress(int, rsrvPollWorkers);
+epicsExportAddress(double, rsrvCoalesceWindow);
+epicsExportAddress(int, rsrvSearchThreads);
 epicsExportRegistrar(rsrvRegistrar);
@@ -27,6 +27,8 @@
 #include "caProto.h"
 #include "ellLib.h"
 #include "epicsTime.h"
+#include "epicsTimer.h"
+#include "epicsTypes.h"
 #include "epicsAssert.h"
 #include "osiSock.h"
 
@@ -53,6 +55,8 @@ typedef struct caHdrLargeArray {
  * processors.
  */
 enum messageBufferType { mbtUDP, mbtSmallTCP, mbtLargeTCP };
+/* seconds a large buffer is kept after it last held a large message */
+#define CAS_SHRINK_DELAY 5.0
 struct message_buffer {
   char                      *buf;
   /*! points to first filled byte in buffer */
@@ -61,10 +65,28 @@ struct message_buffer {
   /*! points to first unused byte in buffer (after filled bytes) */
   unsigned                  cnt;
   enum messageBufferType    type;
+  /*! when a large buffer last held more than MAX_TCP bytes */
+  epicsTimeStamp            lastLarge;
 };
 
 extern epicsThreadPrivateId rsrvCurrentClient;
 
+/*
+ * Payload sent from outside of the send buffer, inserted before
+ * send.buf[offset].  See cas_commit_msg_ext().
+ */
+typedef struct cas_send_seg {
+  unsigned              offset;
+  const char            *pData;
+  ca_uint32_t           size;
+  void                  (*release) ( void * );
+  void                  *arg;
+} cas_send_seg;
+
+#define CAS_SEND_SEGS 16u
+/* smaller payloads are copied into the send buffer */
+#define CAS_GATHER_MIN 4096u
+
 typedef struct client {
   ELLNODE               node;
   /*! guarded by SEND_LOCK()  aka. client::lock */
@@ -86,6 +108,7 @@ typedef struct client {
   char                  *pHostName;
   epicsEventId          blockSem; /* used whenever the client blocks */
   SOCKET                sock, udpRecv;
+  struct cas_dg_batch   *pDgBatch; /* UDP replies for sendmmsg(), or NULL */
   int                   proto;
   epicsThreadId         tid;
   unsigned              minor_version_number;
@@ -93,6 +116,20 @@ typedef struct client {
   unsigned              recvBytesToDrain;
   unsigned              priority;
   char                  disconnect; /* disconnect detected */
+  char                  flushPending; /* flushTimer started */
+  /*! guarded by SEND_LOCK() */
+  unsigned              nSendSegs;
+  cas_send_seg          sendSegs[CAS_SEND_SEGS];
+  epicsTimerId          flushTimer; /* coalesces monitor updates, or NULL */
+  /*! send statistics, guarded by SEND_LOCK() */
+  epicsUInt64           sendBytes;
+  epicsUInt64           sendCalls;
+  epicsUInt64           sendGathered; /* bytes sent from segments */
+  epicsUInt64           sendDeferred; /* monitor flushes coalesced */
+  void                  *pollWorker; /* servicing input, cf. caspoll.c */
+  struct client         *pollDropNext; /* on the worker's drop list */
+  int                   pollParked; /* input waits for the event task */
+  char                  pollBackoff; /* out of buffers, event task waits */
 } client;
 
 /* Channel state shows which struct client list a
@@ -156,6 +193,7 @@ typedef struct {
     struct client *client, *bclient;
 
     unsigned int startbcast:1;
+    unsigned int startextra:1; /* another thread on the same socket */
 } rsrv_iface_config;
 
 enum ctl {ctlInit, ctlRun, ctlPause, ctlExit};
@@ -193,7 +231,6 @@ GLBLTYPE void               *rsrvClientFreeList;
 GLBLTYPE void               *rsrvChanFreeList;
 GLBLTYPE void               *rsrvEventFreeList;
 GLBLTYPE void               *rsrvSmallBufFreeListTCP;
-GLBLTYPE void               *rsrvLargeBufFreeListTCP;
 GLBLTYPE unsigned           rsrvSizeofLargeBufTCP;
 GLBLTYPE void               *rsrvPutNotifyFreeList;
 GLBLTYPE unsigned           rsrvChannelCount; /* locked by clientQlock */
@@ -206,6 +243,9 @@ GLBLTYPE volatile enum ctl  beacon_ctl;
 GLBLTYPE volatile enum ctl  castcp_ctl;
 
 GLBLTYPE unsigned int       threadPrios[5];
+GLBLTYPE epicsTimerQueueId  rsrvTimerQueue; /* NULL unless coalescing */
+/* UDP name searches, updated with epicsAtomic */
+GLBLTYPE size_t             rsrvSearchFound, rsrvSearchFiltered, rsrvSearchMissed;
 
 #define CAS_HASH_TABLE_SIZE 4096
 
@@ -220,8 +260,25 @@ extern "C" {
 #endif
 
 void camsgtask (void *client);
+long camsg_recv ( struct client *client, int recvFlags );
+int rsrv_poll_init ( unsigned nWorkers );
+void rsrv_poll_stop ( void );
+unsigned rsrv_poll_workers ( void );
+int rsrv_poll_in_worker ( void );
+int rsrv_poll_add ( struct client *client );
+void rsrv_poll_resume ( struct client *client );
+void rsrv_poll_show ( unsigned level );
+int rsrv_buf_pool_init ( ca_uint32_t maxSize );
+char * rsrv_buf_alloc ( ca_uint32_t size, unsigned *pActual );
+void rsrv_buf_free ( char *buf, unsigned size );
+void rsrv_buf_pool_show ( unsigned level );
 void cas_send_bs_msg ( struct client *pclient, int lock_needed );
+void cas_send_event_msg ( struct client *pclient );
+void cas_release_send_segs ( struct client *pclient );
+void cas_flush_timer ( void *pClient );
 void cas_send_dg_msg ( struct client *pclient );
+int cas_dg_batch_send ( struct client *pclient, const char *pDG, int sizeDG );
+void cas_dg_batch_flush ( struct client *pclient );
 void rsrv_online_notify_task (void *);
 void cast_server (void *);
 struct client *create_client ( SOCKET sock, int proto );
@@ -242,11 +299,13 @@ unsigned rsrvSizeOfPutNotify ( struct rsrv_put_notify *pNotify );
  * incoming protocol maintenance
  */
 void casExpandRecvBuffer ( struct client *pClient, ca_uint32_t size );
+void casShrinkRecvBuffer ( struct client *pClient, unsigned used );
 
 /*
  * outgoing protocol maintenance
  */
 void casExpandSendBuffer ( struct client *pClient, ca_uint32_t size );
+void casShrinkSendBuffer ( struct client *pClient, unsigned used );
 int cas_copy_in_header (
     struct client *pClient, ca_uint16_t response, ca_uint32_t payloadSize,
     ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
@@ -254,6 +313,12 @@ int cas_copy_in_header (
 void cas_set_header_cid ( struct client *pClient, ca_uint32_t );
 void cas_set_header_count (struct client *pClient, ca_uint32_t count);
 void cas_commit_msg ( struct client *pClient, ca_uint32_t size );
+int cas_copy_in_header_ext (
+    struct client *pClient, ca_uint16_t response, ca_uint32_t payloadSize,
+    ca_uint16_t dataType, ca_uint32_t nElem, ca_uint32_t cid,
+    ca_uint32_t responseSpecific );
+void cas_commit_msg_ext ( struct client *pClient, const void *pData,
+    ca_uint32_t size, void ( *release ) ( void * ), void *arg );
 
 #ifdef __cplusplus
 }
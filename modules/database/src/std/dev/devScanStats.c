@@ -0,0 +1,264 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *   Device support for periodic scan statistics
+ *
+ *   INP or OUT is "@<scan rate> <item>", for example "@1 second JITTERMAX".
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "alarm.h"
+#include "dbDefs.h"
+#include "dbAccess.h"
+#include "dbEvent.h"
+#include "dbScan.h"
+#include "dbStaticLib.h"
+#include "recGbl.h"
+#include "devSup.h"
+#include "epicsString.h"
+#include "menuFtype.h"
+
+#include "aiRecord.h"
+#include "boRecord.h"
+#include "waveformRecord.h"
+#include "epicsExport.h"
+
+enum scanItem {
+    itemTime, itemTimeMin, itemTimeMax, itemTimeMean,
+    itemJitter, itemJitterMax, itemJitterMean,
+    itemPasses, itemRecords, itemOverruns,
+    itemTimeHist, itemJitterHist, itemBounds,
+    itemReset
+};
+
+static const struct {
+    const char *name;
+    enum scanItem item;
+} items[] = {
+    {"TIME", itemTime},
+    {"TIMEMIN", itemTimeMin},
+    {"TIMEMAX", itemTimeMax},
+    {"TIMEMEAN", itemTimeMean},
+    {"JITTER", itemJitter},
+    {"JITTERMAX", itemJitterMax},
+    {"JITTERMEAN", itemJitterMean},
+    {"PASSES", itemPasses},
+    {"RECORDS", itemRecords},
+    {"OVERRUNS", itemOverruns},
+    {"TIMEHIST", itemTimeHist},
+    {"JITTERHIST", itemJitterHist},
+    {"BOUNDS", itemBounds},
+    {"RESET", itemReset},
+};
+
+typedef struct scanStatsPvt {
+    int scan;
+    enum scanItem item;
+} scanStatsPvt;
+
+/* Parse the instio string, returns NULL if it's bad */
+static scanStatsPvt * parseInst(struct link *plink, enum scanItem from,
+    enum scanItem to)
+{
+    dbMenu *pmenu = dbFindMenu(pdbbase, "menuScan");
+    char *parm, *rate, *word, *end;
+    scanStatsPvt *ppvt = NULL;
+    int i;
+
+    if (plink->type != INST_IO || !pmenu)
+        return NULL;
+
+    /* The item is the last word, the scan rate is the rest */
+    parm = epicsStrDup(plink->value.instio.string);
+    end = parm + strlen(parm);
+    while (end > parm && isspace((int) end[-1]))
+        *--end = '\0';
+    word = strrchr(parm, ' ');
+    if (!word)
+        goto done;
+    for (end = word++; end > parm && isspace((int) end[-1]); end--)
+        ;
+    *end = '\0';
+    for (rate = parm; isspace((int) *rate); rate++)
+        ;
+
+    for (i = 0; i < NELEMENTS(items); i++) {
+        if (!epicsStrCaseCmp(word, items[i].name))
+            break;
+    }
+    if (i == NELEMENTS(items) || items[i].item < from || items[i].item > to)
+        goto done;
+
+    ppvt = calloc(1, sizeof(scanStatsPvt));
+    if (!ppvt)
+        goto done;
+    ppvt->item = items[i].item;
+
+    for (i = SCAN_1ST_PERIODIC; i < pmenu->nChoice; i++) {
+        if (!epicsStrCaseCmp(rate, pmenu->papChoiceValue[i]))
+            break;
+    }
+    if (i == pmenu->nChoice) {
+        free(ppvt);
+        ppvt = NULL;
+    }
+    else
+        ppvt->scan = i;
+
+done:
+    free(parm);
+    return ppvt;
+}
+
+
+/********* ai record **********/
+static long init_ai(dbCommon *pcommon)
+{
+    aiRecord *prec = (aiRecord *)pcommon;
+
+    prec->dpvt = parseInst(&prec->inp, itemTime, itemOverruns);
+    if (!prec->dpvt) {
+        recGblRecordError(S_db_badField, (void *)prec,
+                          "devAiScanStats::init_ai: Bad INP");
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+    return 0;
+}
+
+static long read_ai(aiRecord *prec)
+{
+    scanStatsPvt *ppvt = (scanStatsPvt *)prec->dpvt;
+    scanPeriodicStats stats;
+
+    if (!ppvt) return -1;
+
+    if (scanPeriodicStatus(ppvt->scan, 0, &stats)) {
+        recGblSetSevr(prec, READ_ALARM, INVALID_ALARM);
+        return -1;
+    }
+
+    switch (ppvt->item) {
+    case itemTime:       prec->val = stats.timeLast;   break;
+    case itemTimeMin:    prec->val = stats.timeMin;    break;
+    case itemTimeMax:    prec->val = stats.timeMax;    break;
+    case itemTimeMean:   prec->val = stats.timeMean;   break;
+    case itemJitter:     prec->val = stats.jitterLast; break;
+    case itemJitterMax:  prec->val = stats.jitterMax;  break;
+    case itemJitterMean: prec->val = stats.jitterMean; break;
+    case itemPasses:     prec->val = stats.passes;     break;
+    case itemRecords:    prec->val = stats.nRecords;   break;
+    case itemOverruns:   prec->val = stats.overruns;   break;
+    default:
+        return -1;
+    }
+    prec->udf = FALSE;
+    return 2;
+}
+
+aidset devAiScanStats = {
+    {6, NULL, NULL, init_ai, NULL},
+    read_ai,  NULL
+};
+epicsExportAddress(dset, devAiScanStats);
+
+
+/********* bo record **********/
+static long init_bo(dbCommon *pcommon)
+{
+    boRecord *prec = (boRecord *)pcommon;
+
+    prec->dpvt = parseInst(&prec->out, itemReset, itemReset);
+    if (!prec->dpvt) {
+        recGblRecordError(S_db_badField, (void *)prec,
+                          "devBoScanStats::init_bo: Bad OUT");
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+    prec->mask = 0;
+    return 2;
+}
+
+static long write_bo(boRecord *prec)
+{
+    scanStatsPvt *ppvt = (scanStatsPvt *)prec->dpvt;
+
+    if (!ppvt) return -1;
+
+    if (prec->val)
+        scanPeriodicStatus(ppvt->scan, 1, NULL);
+    return 0;
+}
+
+bodset devBoScanStats = {
+    {5, NULL, NULL, init_bo, NULL},
+    write_bo
+};
+epicsExportAddress(dset, devBoScanStats);
+
+
+/********* waveform record **********/
+static long init_wf(dbCommon *pcommon)
+{
+    waveformRecord *prec = (waveformRecord *)pcommon;
+
+    if (prec->ftvl != menuFtypeDOUBLE) {
+        recGblRecordError(S_db_badField, (void *)prec,
+                          "devWfScanStats::init_wf: FTVL must be DOUBLE");
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+    prec->dpvt = parseInst(&prec->inp, itemTimeHist, itemBounds);
+    if (!prec->dpvt) {
+        recGblRecordError(S_db_badField, (void *)prec,
+                          "devWfScanStats::init_wf: Bad INP");
+        prec->pact = TRUE;
+        return S_db_badField;
+    }
+    return 0;
+}
+
+static long read_wf(waveformRecord *prec)
+{
+    scanStatsPvt *ppvt = (scanStatsPvt *)prec->dpvt;
+    scanPeriodicHist hist;
+    double *pval = (double *)prec->bptr;
+    epicsUInt32 nord = prec->nord;
+    epicsUInt32 i, n = prec->nelm;
+
+    if (!ppvt) return -1;
+
+    if (scanPeriodicHistogram(ppvt->scan, &hist)) {
+        recGblSetSevr(prec, READ_ALARM, INVALID_ALARM);
+        return -1;
+    }
+
+    if (n > SCAN_HIST_BINS)
+        n = SCAN_HIST_BINS;
+    for (i = 0; i < n; i++) {
+        switch (ppvt->item) {
+        case itemTimeHist:   pval[i] = hist.time[i];   break;
+        case itemJitterHist: pval[i] = hist.jitter[i]; break;
+        default:             pval[i] = hist.upper[i];  break;
+        }
+    }
+    prec->nord = n;
+    prec->udf = FALSE;
+    if (nord != prec->nord)
+        db_post_events(prec, &prec->nord, DBE_VALUE | DBE_LOG);
+    return 0;
+}
+
+wfdset devWfScanStats = {
+    {5, NULL, NULL, init_wf, NULL},
+    read_wf
+};
+epicsExportAddress(dset, devWfScanStats);
@@ -9,6 +9,7 @@
 
 /*  Usage
  *      {calc:{expr:"A*B", args:[{...}, ...], units:"mm"}}
+ *      {acalc:{expr:"A*B", args:[{...}, ...], reduce:"sum"}}
  *  First link in 'args' is 'A', second is 'B', and so forth.
  */
 
@@ -38,6 +39,13 @@
 
 typedef long (*FASTCONVERT)();
 
+/* Storage for an array argument or result of an acalc link */
+typedef struct acalc_buf {
+    double *pval;
+    long size;          /* Elements allocated */
+    long nelm;          /* Elements used */
+} acalc_buf;
+
 typedef struct calc_link {
     jlink jlink;        /* embedded object */
     int nArgs;
@@ -49,6 +57,7 @@ typedef struct calc_link {
         ps_prec,
         ps_units,
         ps_time,
+        ps_reduce,
         ps_error
     } pstate;
     epicsEnum16 stat;
@@ -69,9 +78,49 @@ typedef struct calc_link {
     epicsTimeStamp time;
     epicsUTag utag;
     double val;
+    /* acalc links only */
+    int isArray;
+    int reduce;
+    unsigned long inputs;
+    calcProgram *prgm;
+    acalc_buf *abuf;    /* One per argument, then the result */
 } calc_link;
 
 static lset lnkCalc_lset;
+static lset lnkACalc_lset;
+
+static const char * const reduceNames[] = {
+    "", "sum", "mean", "min", "max"
+};
+
+static void freeArrays(calc_link *clink)
+{
+    if (clink->abuf) {
+        int i;
+
+        for (i = 0; i <= CALCPERFORM_NARGS; i++)
+            free(clink->abuf[i].pval);
+        free(clink->abuf);
+    }
+    calcProgramFree(clink->prgm);
+}
+
+/* Make room for nelm elements, zeroing any new ones */
+static int growBuf(acalc_buf *pbuf, long nelm)
+{
+    double *pval;
+
+    if (nelm <= pbuf->size)
+        return 0;
+
+    pval = realloc(pbuf->pval, nelm * sizeof(double));
+    if (!pval)
+        return -1;
+    memset(pval + pbuf->size, 0, (nelm - pbuf->size) * sizeof(double));
+    pbuf->pval = pval;
+    pbuf->size = nelm;
+    return 0;
+}
 
 
 /*************************** jlif Routines **************************/
@@ -100,6 +149,32 @@ static jlink* lnkCalc_alloc(short dbfType)
     return &clink->jlink;
 }
 
+static jlink* lnkACalc_alloc(short dbfType)
+{
+    calc_link *clink;
+    jlink *pjlink;
+
+    if (dbfType != DBF_INLINK) {
+        errlogPrintf("lnkACalc: Only input links are supported\n");
+        return NULL;
+    }
+
+    pjlink = lnkCalc_alloc(dbfType);
+    if (!pjlink)
+        return NULL;
+
+    clink = CONTAINER(pjlink, struct calc_link, jlink);
+    clink->abuf = calloc(CALCPERFORM_NARGS + 1, sizeof(acalc_buf));
+    if (!clink->abuf) {
+        errlogPrintf("lnkACalc: calloc() failed.\n");
+        free(clink);
+        return NULL;
+    }
+    clink->isArray = 1;
+
+    return pjlink;
+}
+
 static void lnkCalc_free(jlink *pjlink)
 {
     calc_link *clink = CONTAINER(pjlink, struct calc_link, jlink);
@@ -117,6 +192,7 @@ static void lnkCalc_free(jlink *pjlink)
     free(clink->post_major);
     free(clink->post_minor);
     free(clink->units);
+    freeArrays(clink);
     free(clink);
 }
 
@@ -187,6 +263,21 @@ static jlif_result lnkCalc_string(jlink *pjlink, const char *val, size_t len)
         return jlif_continue;
     }
 
+    if (clink->pstate == ps_reduce) {
+        int i;
+
+        for (i = CALC_REDUCE_SUM; i <= CALC_REDUCE_MAX; i++) {
+            if (strlen(reduceNames[i]) == len &&
+                !strncmp(val, reduceNames[i], len)) {
+                clink->reduce = i;
+                return jlif_continue;
+            }
+        }
+        errlogPrintf("lnkACalc: Bad 'reduce' parameter \"%.*s\"\n",
+            (int) len, val);
+        return jlif_stop;
+    }
+
     if (clink->pstate < ps_expr || clink->pstate > ps_minor) {
         errlogPrintf("lnkCalc: Unexpected string \"%.*s\"\n", (int) len, val);
         return jlif_stop;
@@ -226,6 +317,16 @@ static jlif_result lnkCalc_string(jlink *pjlink, const char *val, size_t len)
         return jlif_stop;
     }
 
+    if (clink->isArray) {
+        clink->prgm = calcCompile(postbuf, &err);
+        if (!clink->prgm) {
+            errlogPrintf("lnkACalc: Error in calc expression, %s\n",
+                calcErrorStr(err));
+            return jlif_stop;
+        }
+        calcArgUsage(postbuf, &clink->inputs, NULL);
+    }
+
     return jlif_continue;
 }
 
@@ -279,9 +380,11 @@ static jlif_result lnkCalc_map_key(jlink *pjlink, const char *key, size_t len)
         }
     }
     else if (len == 5) {
-        if (!strncmp(key, "major", len) && !clink->post_major)
+        if (!strncmp(key, "major", len) && !clink->post_major &&
+            !clink->isArray)
             clink->pstate = ps_major;
-        else if (!strncmp(key, "minor", len) && !clink->post_minor)
+        else if (!strncmp(key, "minor", len) && !clink->post_minor &&
+            !clink->isArray)
             clink->pstate = ps_minor;
         else if (!strncmp(key, "units", len) && !clink->units)
             clink->pstate = ps_units;
@@ -290,6 +393,10 @@ static jlif_result lnkCalc_map_key(jlink *pjlink, const char *key, size_t len)
             return jlif_stop;
         }
     }
+    else if (len == 6 && clink->isArray &&
+        !strncmp(key, "reduce", len) && !clink->reduce) {
+        clink->pstate = ps_reduce;
+    }
     else {
         errlogPrintf("lnkCalc: Unknown key \"%.*s\"\n", (int) len, key);
         return jlif_stop;
@@ -376,6 +483,11 @@ static struct lset* lnkCalc_get_lset(const jlink *pjlink)
     return &lnkCalc_lset;
 }
 
+static struct lset* lnkACalc_get_lset(const jlink *pjlink)
+{
+    return &lnkACalc_lset;
+}
+
 static void lnkCalc_report(const jlink *pjlink, int level, int indent)
 {
     calc_link *clink = CONTAINER(pjlink, struct calc_link, jlink);
@@ -427,6 +539,51 @@ static void lnkCalc_report(const jlink *pjlink, int level, int indent)
     }
 }
 
+static void lnkACalc_report(const jlink *pjlink, int level, int indent)
+{
+    calc_link *clink = CONTAINER(pjlink, struct calc_link, jlink);
+    acalc_buf *pres = &clink->abuf[CALCPERFORM_NARGS];
+    int i;
+
+    if (clink->reduce)
+        printf("%*s'acalc': %s(\"%s\") = %.*g %s\n", indent, "",
+            reduceNames[clink->reduce], clink->expr, clink->prec, clink->val,
+            clink->units ? clink->units : "");
+    else
+        printf("%*s'acalc': \"%s\" = %ld elements %s\n", indent, "",
+            clink->expr, pres->nelm, clink->units ? clink->units : "");
+
+    if (level > 0) {
+        if (!clink->reduce && pres->nelm > 0)
+            printf("%*s  Value: [%.*g, ...]\n", indent, "",
+                clink->prec, pres->pval[0]);
+
+        if (clink->tinp >= 0) {
+            char timeStr[40];
+            epicsTimeToStrftime(timeStr, 40, "%Y-%m-%d %H:%M:%S.%09f",
+                &clink->time);
+            printf("%*s  Timestamp input %c: %s\n", indent, "",
+                clink->tinp + 'A', timeStr);
+        }
+
+        for (i = 0; i < clink->nArgs; i++) {
+            struct link *plink = &clink->inp[i];
+            jlink *child = plink->type == JSON_LINK ?
+                plink->value.json.jlink : NULL;
+
+            if (child)
+                printf("%*s  Input %c: %ld elements\n", indent, "",
+                    i + 'A', clink->abuf[i].nelm);
+            else
+                printf("%*s  Input %c: %g\n", indent, "",
+                    i + 'A', clink->arg[i]);
+
+            if (child)
+                dbJLinkReport(child, level - 1, indent + 4);
+        }
+    }
+}
+
 static long lnkCalc_map_children(jlink *pjlink, jlink_map_fn rtn, void *ctx)
 {
     calc_link *clink = CONTAINER(pjlink, struct calc_link, jlink);
@@ -467,6 +624,42 @@ static void lnkCalc_open(struct link *plink)
     }
 }
 
+static void lnkACalc_open(struct link *plink)
+{
+    calc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct calc_link, jlink);
+    int i;
+
+    for (i = 0; i < clink->nArgs; i++) {
+        struct link *child = &clink->inp[i];
+        acalc_buf *parg = &clink->abuf[i];
+        long size = 16;
+
+        if (child->type != JSON_LINK)
+            continue;
+
+        child->precord = plink->precord;
+        dbJLinkInit(child);
+        if (!dbLinkIsConstant(child))
+            continue;
+
+        /* A constant doesn't say how many elements it has */
+        while (!growBuf(parg, size)) {
+            long nReq = size;
+
+            if (dbLoadLinkArray(child, DBR_DOUBLE, parg->pval, &nReq)) {
+                parg->pval[0] = 0.0;
+                nReq = 1;
+            }
+            if (nReq < size) {
+                parg->nelm = nReq;
+                break;
+            }
+            size *= 2;
+        }
+    }
+}
+
 static void lnkCalc_remove(struct dbLocker *locker, struct link *plink)
 {
     calc_link *clink = CONTAINER(plink->value.json.jlink,
@@ -490,6 +683,7 @@ static void lnkCalc_remove(struct dbLocker *locker, struct link *plink)
     free(clink->post_major);
     free(clink->post_minor);
     free(clink->units);
+    freeArrays(clink);
     free(clink);
     plink->value.json.jlink = NULL;
 }
@@ -531,18 +725,45 @@ static long lnkCalc_getElements(const struct link *plink, long *nelements)
     return 0;
 }
 
+/* The shortest array input, as for calcPerformArray() */
+static long lnkACalc_getElements(const struct link *plink, long *nelements)
+{
+    calc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct calc_link, jlink);
+    long nelm = 0;
+    int i;
+
+    if (!clink->reduce) {
+        for (i = 0; i < clink->nArgs; i++) {
+            struct link *child = &clink->inp[i];
+            long n = clink->abuf[i].nelm;
+
+            if (!(clink->inputs & (1ul << i)) || child->type != JSON_LINK)
+                continue;
+            if (!dbLinkIsConstant(child) && dbGetNelements(child, &n))
+                continue;
+            if (n > 1 && (!nelm || n < nelm))
+                nelm = n;
+        }
+    }
+    *nelements = nelm ? nelm : 1;
+    return 0;
+}
+
 /* Get value and timestamp atomically for link indicated by time */
 struct lcvt {
     double *pval;
     epicsTimeStamp *ptime;
     epicsUTag *ptag;
+    long *pnReq;        /* Array size, NULL for a scalar */
 };
 
 static long readLocked(struct link *pinp, void *vvt)
 {
     struct lcvt *pvt = (struct lcvt *) vvt;
     long nReq = 1;
-    long status = dbGetLink(pinp, DBR_DOUBLE, pvt->pval, NULL, &nReq);
+    long status = dbGetLink(pinp, DBR_DOUBLE, pvt->pval, NULL,
+        pvt->pnReq ? pvt->pnReq : &nReq);
 
     if (!status && pvt->ptime)
         dbGetTimeStampTag(pinp, pvt->ptime, pvt->ptag);
@@ -630,6 +851,106 @@ static long lnkCalc_getValue(struct link *plink, short dbrType, void *pbuffer,
     return status;
 }
 
+static long lnkACalc_getValue(struct link *plink, short dbrType,
+    void *pbuffer, long *pnRequest)
+{
+    calc_link *clink = CONTAINER(plink->value.json.jlink,
+        struct calc_link, jlink);
+    dbCommon *prec = plink->precord;
+    acalc_buf *pres = &clink->abuf[CALCPERFORM_NARGS];
+    calcArrayArg args[CALCPERFORM_NARGS];
+    long nelm = 1;
+    long nReq;
+    int i;
+    long status;
+
+    if(INVALID_DB_REQ(dbrType))
+        return S_db_badDbrtype;
+
+    /* Any link errors will trigger a LINK/INVALID alarm in the child link */
+    for (i = 0; i < CALCPERFORM_NARGS; i++) {
+        struct link *child = &clink->inp[i];
+        acalc_buf *parg = &clink->abuf[i];
+
+        args[i].pval = &clink->arg[i];
+        args[i].nelm = 1;
+        if (i >= clink->nArgs || child->type != JSON_LINK)
+            continue;
+
+        if (!dbLinkIsConstant(child)) {
+            long n;
+
+            if (dbGetNelements(child, &n) || n < 1)
+                n = 1;
+            if (growBuf(parg, n))
+                return S_db_noMemory;
+            parg->nelm = n;
+
+            if (i == clink->tinp) {
+                struct lcvt vt = {parg->pval, &clink->time, &clink->utag,
+                    &parg->nelm};
+
+                status = dbLinkDoLocked(child, readLocked, &vt);
+                if (status == S_db_noLSET)
+                    status = readLocked(child, &vt);
+
+                if (dbLinkIsConstant(&prec->tsel) &&
+                    prec->tse == epicsTimeEventDeviceTime) {
+                    prec->time = clink->time;
+                    prec->utag = clink->utag;
+                }
+            }
+            else
+                dbGetLink(child, DBR_DOUBLE, parg->pval, NULL, &parg->nelm);
+        }
+        args[i].pval = parg->pval;
+        args[i].nelm = parg->nelm;
+        if (parg->nelm > nelm)
+            nelm = parg->nelm;
+    }
+
+    if (growBuf(pres, nelm))
+        return S_db_noMemory;
+    status = calcPerformArray(args, pres->pval, &nelm, clink->prgm);
+    if (status)
+        return status;
+    pres->nelm = nelm;
+
+    if (clink->reduce) {
+        clink->val = calcReduceArray(pres->pval, nelm, clink->reduce);
+        status = dbFastPutConvertRoutine[DBR_DOUBLE][dbrType](&clink->val,
+            pbuffer, NULL);
+        if (!status && pnRequest)
+            *pnRequest = 1;
+        return status;
+    }
+
+    nReq = pnRequest ? *pnRequest : 1;
+    if (nReq > nelm)
+        nReq = nelm;
+    if (nelm > 0)
+        clink->val = pres->pval[0];
+
+    if (dbrType == DBR_DOUBLE) {
+        memcpy(pbuffer, pres->pval, nReq * sizeof(double));
+    }
+    else {
+        FASTCONVERT conv = dbFastPutConvertRoutine[DBR_DOUBLE][dbrType];
+        long size = dbValueSize(dbrType);
+        char *pdest = pbuffer;
+
+        for (i = 0; i < nReq; i++) {
+            status = conv(&pres->pval[i], pdest, NULL);
+            if (status)
+                return status;
+            pdest += size;
+        }
+    }
+    if (pnRequest)
+        *pnRequest = nReq;
+    return 0;
+}
+
 static long lnkCalc_putValue(struct link *plink, short dbrType,
     const void *pbuffer, long nRequest)
 {
@@ -786,6 +1107,21 @@ static lset lnkCalc_lset = {
     lnkCalc_getTimestampTag,
 };
 
+static lset lnkACalc_lset = {
+    0, 1, /* not Constant, Volatile */
+    lnkACalc_open, lnkCalc_remove,
+    NULL, NULL, NULL,
+    lnkCalc_isConn, lnkCalc_getDBFtype, lnkACalc_getElements,
+    lnkACalc_getValue,
+    NULL, NULL, NULL,
+    lnkCalc_getPrecision, lnkCalc_getUnits,
+    NULL, NULL,
+    NULL, NULL,
+    NULL, doLocked,
+    lnkCalc_getAlarmMsg,
+    lnkCalc_getTimestampTag,
+};
+
 static jlif lnkCalcIf = {
     "calc", lnkCalc_alloc, lnkCalc_free,
     NULL, NULL, lnkCalc_integer, lnkCalc_double, lnkCalc_string,
@@ -795,3 +1131,13 @@ static jlif lnkCalcIf = {
     lnkCalc_report, lnkCalc_map_children, NULL
 };
 epicsExportAddress(jlif, lnkCalcIf);
+
+static jlif lnkACalcIf = {
+    "acalc", lnkACalc_alloc, lnkCalc_free,
+    NULL, NULL, lnkCalc_integer, lnkCalc_double, lnkCalc_string,
+    lnkCalc_start_map, lnkCalc_map_key, lnkCalc_end_map,
+    lnkCalc_start_array, lnkCalc_end_array,
+    lnkCalc_end_child, lnkACalc_get_lset,
+    lnkACalc_report, lnkCalc_map_children, NULL
+};
+epicsExportAddress(jlif, lnkACalcIf);
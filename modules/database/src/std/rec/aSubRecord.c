@@ -406,12 +406,14 @@ static void monitor(aSubRecord *prec)
 {
     int            i;
     unsigned short monitor_mask;
+    db_post_field  posts[2 * NUM_ARGS + 1];
+    unsigned       nposts = 0;
 
     monitor_mask = recGblResetAlarms(prec) | DBE_VALUE | DBE_LOG;
 
     /* Post events for VAL field */
     if (prec->val != prec->oval) {
-        db_post_events(prec, &prec->val, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
         prec->oval = prec->val;
     }
 
@@ -431,21 +433,23 @@ static void monitor(aSubRecord *prec)
 
             if (nev != onv || memcmp(povl, pval, alen)) {
                 memcpy(povl, pval, alen);
-                db_post_events(prec, pval, monitor_mask);
+                DB_POST_FIELD(posts, nposts, pval, monitor_mask);
                 if (nev != onv) {
                     *ponv = nev;
-                    db_post_events(prec, pnev, monitor_mask);
+                    DB_POST_FIELD(posts, nposts, pnev, monitor_mask);
                 }
             }
         }
         break;
     case aSubEFLG_ALWAYS:
         for (i = 0; i < NUM_ARGS; i++) {
-            db_post_events(prec, (&prec->vala)[i], monitor_mask);
-            db_post_events(prec, &(&prec->neva)[i], monitor_mask);
+            DB_POST_FIELD(posts, nposts, (&prec->vala)[i], monitor_mask);
+            DB_POST_FIELD(posts, nposts, &(&prec->neva)[i], monitor_mask);
         }
         break;
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
     return;
 }
 
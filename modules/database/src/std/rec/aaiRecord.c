@@ -307,6 +307,8 @@ static void monitor(aaiRecord *prec)
 {
     unsigned short monitor_mask;
     unsigned int hash = 0;
+    db_post_field posts[2];
+    unsigned nposts = 0;
 
     monitor_mask = recGblResetAlarms(prec);
 
@@ -331,12 +333,14 @@ static void monitor(aaiRecord *prec)
             /* Store hash for next process. */
             prec->hash = hash;
             /* Post HASH. */
-            db_post_events(prec, &prec->hash, DBE_VALUE);
+            DB_POST_FIELD(posts, nposts, &prec->hash, DBE_VALUE);
         }
     }
 
     if (monitor_mask)
-        db_post_events(prec, &prec->val, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
 }
 
 static long readValue(aaiRecord *prec)
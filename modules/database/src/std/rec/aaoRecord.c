@@ -312,6 +312,8 @@ static void monitor(aaoRecord *prec)
 {
     unsigned short monitor_mask;
     unsigned int hash = 0;
+    db_post_field posts[2];
+    unsigned nposts = 0;
 
     monitor_mask = recGblResetAlarms(prec);
 
@@ -336,12 +338,14 @@ static void monitor(aaoRecord *prec)
             /* Store hash for next process. */
             prec->hash = hash;
             /* Post HASH. */
-            db_post_events(prec, &prec->hash, DBE_VALUE);
+            DB_POST_FIELD(posts, nposts, &prec->hash, DBE_VALUE);
         }
     }
 
     if (monitor_mask)
-        db_post_events(prec, &prec->val, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
 }
 
 static long fetchValue(aaoRecord *prec, int init)
@@ -449,6 +449,8 @@ static void convert(aiRecord *prec)
 static void monitor(aiRecord *prec)
 {
     unsigned monitor_mask = recGblResetAlarms(prec);
+    db_post_field posts[2];
+    unsigned nposts = 0;
 
     /* check for value change */
     recGblCheckDeadband(&prec->mlst, prec->val, prec->mdel, &monitor_mask, DBE_VALUE);
@@ -458,11 +460,12 @@ static void monitor(aiRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask){
-        db_post_events(prec,&prec->val,monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
         if(prec->oraw != prec->rval) {
-            db_post_events(prec,&prec->rval,monitor_mask);
+            DB_POST_FIELD(posts, nposts, &prec->rval, monitor_mask);
             prec->oraw = prec->rval;
         }
+        db_post_events_many(prec, posts, nposts);
     }
     return;
 }
@@ -520,6 +520,8 @@ static void convert(aoRecord *prec, double value)
 static void monitor(aoRecord *prec)
 {
     unsigned monitor_mask = recGblResetAlarms(prec);
+    db_post_field posts[4];
+    unsigned nposts = 0;
 
     /* check for value change */
     recGblCheckDeadband(&prec->mlst, prec->val, prec->mdel, &monitor_mask, DBE_VALUE);
@@ -529,24 +531,26 @@ static void monitor(aoRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask){
-        db_post_events(prec,&prec->val,monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
     }
 
     if(prec->omod) monitor_mask |= (DBE_VALUE|DBE_LOG);
     if(monitor_mask) {
         prec->omod = FALSE;
-        db_post_events(prec,&prec->oval,monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->oval, monitor_mask);
         if(prec->oraw != prec->rval) {
-            db_post_events(prec,&prec->rval,
+            DB_POST_FIELD(posts, nposts, &prec->rval,
                 monitor_mask|DBE_VALUE|DBE_LOG);
             prec->oraw = prec->rval;
         }
         if(prec->orbv != prec->rbv) {
-            db_post_events(prec,&prec->rbv,
+            DB_POST_FIELD(posts, nposts, &prec->rbv,
                 monitor_mask|DBE_VALUE|DBE_LOG);
             prec->orbv = prec->rbv;
         }
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
     return;
 }
 
@@ -245,6 +245,8 @@ static void checkAlarms(biRecord *prec)
 static void monitor(biRecord *prec)
 {
     unsigned short  monitor_mask;
+    db_post_field   posts[2];
+    unsigned        nposts = 0;
 
     monitor_mask = recGblResetAlarms(prec);
     /* check for value change */
@@ -257,13 +259,15 @@ static void monitor(biRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask){
-        db_post_events(prec,&prec->val,monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
     }
     if(prec->oraw!=prec->rval) {
-        db_post_events(prec,&prec->rval,
+        DB_POST_FIELD(posts, nposts, &prec->rval,
             monitor_mask|DBE_VALUE|DBE_LOG);
         prec->oraw = prec->rval;
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
     return;
 }
 
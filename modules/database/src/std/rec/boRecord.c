@@ -389,6 +389,8 @@ static void checkAlarms(boRecord *prec)
 static void monitor(boRecord *prec)
 {
     unsigned short  monitor_mask;
+    db_post_field   posts[3];
+    unsigned        nposts = 0;
 
     monitor_mask = recGblResetAlarms(prec);
     /* check for value change */
@@ -401,18 +403,20 @@ static void monitor(boRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask){
-        db_post_events(prec,&prec->val,monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
     }
     if(prec->oraw!=prec->rval) {
-        db_post_events(prec,&prec->rval,
+        DB_POST_FIELD(posts, nposts, &prec->rval,
             monitor_mask|DBE_VALUE|DBE_LOG);
         prec->oraw = prec->rval;
     }
     if(prec->orbv!=prec->rbv) {
-        db_post_events(prec,&prec->rbv,
+        DB_POST_FIELD(posts, nposts, &prec->rbv,
             monitor_mask|DBE_VALUE|DBE_LOG);
         prec->orbv = prec->rbv;
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
     return;
 }
 
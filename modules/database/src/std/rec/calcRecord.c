@@ -108,6 +108,7 @@ static long init_record(struct dbCommon *pcommon, int pass)
         errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
                      prec->name, calcErrorStr(error_number), prec->calc);
     }
+    prec->prgm = calcCompile(prec->rpcl, NULL);
     return 0;
 }
 
@@ -118,7 +119,9 @@ static long process(struct dbCommon *pcommon)
 
     prec->pact = TRUE;
     if (fetch_values(prec) == 0) {
-        if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+        if (prec->prgm ?
+            calcPerformProgram(&prec->a, &prec->val, prec->prgm) :
+            calcPerform(&prec->a, &prec->val, prec->rpcl)) {
             recGblSetSevr(prec, CALC_ALARM, INVALID_ALARM);
         } else
             prec->udf = isnan(prec->val);
@@ -143,7 +146,11 @@ static long special(DBADDR *paddr, int after)
 
     if (!after) return 0;
     if (paddr->special == SPC_CALC) {
-        if (postfix(prec->calc, prec->rpcl, &error_number)) {
+        long status = postfix(prec->calc, prec->rpcl, &error_number);
+
+        calcProgramFree(prec->prgm);
+        prec->prgm = calcCompile(prec->rpcl, NULL);
+        if (status) {
             recGblRecordError(S_db_badField, (void *)prec,
                               "calc: Illegal CALC field");
             errlogPrintf("%s.CALC: %s in expression \"%s\"\n",
@@ -396,6 +403,8 @@ static void monitor(calcRecord *prec)
 {
     unsigned monitor_mask;
     double *pnew, *pprev;
+    db_post_field posts[CALCPERFORM_NARGS + 1];
+    unsigned nposts = 0;
     int i;
 
     monitor_mask = recGblResetAlarms(prec);
@@ -408,7 +417,7 @@ static void monitor(calcRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask){
-        db_post_events(prec, &prec->val, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
     }
 
     /* check all input fields for changes*/
@@ -417,10 +426,12 @@ static void monitor(calcRecord *prec)
     for (i = 0; i < CALCPERFORM_NARGS; i++, pnew++, pprev++) {
         if (*pnew != *pprev ||
             monitor_mask & DBE_ALARM) {
-            db_post_events(prec, pnew, monitor_mask | DBE_VALUE | DBE_LOG);
+            DB_POST_FIELD(posts, nposts, pnew, monitor_mask | DBE_VALUE | DBE_LOG);
             *pprev = *pnew;
         }
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
     return;
 }
 
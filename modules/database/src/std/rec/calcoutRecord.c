@@ -112,6 +112,8 @@ typedef struct rpvtStruct {
     epicsCallback checkLinkCb;
     short    cbScheduled;
     short    caLinkStat; /* NO_CA_LINKS, CA_LINKS_ALL_OK, CA_LINKS_NOT_OK */
+    calcProgram *prgm;   /* Compiled RPCL */
+    calcProgram *oprg;   /* Compiled ORPC */
 } rpvtStruct;
 
 static void checkAlarms(calcoutRecord *prec);
@@ -205,6 +207,8 @@ static long init_record(struct dbCommon *pcommon, int pass)
     }
 
     prpvt = prec->rpvt;
+    prpvt->prgm = calcCompile(prec->rpcl, NULL);
+    prpvt->oprg = calcCompile(prec->orpc, NULL);
     callbackSetCallback(checkLinksCallback, &prpvt->checkLinkCb);
     callbackSetPriority(0, &prpvt->checkLinkCb);
     callbackSetUser(prec, &prpvt->checkLinkCb);
@@ -235,7 +239,9 @@ static long process(struct dbCommon *pcommon)
             checkLinks(prec);
         }
         if (fetch_values(prec) == 0) {
-            if (calcPerform(&prec->a, &prec->val, prec->rpcl)) {
+            if (prpvt->prgm ?
+                calcPerformProgram(&prec->a, &prec->val, prpvt->prgm) :
+                calcPerform(&prec->a, &prec->val, prec->rpcl)) {
                 recGblSetSevrMsg(prec, CALC_ALARM, INVALID_ALARM, "calcPerform");
             } else {
                 prec->udf = isnan(prec->val);
@@ -324,6 +330,8 @@ static long special(DBADDR *paddr, int after)
     switch(fieldIndex) {
       case(calcoutRecordCALC):
         prec->clcv = postfix(prec->calc, prec->rpcl, &error_number);
+        calcProgramFree(prpvt->prgm);
+        prpvt->prgm = calcCompile(prec->rpcl, NULL);
         if (prec->clcv){
             recGblRecordError(S_db_badField, (void *)prec,
                       "calcout: special(): Illegal CALC field");
@@ -335,6 +343,8 @@ static long special(DBADDR *paddr, int after)
 
       case(calcoutRecordOCAL):
         prec->oclv = postfix(prec->ocal, prec->orpc, &error_number);
+        calcProgramFree(prpvt->oprg);
+        prpvt->oprg = calcCompile(prec->orpc, NULL);
         if (prec->dopt == calcoutDOPT_Use_OVAL && prec->oclv){
             recGblRecordError(S_db_badField, (void *)prec,
                     "calcout: special(): Illegal OCAL field");
@@ -603,13 +613,17 @@ static void checkAlarms(calcoutRecord *prec)
 
 static void execOutput(calcoutRecord *prec)
 {
+    rpvtStruct *prpvt = prec->rpvt;
+
     /* Determine output data */
     switch(prec->dopt) {
     case calcoutDOPT_Use_VAL:
         prec->oval = prec->val;
         break;
     case calcoutDOPT_Use_OVAL:
-        if (calcPerform(&prec->a, &prec->oval, prec->orpc)) {
+        if (prpvt->oprg ?
+            calcPerformProgram(&prec->a, &prec->oval, prpvt->oprg) :
+            calcPerform(&prec->a, &prec->oval, prec->orpc)) {
             recGblSetSevrMsg(prec, CALC_ALARM, INVALID_ALARM, "OCAL calcPerform");
         } else {
             prec->udf = isnan(prec->oval);
@@ -651,6 +665,8 @@ static void monitor(calcoutRecord *prec)
     unsigned        monitor_mask;
     double          *pnew;
     double          *pprev;
+    db_post_field   posts[CALCPERFORM_NARGS + 2];
+    unsigned        nposts = 0;
     int             i;
 
     monitor_mask = recGblResetAlarms(prec);
@@ -663,22 +679,24 @@ static void monitor(calcoutRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask){
-        db_post_events(prec, &prec->val, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
     }
 
     /* check all input fields for changes*/
     for (i = 0, pnew = &prec->a, pprev = &prec->la; i<CALCPERFORM_NARGS;
          i++, pnew++, pprev++) {
         if ((*pnew != *pprev) || (monitor_mask&DBE_ALARM)) {
-            db_post_events(prec, pnew, monitor_mask|DBE_VALUE|DBE_LOG);
+            DB_POST_FIELD(posts, nposts, pnew, monitor_mask|DBE_VALUE|DBE_LOG);
             *pprev = *pnew;
         }
     }
     /* Check OVAL field */
     if (prec->povl != prec->oval) {
-        db_post_events(prec, &prec->oval, monitor_mask|DBE_VALUE|DBE_LOG);
+        DB_POST_FIELD(posts, nposts, &prec->oval, monitor_mask|DBE_VALUE|DBE_LOG);
         prec->povl = prec->oval;
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
     return;
 }
 
@@ -102,12 +102,15 @@ static void monitor(compressRecord *prec)
 {
     unsigned short alarm_mask = recGblResetAlarms(prec);
     unsigned short monitor_mask = alarm_mask | DBE_LOG | DBE_VALUE;
+    db_post_field posts[2];
+    unsigned nposts = 0;
 
     if (alarm_mask || prec->nuse != prec->ouse) {
-        db_post_events(prec, &prec->nuse, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->nuse, monitor_mask);
         prec->ouse = prec->nuse;
     }
-    db_post_events(prec, (void*)&prec->val, monitor_mask);
+    DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
+    db_post_events_many(prec, posts, nposts);
 }
 
 static void put_value(compressRecord *prec, double *psource, int n)
@@ -202,6 +202,8 @@ static long special(DBADDR *paddr, int after)
 static void monitor(lsiRecord *prec)
 {
     epicsUInt16 events = recGblResetAlarms(prec);
+    db_post_field posts[2];
+    unsigned nposts = 0;
 
     if (prec->len != prec->olen ||
         memcmp(prec->oval, prec->val, prec->len)) {
@@ -211,7 +213,7 @@ static void monitor(lsiRecord *prec)
 
     if (prec->len != prec->olen) {
         prec->olen = prec->len;
-        db_post_events(prec, &prec->len, DBE_VALUE | DBE_LOG);
+        DB_POST_FIELD(posts, nposts, &prec->len, DBE_VALUE | DBE_LOG);
     }
 
     if (prec->mpst == menuPost_Always)
@@ -220,7 +222,9 @@ static void monitor(lsiRecord *prec)
         events |= DBE_LOG;
 
     if (events)
-        db_post_events(prec, prec->val, events);
+        DB_POST_FIELD(posts, nposts, prec->val, events);
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
 }
 
 static long readValue(lsiRecord *prec)
@@ -244,6 +244,8 @@ static long special(DBADDR *paddr, int after)
 static void monitor(lsoRecord *prec)
 {
     epicsUInt16 events = recGblResetAlarms(prec);
+    db_post_field posts[2];
+    unsigned nposts = 0;
 
     if (prec->len != prec->olen ||
         memcmp(prec->oval, prec->val, prec->len)) {
@@ -253,7 +255,7 @@ static void monitor(lsoRecord *prec)
 
     if (prec->len != prec->olen) {
         prec->olen = prec->len;
-        db_post_events(prec, &prec->len, DBE_VALUE | DBE_LOG);
+        DB_POST_FIELD(posts, nposts, &prec->len, DBE_VALUE | DBE_LOG);
     }
 
     if (prec->mpst == menuPost_Always)
@@ -262,7 +264,9 @@ static void monitor(lsoRecord *prec)
         events |= DBE_LOG;
 
     if (events)
-        db_post_events(prec, prec->val, events);
+        DB_POST_FIELD(posts, nposts, prec->val, events);
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
 }
 
 static long writeValue(lsoRecord *prec)
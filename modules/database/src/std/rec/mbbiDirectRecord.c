@@ -212,6 +212,8 @@ static void monitor(mbbiDirectRecord *prec)
     epicsUInt16 vl_events = events | DBE_VALUE | DBE_LOG;
     epicsUInt32 val = prec->val;
     epicsUInt8 *pBn = &prec->b0;
+    db_post_field posts[NUM_BITS + 2];
+    unsigned nposts = 0;
     int i;
 
     /* Update B0 - BF from VAL and post monitors */
@@ -220,9 +222,9 @@ static void monitor(mbbiDirectRecord *prec)
 
         *pBn = !! (val & 1);
         if (oBn != *pBn)
-            db_post_events(prec, pBn, vl_events);
+            DB_POST_FIELD(posts, nposts, pBn, vl_events);
         else if (events)
-            db_post_events(prec, pBn, events);
+            DB_POST_FIELD(posts, nposts, pBn, events);
     }
 
     if (prec->mlst != prec->val) {
@@ -230,12 +232,14 @@ static void monitor(mbbiDirectRecord *prec)
         prec->mlst = prec->val;
     }
     if (events)
-        db_post_events(prec, &prec->val, events);
+        DB_POST_FIELD(posts, nposts, &prec->val, events);
 
     if (prec->oraw != prec->rval) {
-        db_post_events(prec, &prec->rval, vl_events);
+        DB_POST_FIELD(posts, nposts, &prec->rval, vl_events);
         prec->oraw = prec->rval;
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
 }
 
 static long readValue(mbbiDirectRecord *prec)
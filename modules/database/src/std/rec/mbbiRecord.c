@@ -354,6 +354,8 @@ static void checkAlarms(mbbiRecord *prec, epicsTimeStamp *timeLast)
 static void monitor(mbbiRecord *prec)
 {
     epicsUInt16 events = recGblResetAlarms(prec);
+    db_post_field posts[2];
+    unsigned nposts = 0;
 
     if (prec->mlst != prec->val) {
         events |= DBE_VALUE | DBE_LOG;
@@ -361,12 +363,14 @@ static void monitor(mbbiRecord *prec)
     }
 
     if (events)
-        db_post_events(prec, &prec->val, events);
+        DB_POST_FIELD(posts, nposts, &prec->val, events);
 
     if (prec->oraw != prec->rval) {
-        db_post_events(prec, &prec->rval, events | DBE_VALUE | DBE_LOG);
+        DB_POST_FIELD(posts, nposts, &prec->rval, events | DBE_VALUE | DBE_LOG);
         prec->oraw = prec->rval;
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
 }
 
 static long readValue(mbbiRecord *prec)
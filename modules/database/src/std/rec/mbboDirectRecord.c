@@ -307,13 +307,15 @@ static long get_precision(const DBADDR *paddr,long *precision)
 static void monitor(mbboDirectRecord *prec)
 {
     epicsUInt16 events = recGblResetAlarms(prec);
+    db_post_field posts[NUM_BITS + 3];
+    unsigned nposts = 0;
 
     if (prec->mlst != prec->val) {
         events |= DBE_VALUE | DBE_LOG;
         prec->mlst = prec->val;
     }
     if (events) {
-        db_post_events(prec, &prec->val, events);
+        DB_POST_FIELD(posts, nposts, &prec->val, events);
     }
     {
         unsigned i;
@@ -322,7 +324,7 @@ static void monitor(mbboDirectRecord *prec)
         for(i=0; i<NUM_BITS; i++) {
             /* post bit when value or alarm severity changes */
             if((events&~(DBE_VALUE|DBE_LOG)) || (bitsChanged&(1u<<i))) {
-                db_post_events(prec, (&prec->b0)+i, events | DBE_VALUE | DBE_LOG);
+                DB_POST_FIELD(posts, nposts, (&prec->b0)+i, events | DBE_VALUE | DBE_LOG);
             }
         }
         prec->obit = prec->val;
@@ -330,13 +332,15 @@ static void monitor(mbboDirectRecord *prec)
 
     events |= DBE_VALUE | DBE_LOG;
     if (prec->oraw != prec->rval) {
-        db_post_events(prec, &prec->rval, events);
+        DB_POST_FIELD(posts, nposts, &prec->rval, events);
         prec->oraw = prec->rval;
     }
     if (prec->orbv != prec->rbv) {
-        db_post_events(prec, &prec->rbv, events);
+        DB_POST_FIELD(posts, nposts, &prec->rbv, events);
         prec->orbv = prec->rbv;
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
 }
 
 static void convert(mbboDirectRecord *prec)
@@ -399,23 +399,27 @@ static void checkAlarms(mbboRecord *prec)
 static void monitor(mbboRecord *prec)
 {
     epicsUInt16 events = recGblResetAlarms(prec);
+    db_post_field posts[3];
+    unsigned nposts = 0;
 
     if (prec->mlst != prec->val) {
         events |= DBE_VALUE | DBE_LOG;
         prec->mlst = prec->val;
     }
     if (events)
-        db_post_events(prec, &prec->val, events);
+        DB_POST_FIELD(posts, nposts, &prec->val, events);
 
     events |= DBE_VALUE | DBE_LOG;
     if (prec->oraw != prec->rval) {
-        db_post_events(prec, &prec->rval, events);
+        DB_POST_FIELD(posts, nposts, &prec->rval, events);
         prec->oraw = prec->rval;
     }
     if (prec->orbv != prec->rbv) {
-        db_post_events(prec, &prec->rbv, events);
+        DB_POST_FIELD(posts, nposts, &prec->rbv, events);
         prec->orbv = prec->rbv;
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
 }
 
 static void convert(mbboRecord *prec)
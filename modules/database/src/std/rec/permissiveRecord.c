@@ -94,6 +94,8 @@ static void monitor(permissiveRecord *prec)
 {
     unsigned short  monitor_mask;
     unsigned short  val,oval,wflg,oflg;
+    db_post_field   posts[2];
+    unsigned        nposts = 0;
 
     monitor_mask = recGblResetAlarms(prec);
     /* get val,oval,wflg,oflg*/
@@ -105,12 +107,14 @@ static void monitor(permissiveRecord *prec)
     prec->oval = val;
     prec->oflg = wflg;
     if(oval != val) {
-        db_post_events(prec,&prec->val,
+        DB_POST_FIELD(posts, nposts, &prec->val,
         monitor_mask|DBE_VALUE|DBE_LOG);
     }
     if(oflg != wflg) {
-        db_post_events(prec,&prec->wflg,
+        DB_POST_FIELD(posts, nposts, &prec->wflg,
         monitor_mask|DBE_VALUE|DBE_LOG);
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
     return;
 }
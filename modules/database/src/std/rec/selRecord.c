@@ -308,6 +308,8 @@ static void monitor(selRecord *prec)
     unsigned    monitor_mask;
     double      *pnew;
     double      *pprev;
+    db_post_field posts[SEL_MAX + 2];
+    unsigned    nposts = 0;
     int         i;
 
     monitor_mask = recGblResetAlarms(prec);
@@ -320,23 +322,24 @@ static void monitor(selRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask)
-        db_post_events(prec, &prec->val, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
 
     monitor_mask |= DBE_VALUE|DBE_LOG;
 
     /* trigger monitors of the SELN field */
     if (prec->nlst != prec->seln) {
         prec->nlst = prec->seln;
-        db_post_events(prec, &prec->seln, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->seln, monitor_mask);
     }
 
     /* check all input fields for changes, even if VAL hasn't changed */
     for(i=0, pnew=&prec->a, pprev=&prec->la; i<SEL_MAX; i++, pnew++, pprev++) {
         if(*pnew != *pprev) {
-            db_post_events(prec, pnew, monitor_mask);
+            DB_POST_FIELD(posts, nposts, pnew, monitor_mask);
             *pprev = *pnew;
         }
     }
+    db_post_events_many(prec, posts, nposts);
     return;
 }
 
@@ -375,6 +375,8 @@ static void monitor(subRecord *prec)
     unsigned monitor_mask;
     double *pnew;
     double *pold;
+    db_post_field posts[INP_ARG_MAX + 1];
+    unsigned nposts = 0;
     int i;
 
     /* get alarm mask */
@@ -388,17 +390,19 @@ static void monitor(subRecord *prec)
 
     /* send out monitors connected to the value field */
     if (monitor_mask) {
-        db_post_events(prec, &prec->val, monitor_mask);
+        DB_POST_FIELD(posts, nposts, &prec->val, monitor_mask);
     }
 
     /* check all input fields for changes */
     for (i = 0, pnew = &prec->a, pold = &prec->la;
          i < INP_ARG_MAX; i++, pnew++, pold++) {
         if (*pnew != *pold) {
-            db_post_events(prec, pnew, monitor_mask | DBE_VALUE | DBE_LOG);
+            DB_POST_FIELD(posts, nposts, pnew, monitor_mask | DBE_VALUE | DBE_LOG);
             *pold = *pnew;
         }
     }
+    if (nposts)
+        db_post_events_many(prec, posts, nposts);
     return;
 }
 
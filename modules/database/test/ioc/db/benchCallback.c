@@ -0,0 +1,189 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* Measure callbacks per second against the number of callback threads.
+ *
+ * External: producer threads queue callbacks, as device support does.
+ * Chained: each callback queues itself again from the callback thread,
+ * as with records processed through a chain of callbacks.
+ */
+
+#include <string.h>
+
+#include "callback.h"
+#include "cantProceed.h"
+#include "dbAccessDefs.h"
+#include "dbDefs.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+/* Callbacks owned by each producer, or chains per thread */
+#define NCB 64
+
+typedef struct producer {
+    epicsCallback cb[NCB];
+    int busy[NCB]; // use atomic
+    int remaining[NCB]; // use atomic
+    unsigned niter;
+    epicsEventId started;
+} producer;
+
+static int outstanding; // use atomic
+static epicsEventId allDone;
+
+static void finish(void)
+{
+    if (!epicsAtomicDecrIntT(&outstanding))
+        epicsEventMustTrigger(allDone);
+}
+
+static void externalCallback(epicsCallback *pcb)
+{
+    int *pbusy;
+
+    callbackGetUser(pbusy, pcb);
+    epicsAtomicSetIntT(pbusy, 0);
+    finish();
+}
+
+static void chainedCallback(epicsCallback *pcb)
+{
+    int *premaining;
+
+    callbackGetUser(premaining, pcb);
+    if (epicsAtomicDecrIntT(premaining) > 0) {
+        while (callbackRequest(pcb) == S_db_bufFull)
+            epicsThreadSleep(0.0);
+    }
+    finish();
+}
+
+static void produce(void *arg)
+{
+    producer *pp = arg;
+    unsigned i;
+
+    epicsEventMustTrigger(pp->started);
+    for (i = 0; i < pp->niter; i++) {
+        unsigned k = i % NCB;
+
+        /* Wait for the callback to run before queueing it again */
+        while (epicsAtomicGetIntT(&pp->busy[k]))
+            epicsThreadSleep(0.0);
+        epicsAtomicSetIntT(&pp->busy[k], 1);
+        while (callbackRequest(&pp->cb[k]) == S_db_bufFull)
+            epicsThreadSleep(0.0);
+    }
+}
+
+static double runExternal(unsigned nthreads, unsigned nprod, unsigned niter)
+{
+    producer *prods = callocMustSucceed(nprod, sizeof(producer), "runExternal");
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsUInt64 start;
+    unsigned i, k;
+    double secs;
+
+    callbackParallelThreads(nthreads, "");
+    callbackInit();
+
+    /* Below the callback threads, which must not wait for a spinning
+     * producer when it has real-time priority
+     */
+    opts.priority = epicsThreadPriorityLow;
+    opts.joinable = 1;
+    epicsAtomicSetIntT(&outstanding, nprod * niter);
+    for (i = 0; i < nprod; i++) {
+        producer *pp = &prods[i];
+
+        pp->niter = niter;
+        pp->started = epicsEventMustCreate(epicsEventEmpty);
+        for (k = 0; k < NCB; k++) {
+            callbackSetCallback(externalCallback, &pp->cb[k]);
+            callbackSetPriority(priorityLow, &pp->cb[k]);
+            callbackSetUser(&pp->busy[k], &pp->cb[k]);
+        }
+    }
+
+    start = epicsMonotonicGet();
+    {
+        epicsThreadId *tids = callocMustSucceed(nprod, sizeof(epicsThreadId),
+            "runExternal");
+
+        for (i = 0; i < nprod; i++) {
+            tids[i] = epicsThreadCreateOpt("producer", produce, &prods[i], &opts);
+            epicsEventMustWait(prods[i].started);
+        }
+        epicsEventMustWait(allDone);
+        secs = (epicsMonotonicGet() - start) * 1e-9;
+        for (i = 0; i < nprod; i++)
+            epicsThreadMustJoin(tids[i]);
+        free(tids);
+    }
+
+    callbackStop();
+    callbackCleanup();
+    for (i = 0; i < nprod; i++)
+        epicsEventDestroy(prods[i].started);
+    free(prods);
+    return nprod * niter / secs;
+}
+
+static double runChained(unsigned nthreads, unsigned niter)
+{
+    producer *pp = callocMustSucceed(1, sizeof(producer), "runChained");
+    epicsUInt64 start;
+    unsigned k;
+    double secs;
+
+    callbackParallelThreads(nthreads, "");
+    callbackInit();
+
+    epicsAtomicSetIntT(&outstanding, NCB * niter);
+    for (k = 0; k < NCB; k++) {
+        callbackSetCallback(chainedCallback, &pp->cb[k]);
+        callbackSetPriority(priorityLow, &pp->cb[k]);
+        callbackSetUser(&pp->remaining[k], &pp->cb[k]);
+        pp->remaining[k] = niter;
+    }
+
+    start = epicsMonotonicGet();
+    for (k = 0; k < NCB; k++)
+        callbackRequest(&pp->cb[k]);
+    epicsEventMustWait(allDone);
+    secs = (epicsMonotonicGet() - start) * 1e-9;
+
+    callbackStop();
+    callbackCleanup();
+    free(pp);
+    return NCB * niter / secs;
+}
+
+MAIN(benchCallback)
+{
+    unsigned ncpu = epicsThreadGetCPUs();
+    unsigned nthreads;
+
+    testPlan(0);
+    allDone = epicsEventMustCreate(epicsEventEmpty);
+
+    testDiag("%u CPUs, callbacks per second", ncpu);
+    testDiag("threads  1 producer  %2u producers   chained", ncpu);
+    for (nthreads = 1; nthreads <= 2 * ncpu || nthreads <= 4; nthreads *= 2) {
+        double one = runExternal(nthreads, 1, 200000);
+        double many = runExternal(nthreads, ncpu, 200000);
+        double chained = runChained(nthreads, 4000);
+
+        testDiag("%7u %10.0f %12.0f %10.0f", nthreads, one, many, chained);
+    }
+
+    epicsEventDestroy(allDone);
+    return testDone();
+}
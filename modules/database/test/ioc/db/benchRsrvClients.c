@@ -0,0 +1,282 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* Measure the memory and read latency of RSRV with many TCP clients,
+ * each connected with a raw socket speaking just enough CA.
+ *
+ *   benchRsrvClients [workers [nclients ...]]
+ *
+ * workers sets rsrvPollWorkers, 0 for a thread per client.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "dbUnitTest.h"
+#include "envDefs.h"
+#include "iocInit.h"
+#include "epicsMath.h"
+#include "epicsStdio.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "osiSock.h"
+#include "caProto.h"
+#include "db_access.h"
+#include "db_access_routines.h"
+#include "rsrv.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#if defined(__linux__)
+#  include <sys/resource.h>
+#endif
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define MINOR_VERSION 13u
+
+typedef struct {
+    SOCKET sock;
+    ca_uint32_t sid;
+} benchClient;
+
+static osiSockAddr serverAddr;
+
+static int sendMsg(SOCKET sock, ca_uint16_t cmmd, ca_uint16_t type,
+                   ca_uint16_t count, ca_uint32_t cid, ca_uint32_t avail,
+                   const char *payload)
+{
+    char buf[sizeof(caHdr) + 40];
+    caHdr *hdr = (caHdr *) buf;
+    size_t len = payload ? strlen(payload) + 1 : 0;
+
+    len = (len + 7u) & ~7u;
+    memset(buf, 0, sizeof(buf));
+    hdr->m_cmmd = htons(cmmd);
+    hdr->m_postsize = htons((ca_uint16_t) len);
+    hdr->m_dataType = htons(type);
+    hdr->m_count = htons(count);
+    hdr->m_cid = htonl(cid);
+    hdr->m_available = htonl(avail);
+    if (payload)
+        strcpy(buf + sizeof(caHdr), payload);
+
+    return send(sock, buf, (int)(sizeof(caHdr) + len), 0)
+        == (int)(sizeof(caHdr) + len) ? 0 : -1;
+}
+
+static int recvAll(SOCKET sock, char *buf, size_t len)
+{
+    while (len) {
+        int n = recv(sock, buf, (int) len, 0);
+        if (n <= 0)
+            return -1;
+        buf += n;
+        len -= (size_t) n;
+    }
+    return 0;
+}
+
+/* Skip messages until one with the given command, returns its header */
+static int recvMsg(SOCKET sock, ca_uint16_t cmmd, caHdr *hdr)
+{
+    char payload[64];
+
+    while (1) {
+        ca_uint16_t size;
+
+        if (recvAll(sock, (char *) hdr, sizeof(*hdr)))
+            return -1;
+        size = ntohs(hdr->m_postsize);
+        while (size) {
+            size_t n = size < sizeof(payload) ? size : sizeof(payload);
+            if (recvAll(sock, payload, n))
+                return -1;
+            size -= (ca_uint16_t) n;
+        }
+        if (ntohs(hdr->m_cmmd) == cmmd)
+            return 0;
+    }
+}
+
+static int clientConnect(benchClient *client, ca_uint32_t cid)
+{
+    int yes = 1;
+    caHdr hdr;
+
+    client->sock = epicsSocketCreate(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (client->sock == INVALID_SOCKET)
+        return -1;
+    /* as libca does */
+    setsockopt(client->sock, IPPROTO_TCP, TCP_NODELAY,
+               (char *) &yes, sizeof(yes));
+    if (connect(client->sock, &serverAddr.sa, sizeof(serverAddr.ia)) ||
+            sendMsg(client->sock, CA_PROTO_VERSION, 0, MINOR_VERSION, 0, 0, NULL) ||
+            sendMsg(client->sock, CA_PROTO_CLIENT_NAME, 0, 0, 0, 0, "bench") ||
+            sendMsg(client->sock, CA_PROTO_HOST_NAME, 0, 0, 0, 0, "localhost") ||
+            sendMsg(client->sock, CA_PROTO_CREATE_CHAN, 0, 0, cid,
+                    MINOR_VERSION, "x") ||
+            recvMsg(client->sock, CA_PROTO_CREATE_CHAN, &hdr)) {
+        epicsSocketDestroy(client->sock);
+        client->sock = INVALID_SOCKET;
+        return -1;
+    }
+    client->sid = ntohl(hdr.m_available);
+    return 0;
+}
+
+static double readLatency(benchClient *client, ca_uint32_t ioid)
+{
+    epicsTimeStamp start, stop;
+    caHdr hdr;
+
+    epicsTimeGetCurrent(&start);
+    if (sendMsg(client->sock, CA_PROTO_READ_NOTIFY, DBR_LONG, 1,
+                client->sid, ioid, NULL) ||
+            recvMsg(client->sock, CA_PROTO_READ_NOTIFY, &hdr))
+        return -1.0;
+    epicsTimeGetCurrent(&stop);
+    return epicsTimeDiffInSeconds(&stop, &start);
+}
+
+static void showProcess(const char *when)
+{
+#if defined(__linux__)
+    FILE *fp = fopen("/proc/self/status", "r");
+    char line[128];
+
+    if (!fp)
+        return;
+    while (fgets(line, sizeof(line), fp)) {
+        if (!strncmp(line, "VmRSS:", 6) || !strncmp(line, "VmSize:", 7) ||
+                !strncmp(line, "Threads:", 8)) {
+            line[strlen(line) - 1] = '\0';
+            testDiag("%s %s", when, line);
+        }
+    }
+    fclose(fp);
+#endif
+}
+
+static void runBench(unsigned nclients)
+{
+    benchClient *clients;
+    epicsTimeStamp start, stop;
+    double sum = 0, sum2 = 0, worst = 0, mean;
+    unsigned i, nok = 0, nread = 0;
+    const unsigned nrep = 5;
+
+    testDiag("%u clients", nclients);
+    showProcess("before");
+
+    clients = calloc(nclients, sizeof(*clients));
+    if (!clients)
+        testAbort("Out of memory");
+
+    epicsTimeGetCurrent(&start);
+    for (i = 0; i < nclients; i++) {
+        if (!clientConnect(&clients[i], i))
+            nok++;
+    }
+    epicsTimeGetCurrent(&stop);
+    testOk(nok == nclients, "%u of %u clients connected in %.03f s",
+           nok, nclients, epicsTimeDiffInSeconds(&stop, &start));
+    showProcess("connected");
+
+    for (i = 0; i < nclients * nrep; i++) {
+        benchClient *client = &clients[i % nclients];
+        double t;
+
+        if (client->sock == INVALID_SOCKET)
+            continue;
+        t = readLatency(client, i);
+        if (t < 0)
+            continue;
+        nread++;
+        sum += t;
+        sum2 += t * t;
+        if (t > worst)
+            worst = t;
+    }
+    testOk(nread == nok * nrep, "%u of %u reads", nread, nok * nrep);
+
+    if (nread) {
+        mean = sum / nread;
+        testDiag("Read latency %.1f us +- %.1f us, max %.1f us",
+                 mean * 1e6, sqrt(sum2 / nread - mean * mean) * 1e6,
+                 worst * 1e6);
+    }
+
+    for (i = 0; i < nclients; i++) {
+        if (clients[i].sock != INVALID_SOCKET)
+            epicsSocketDestroy(clients[i].sock);
+    }
+    free(clients);
+    /* let the server notice */
+    epicsThreadSleep(1.0);
+}
+
+MAIN(benchRsrvClients)
+{
+    static const unsigned defaults[] = {100, 1000, 5000};
+    const char *port;
+    int i;
+
+#if defined(__linux__)
+    {
+        struct rlimit lim;
+
+        /* two descriptors per client */
+        if (!getrlimit(RLIMIT_NOFILE, &lim)) {
+            lim.rlim_cur = lim.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &lim);
+        }
+    }
+#endif
+
+    testPlan(0);
+
+    if (argc > 1)
+        rsrvPollWorkers = atoi(argv[1]);
+    testDiag("rsrvPollWorkers = %d", rsrvPollWorkers);
+
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    rsrv_register_server();
+    /* not isolated, so that RSRV starts */
+    if (iocInit())
+        testAbort("Failed to start up test database");
+
+    port = getenv("RSRV_SERVER_PORT");
+    if (!port)
+        testAbort("RSRV not running");
+    memset(&serverAddr, 0, sizeof(serverAddr));
+    serverAddr.ia.sin_family = AF_INET;
+    serverAddr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    serverAddr.ia.sin_port = htons((unsigned short) atoi(port));
+
+    if (argc > 2) {
+        for (i = 2; i < argc; i++)
+            runBench((unsigned) atoi(argv[i]));
+    }
+    else {
+        for (i = 0; i < (int) NELEMENTS(defaults); i++)
+            runBench(defaults[i]);
+    }
+
+    /* RSRV can't be stopped, so no cleanup */
+    iocShutdown();
+
+    return testDone();
+}
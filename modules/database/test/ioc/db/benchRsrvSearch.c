@@ -0,0 +1,233 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* Measure how many UDP name searches per second RSRV answers, with
+ * several load generator threads searching over loopback.
+ *
+ *   benchRsrvSearch [threads [senders [seconds]]]
+ *
+ * threads sets rsrvSearchThreads.  Each datagram carries SEARCH_BATCH
+ * searches for a PV which the IOC has.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "dbUnitTest.h"
+#include "envDefs.h"
+#include "iocInit.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "osiSock.h"
+#include "caProto.h"
+#include "db_access.h"
+#include "db_access_routines.h"
+#include "rsrv.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define MINOR_VERSION 13u
+#define SEARCH_BATCH 8u
+/* searches each sender has outstanding */
+#define SEARCH_WINDOW 256u
+
+typedef struct {
+    epicsEventId done;
+    double seconds;
+    unsigned long sent, answered, timeouts;
+} searchSender;
+
+static osiSockAddr serverAddr;
+
+static void putHeader(caHdr *hdr, ca_uint16_t cmmd, ca_uint16_t postsize,
+                      ca_uint16_t type, ca_uint16_t count, ca_uint32_t cid,
+                      ca_uint32_t avail)
+{
+    hdr->m_cmmd = htons(cmmd);
+    hdr->m_postsize = htons(postsize);
+    hdr->m_dataType = htons(type);
+    hdr->m_count = htons(count);
+    hdr->m_cid = htonl(cid);
+    hdr->m_available = htonl(avail);
+}
+
+/* Count the search replies in a datagram */
+static unsigned countReplies(const char *buf, int len)
+{
+    unsigned n = 0;
+
+    while (len >= (int) sizeof(caHdr)) {
+        const caHdr *hdr = (const caHdr *) buf;
+        int size = sizeof(caHdr) + ntohs(hdr->m_postsize);
+
+        if (ntohs(hdr->m_cmmd) == CA_PROTO_SEARCH)
+            n++;
+        buf += size;
+        len -= size;
+    }
+    return n;
+}
+
+static void senderTask(void *arg)
+{
+    searchSender *sender = arg;
+    char msg[sizeof(caHdr) * (SEARCH_BATCH + 1u) + 8u * SEARCH_BATCH];
+    char reply[MAX_UDP_RECV];
+    struct timeval timeout;
+    epicsTimeStamp start, now;
+    unsigned long outstanding = 0;
+    ca_uint32_t cid = 0;
+    SOCKET sock;
+    char *p;
+    unsigned i;
+
+    sock = epicsSocketCreate(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (sock == INVALID_SOCKET ||
+            connect(sock, &serverAddr.sa, sizeof(serverAddr.ia)))
+        testAbort("Failed to create UDP socket");
+    timeout.tv_sec = 0;
+    timeout.tv_usec = 20000;
+    setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, (char *) &timeout,
+               sizeof(timeout));
+
+    epicsTimeGetCurrent(&start);
+    do {
+        if (outstanding + SEARCH_BATCH <= SEARCH_WINDOW) {
+            memset(msg, 0, sizeof(msg));
+            putHeader((caHdr *) msg, CA_PROTO_VERSION, 0, 0,
+                      MINOR_VERSION, 0, 0);
+            p = msg + sizeof(caHdr);
+            for (i = 0; i < SEARCH_BATCH; i++, cid++) {
+                putHeader((caHdr *) p, CA_PROTO_SEARCH, 8, DONTREPLY,
+                          MINOR_VERSION, cid, cid);
+                strcpy(p + sizeof(caHdr), "x");
+                p += sizeof(caHdr) + 8u;
+            }
+            if (send(sock, msg, (int) (p - msg), 0) == (int) (p - msg)) {
+                sender->sent += SEARCH_BATCH;
+                outstanding += SEARCH_BATCH;
+            }
+        }
+        else {
+            int n = recv(sock, reply, sizeof(reply), 0);
+
+            if (n > 0) {
+                unsigned got = countReplies(reply, n);
+
+                sender->answered += got;
+                outstanding = got < outstanding ? outstanding - got : 0;
+            }
+            else {
+                /* lost, start a new window */
+                sender->timeouts++;
+                outstanding = 0;
+            }
+        }
+        /* collect replies which have already arrived */
+        while (outstanding) {
+            int n = recv(sock, reply, sizeof(reply), MSG_DONTWAIT);
+            unsigned got;
+
+            if (n <= 0)
+                break;
+            got = countReplies(reply, n);
+            sender->answered += got;
+            outstanding = got < outstanding ? outstanding - got : 0;
+        }
+        epicsTimeGetCurrent(&now);
+    } while (epicsTimeDiffInSeconds(&now, &start) < sender->seconds);
+
+    epicsSocketDestroy(sock);
+    epicsEventMustTrigger(sender->done);
+}
+
+static void runBench(unsigned nsenders, double seconds)
+{
+    searchSender *senders = calloc(nsenders, sizeof(*senders));
+    unsigned long sent = 0, answered = 0, timeouts = 0;
+    unsigned i;
+
+    if (!senders)
+        testAbort("Out of memory");
+
+    for (i = 0; i < nsenders; i++) {
+        char name[32];
+
+        senders[i].done = epicsEventMustCreate(epicsEventEmpty);
+        senders[i].seconds = seconds;
+        sprintf(name, "sender%u", i);
+        epicsThreadMustCreate(name, epicsThreadPriorityMedium,
+                              epicsThreadGetStackSize(epicsThreadStackBig),
+                              senderTask, &senders[i]);
+    }
+    for (i = 0; i < nsenders; i++) {
+        epicsEventMustWait(senders[i].done);
+        epicsEventDestroy(senders[i].done);
+        sent += senders[i].sent;
+        answered += senders[i].answered;
+        timeouts += senders[i].timeouts;
+    }
+    free(senders);
+
+    testOk(answered > 0, "%u senders: %.0f searches/s answered "
+           "(%lu of %lu, %lu timeouts)", nsenders, answered / seconds,
+           answered, sent, timeouts);
+}
+
+MAIN(benchRsrvSearch)
+{
+    static const unsigned defaults[] = {1, 2, 4};
+    double seconds = 2.0;
+    int i;
+
+    testPlan(0);
+
+    if (argc > 1)
+        rsrvSearchThreads = atoi(argv[1]);
+    if (argc > 3)
+        seconds = atof(argv[3]);
+    testDiag("rsrvSearchThreads = %d", rsrvSearchThreads);
+
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    rsrv_register_server();
+    /* not isolated, so that RSRV starts */
+    if (iocInit())
+        testAbort("Failed to start up test database");
+
+    /* the UDP port, RSRV_SERVER_PORT may differ */
+    memset(&serverAddr, 0, sizeof(serverAddr));
+    serverAddr.ia.sin_family = AF_INET;
+    serverAddr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    serverAddr.ia.sin_port = htons(envGetInetPortConfigParam(
+        envGetConfigParamPtr(&EPICS_CAS_SERVER_PORT) ?
+            &EPICS_CAS_SERVER_PORT : &EPICS_CA_SERVER_PORT,
+        (unsigned short) CA_SERVER_PORT));
+
+    if (argc > 2) {
+        runBench((unsigned) atoi(argv[2]), seconds);
+    }
+    else {
+        for (i = 0; i < (int) NELEMENTS(defaults); i++)
+            runBench(defaults[i], seconds);
+    }
+
+    /* RSRV can't be stopped, so no cleanup */
+    iocShutdown();
+
+    return testDone();
+}
@@ -0,0 +1,87 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* Measure I/O Intr scanning of a source that requests scans faster than
+ * they can be run, with and without batching.
+ *
+ *   benchScanIo [nrecords]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "dbDefs.h"
+#include "callback.h"
+#include "dbAccess.h"
+#include "dbScan.h"
+#include "dbUnitTest.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#include "devx.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static void run(unsigned nrecords, double batch, double seconds)
+{
+    scanIoStats stats;
+    epicsUInt64 start, stop;
+    unsigned long requests = 0;
+    xdrv *drv;
+    unsigned i;
+    char buf[40];
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    for (i = 0; i < nrecords; i++) {
+        sprintf(buf, "GROUP=0,MEMBER=%u,PRIO=LOW", i);
+        testdbReadDatabase("scanIoTest.db", NULL, buf);
+    }
+
+    drv = xdrv_add(0, NULL, NULL);
+    scanIoSetBatch(drv->scan, batch);
+
+    testIocInitOk();
+
+    /* A producer below the callback threads, as a driver thread would be */
+    epicsThreadSetPriority(epicsThreadGetIdSelf(), epicsThreadPriorityLow);
+    start = epicsMonotonicGet();
+    do {
+        for (i = 0; i < 100; i++, requests++)
+            scanIoRequest(drv->scan);
+        epicsThreadSleep(0.0);
+        stop = epicsMonotonicGet();
+    } while ((stop - start) * 1e-9 < seconds);
+    epicsThreadSleep(2 * batch + 0.1);
+
+    scanIoStatus(drv->scan, priorityLow, 0, &stats);
+    testOk(stats.requested == requests && stats.overflows == 0,
+        "batch %.3f s: %lu requests, %lu coalesced, %lu passes, "
+        "%lu deferred, %lu overflows", batch, stats.requested,
+        stats.coalesced, stats.passes, stats.deferred, stats.overflows);
+
+    testIocShutdownOk();
+    testdbCleanup();
+    xdrv_reset();
+}
+
+MAIN(benchScanIo)
+{
+    unsigned nrecords = 1000;
+
+    if (argc > 1)
+        nrecords = strtoul(argv[1], NULL, 0);
+
+    testPlan(0);
+    testDiag("%u records on the list", nrecords);
+    run(nrecords, 0.0, 2.0);
+    run(nrecords, 0.01, 2.0);
+    run(nrecords, 0.1, 2.0);
+    return testDone();
+}
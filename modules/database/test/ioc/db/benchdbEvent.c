@@ -0,0 +1,168 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* Measure the cost of db_post_events() with many subscribers,
+ * each on its own event context (as with one RSRV client each).
+ */
+
+#define EPICS_PRIVATE_API
+
+#include <string.h>
+
+#include "cantProceed.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+#include "caeventmask.h"
+#include "epicsAtomic.h"
+#include "epicsEvent.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "epicsMath.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#include "xRecord.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+typedef struct {
+    dbEventCtx ctx;
+    dbChannel *chan;
+    dbEventSubscription sub;
+    epicsEventId done;
+    int count;
+    epicsInt32 last;
+    epicsInt32 expect;
+} subscriber;
+
+static void update(void *user_arg, struct dbChannel *chan,
+                   int eventsRemaining, struct db_field_log *pfl)
+{
+    subscriber *sub = user_arg;
+    epicsInt32 val = pfl->u.v.field.dbf_long;
+
+    epicsAtomicIncrIntT(&sub->count);
+    sub->last = val;
+    if (val == epicsAtomicGetIntT(&sub->expect))
+        epicsEventMustTrigger(sub->done);
+}
+
+static void runBench(xRecord *prec, unsigned nsub, unsigned niter, unsigned nrep)
+{
+    subscriber *subs;
+    double *reptimes;
+    unsigned i, rep;
+    epicsInt32 val = 0;
+
+    testDiag("%u subscribers, %u reps of %u posts", nsub, nrep, niter);
+
+    subs = callocMustSucceed(nsub, sizeof(*subs), "runBench");
+    reptimes = callocMustSucceed(nrep, sizeof(*reptimes), "runBench");
+
+    for (i = 0; i < nsub; i++) {
+        subscriber *sub = &subs[i];
+
+        sub->expect = -1;
+        sub->done = epicsEventMustCreate(epicsEventEmpty);
+        sub->ctx = db_init_events();
+        if (!sub->ctx ||
+                db_start_events(sub->ctx, "benchEv", NULL, NULL,
+                                epicsThreadPriorityCAServerLow) != DB_EVENT_OK)
+            testAbort("Failed to start event context");
+        sub->chan = dbChannelCreate("x.VAL");
+        if (!sub->chan || dbChannelOpen(sub->chan))
+            testAbort("Failed to open channel x.VAL");
+        sub->sub = db_add_event(sub->ctx, sub->chan, update, sub, DBE_VALUE);
+        if (!sub->sub)
+            testAbort("db_add_event() fails");
+        db_event_enable(sub->sub);
+    }
+
+    for (rep = 0; rep < nrep; rep++) {
+        epicsTimeStamp start, stop;
+        unsigned ndelivered = 0, nok = 0;
+
+        for (i = 0; i < nsub; i++) {
+            epicsAtomicSetIntT(&subs[i].count, 0);
+            epicsAtomicSetIntT(&subs[i].expect, val + niter - 1);
+        }
+
+        epicsTimeGetCurrent(&start);
+        for (i = 0; i < niter; i++) {
+            dbScanLock((dbCommon*)prec);
+            prec->val = val++;
+            db_post_events(prec, &prec->val, DBE_VALUE);
+            dbScanUnlock((dbCommon*)prec);
+        }
+        epicsTimeGetCurrent(&stop);
+
+        reptimes[rep] = epicsTimeDiffInSeconds(&stop, &start);
+
+        for (i = 0; i < nsub; i++) {
+            if (epicsEventWaitWithTimeout(subs[i].done, 10.0) == epicsEventOK &&
+                    subs[i].last == val - 1)
+                nok++;
+            ndelivered += epicsAtomicGetIntT(&subs[i].count);
+        }
+        testOk(nok == nsub, "%u of %u subscribers saw final update", nok, nsub);
+
+        testDiag("%u posts in %.03f ms.  %.0f posts/s, %.1f%% delivered",
+                 niter, reptimes[rep]*1e3, niter/reptimes[rep],
+                 100.0*ndelivered/niter/nsub);
+    }
+
+    {
+        double sum=0, sum2=0, mean;
+        for (rep = 0; rep < nrep; rep++) {
+            sum += reptimes[rep];
+            sum2 += reptimes[rep]*reptimes[rep];
+        }
+
+        mean = sum/nrep;
+        testDiag("Final: %.04f ms +- %.05f ms.  %.3f us per post (for %u subscribers)",
+                 mean*1e3,
+                 sqrt(sum2/nrep - mean*mean)*1e3,
+                 mean/niter*1e6,
+                 nsub);
+    }
+
+    for (i = 0; i < nsub; i++) {
+        db_cancel_event(subs[i].sub);
+        db_close_events(subs[i].ctx);
+        dbChannelDelete(subs[i].chan);
+        epicsEventDestroy(subs[i].done);
+    }
+    free(reptimes);
+    free(subs);
+}
+
+MAIN(benchdbEvent)
+{
+    xRecord *prec;
+
+    testPlan(0);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    testIocInitOk();
+
+    prec = (xRecord*)testdbRecordPtr("x");
+
+    runBench(prec, 1, 10000, 5);
+    runBench(prec, 10, 10000, 5);
+    runBench(prec, 100, 1000, 5);
+    runBench(prec, 400, 1000, 5);
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
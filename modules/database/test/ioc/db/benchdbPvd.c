@@ -0,0 +1,165 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* Measure record name lookups per second in the process variable
+ * directory, for databases of different sizes.
+ *
+ *   benchdbPvd [nrecords ...]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbStaticLib.h"
+#include "dbUnitTest.h"
+#include "epicsTime.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+/* names looked up, in a random order */
+#define NSAMPLE 65536u
+
+static unsigned long seed = 1;
+
+static unsigned long nextRandom(void)
+{
+    seed = seed * 1103515245ul + 12345ul;
+    return (seed >> 8) & 0xffffff;
+}
+
+static void makeNames(char (*names)[32], const char *prefix,
+                      unsigned nrecords)
+{
+    unsigned i;
+
+    for (i = 0; i < NSAMPLE; i++)
+        sprintf(names[i], "%s:%lu", prefix,
+                ((nextRandom() << 8) ^ nextRandom()) % nrecords);
+}
+
+/* Look the names up for about a second, returns lookups per second */
+static double lookupRate(DBENTRY *pentry, char (*names)[32],
+                         unsigned *pfound)
+{
+    epicsTimeStamp start, now;
+    unsigned long nlookup = 0;
+    double elapsed;
+    unsigned i;
+
+    *pfound = 0;
+    epicsTimeGetCurrent(&start);
+    do {
+        for (i = 0; i < NSAMPLE; i++) {
+            if (dbFindRecord(pentry, names[i]) == 0)
+                (*pfound)++;
+        }
+        nlookup += NSAMPLE;
+        epicsTimeGetCurrent(&now);
+        elapsed = epicsTimeDiffInSeconds(&now, &start);
+    } while (elapsed < 1.0);
+    return nlookup / elapsed;
+}
+
+/* As lookupRate(), for dbChannelMayExist() over one pass of the names */
+static double filterRate(char (*names)[32], unsigned *ppassed)
+{
+    epicsTimeStamp start, now;
+    unsigned long ntest = 0;
+    double elapsed;
+    unsigned i;
+
+    epicsTimeGetCurrent(&start);
+    do {
+        *ppassed = 0;
+        for (i = 0; i < NSAMPLE; i++) {
+            if (dbChannelMayExist(names[i]))
+                (*ppassed)++;
+        }
+        ntest += NSAMPLE;
+        epicsTimeGetCurrent(&now);
+        elapsed = epicsTimeDiffInSeconds(&now, &start);
+    } while (elapsed < 1.0);
+    return ntest / elapsed;
+}
+
+static void runBench(unsigned nrecords)
+{
+    char (*names)[32] = calloc(NSAMPLE, sizeof(*names));
+    epicsTimeStamp start, stop;
+    DBENTRY entry;
+    unsigned i, found, rounds;
+    double rate;
+    char name[32];
+
+    if (!names)
+        testAbort("Out of memory");
+
+    testDiag("%u records", nrecords);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+    epicsTimeGetCurrent(&start);
+    for (i = 0; i < nrecords; i++) {
+        sprintf(name, "bench:%u", i);
+        if (dbCreateRecord(&entry, name))
+            break;
+    }
+    epicsTimeGetCurrent(&stop);
+    testOk(i == nrecords, "Created %u records in %.3f s", i,
+           epicsTimeDiffInSeconds(&stop, &start));
+
+    makeNames(names, "bench", nrecords);
+    rate = lookupRate(&entry, names, &found);
+    rounds = found / NSAMPLE;
+    testOk(found == rounds * NSAMPLE && rounds > 0,
+           "%u records: %.0f lookups/s of existing names", nrecords, rate);
+
+    makeNames(names, "missing", nrecords);
+    rate = lookupRate(&entry, names, &found);
+    testOk(found == 0,
+           "%u records: %.0f lookups/s of missing names", nrecords, rate);
+
+    rate = filterRate(names, &found);
+    testOk(found < NSAMPLE / 20,
+           "%u records: %.0f tests/s of missing names in the name filter, "
+           "%u of %u passed", nrecords, rate, found, NSAMPLE);
+
+    dbPvdDump(pdbbase, 0);
+
+    dbFinishEntry(&entry);
+    testdbCleanup();
+    free(names);
+}
+
+MAIN(benchdbPvd)
+{
+    static const unsigned defaults[] = {10000, 100000, 1000000};
+    int i;
+
+    testPlan(0);
+
+    if (argc > 1) {
+        for (i = 1; i < argc; i++)
+            runBench((unsigned) atoi(argv[i]));
+    }
+    else {
+        for (i = 0; i < (int) NELEMENTS(defaults); i++)
+            runBench(defaults[i]);
+    }
+
+    return testDone();
+}
@@ -0,0 +1,127 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* Measure periodic scan passes over a large list, with and without
+ * records being moved on and off the list while it is scanned.
+ *
+ *   benchdbScan [nrecords]
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "dbAccess.h"
+#include "dbScan.h"
+#include "dbStaticLib.h"
+#include "dbUnitTest.h"
+#include "epicsAtomic.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "menuScan.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define SCAN_RATE menuScan_1_second
+#define SCAN_NAME ".1 second"
+
+static int churnStop; // use atomic
+static unsigned long churnChanges;
+
+/* Move records off the list and back again, 100 changes a second */
+static void churn(void *arg)
+{
+    unsigned nrecords = *(unsigned *)arg;
+    unsigned i = 0;
+    char name[40];
+
+    while (!epicsAtomicGetIntT(&churnStop)) {
+        DBADDR addr;
+
+        sprintf(name, "bench:%u.SCAN", (i++ * 7919u) % nrecords);
+        if (dbNameToAddr(name, &addr) == 0) {
+            dbPutField(&addr, DBR_STRING, "Passive", 1);
+            dbPutField(&addr, DBR_STRING, SCAN_NAME, 1);
+            churnChanges += 2;
+        }
+        epicsThreadSleep(0.02);
+    }
+}
+
+static void measure(const char *what, unsigned nrecords, double seconds)
+{
+    scanPeriodicStats stats;
+
+    scanPeriodicStatus(SCAN_RATE, 1, NULL);
+    epicsThreadSleep(seconds);
+    scanPeriodicStatus(SCAN_RATE, 0, &stats);
+
+    testOk(stats.passes > 0 && stats.nRecords > nrecords / 2,
+        "%-8s %lu passes of %d records, %.2f ms (%.2f .. %.2f), "
+        "%.1f ns per record", what, stats.passes, stats.nRecords,
+        stats.timeMean * 1e3, stats.timeMin * 1e3, stats.timeMax * 1e3,
+        stats.timeMean * 1e9 / nrecords);
+}
+
+MAIN(benchdbScan)
+{
+    unsigned nrecords = 100000;
+    epicsThreadOpts opts = EPICS_THREAD_OPTS_INIT;
+    epicsThreadId tid;
+    epicsTimeStamp start, stop;
+    DBENTRY entry;
+    unsigned i;
+    char name[32];
+
+    if (argc > 1)
+        nrecords = strtoul(argv[1], NULL, 0);
+
+    testPlan(0);
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    /* Mixed PHAS, so the lists are not built in order */
+    dbInitEntry(pdbbase, &entry);
+    if (dbFindRecordType(&entry, "x"))
+        testAbort("No record type x");
+    for (i = 0; i < nrecords; i++) {
+        sprintf(name, "bench:%u", i);
+        if (dbCreateRecord(&entry, name) ||
+            dbFindField(&entry, "SCAN") ||
+            dbPutString(&entry, SCAN_NAME) ||
+            dbFindField(&entry, "PHAS"))
+            testAbort("Can't create %s", name);
+        sprintf(name, "%u", i % 4);
+        dbPutString(&entry, name);
+    }
+    dbFinishEntry(&entry);
+
+    epicsTimeGetCurrent(&start);
+    testIocInitOk();
+    epicsTimeGetCurrent(&stop);
+    testDiag("iocInit with %u periodic records took %.3f s", nrecords,
+        epicsTimeDiffInSeconds(&stop, &start));
+
+    measure("static", nrecords, 3.0);
+
+    opts.joinable = 1;
+    opts.priority = epicsThreadPriorityScanHigh;
+    tid = epicsThreadCreateOpt("churn", churn, &nrecords, &opts);
+    measure("churn", nrecords, 3.0);
+    epicsAtomicSetIntT(&churnStop, 1);
+    epicsThreadMustJoin(tid);
+    testDiag("%lu SCAN changes during the churn passes", churnChanges);
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
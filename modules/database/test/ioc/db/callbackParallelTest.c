@@ -20,6 +20,8 @@
 
 #include "callback.h"
 #include "cantProceed.h"
+#include "dbAccessDefs.h"
+#include "epicsAtomic.h"
 #include "epicsThread.h"
 #include "epicsEvent.h"
 #include "epicsTime.h"
@@ -96,6 +98,105 @@ static void printStats(double *stats, const char* tag) {
             sqrt(stats[4]*stats[3]-pow(stats[2], 2.0))/stats[4]);
 }
 
+/*
+ * The queues of a busy priority grow to hold up to 16 times the
+ * configured queue size before requests are refused.
+ */
+
+#define GROW_THREADS 2
+#define GROW_SIZE 8
+#define GROW_MAX (16 * GROW_SIZE)
+
+typedef struct blocker {
+    epicsCallback cb;
+    epicsEventId started;
+    epicsEventId release;
+} blocker;
+
+static int growCount;
+
+static void blockCallback(epicsCallback *pCallback)
+{
+    blocker *pblock;
+
+    callbackGetUser(pblock, pCallback);
+    epicsEventSignal(pblock->started);
+    epicsEventMustWait(pblock->release);
+}
+
+static void countCallback(epicsCallback *pCallback)
+{
+    if (epicsAtomicIncrIntT(&growCount) == GROW_MAX)
+        epicsEventSignal(finished);
+}
+
+static void testQueueGrowth(void)
+{
+    blocker block[GROW_THREADS];
+    epicsCallback *pcb = callocMustSucceed(GROW_MAX + 1, sizeof(epicsCallback),
+        "testQueueGrowth");
+    callbackQueueStats stats;
+    int oldSize = callbackGetQueueSize();
+    int i, fails = 0;
+
+    testDiag("Queue growth with %d threads, queue size %d",
+        GROW_THREADS, GROW_SIZE);
+
+    callbackSetQueueSize(GROW_SIZE);
+    callbackParallelThreads(GROW_THREADS, "");
+    callbackInit();
+
+    /* Keep every thread busy */
+    for (i = 0; i < GROW_THREADS; i++) {
+        block[i].started = epicsEventMustCreate(epicsEventEmpty);
+        block[i].release = epicsEventMustCreate(epicsEventEmpty);
+        callbackSetCallback(blockCallback, &block[i].cb);
+        callbackSetPriority(priorityLow, &block[i].cb);
+        callbackSetUser(&block[i], &block[i].cb);
+        callbackRequest(&block[i].cb);
+    }
+    for (i = 0; i < GROW_THREADS; i++)
+        epicsEventMustWait(block[i].started);
+
+    for (i = 0; i <= GROW_MAX; i++) {
+        callbackSetCallback(countCallback, &pcb[i]);
+        callbackSetPriority(priorityLow, &pcb[i]);
+        if (i < GROW_MAX)
+            fails += callbackRequest(&pcb[i]) != 0;
+    }
+    testOk(fails == 0, "%d requests beyond the queue size, %d refused",
+        GROW_MAX - GROW_SIZE, fails);
+    testOk(callbackRequest(&pcb[GROW_MAX]) == S_db_bufFull,
+        "Request beyond the growth limit refused");
+
+    callbackQueueStatus(0, &stats);
+    testOk(stats.numUsed[priorityLow] == GROW_MAX &&
+        stats.maxUsed[priorityLow] == GROW_MAX &&
+        stats.numOverflow[priorityLow] == 1,
+        "Queue status used %d max %d overflows %d",
+        stats.numUsed[priorityLow], stats.maxUsed[priorityLow],
+        stats.numOverflow[priorityLow]);
+    testOk(stats.size == GROW_MAX, "Queue status size %d", stats.size);
+
+    for (i = 0; i < GROW_THREADS; i++)
+        epicsEventSignal(block[i].release);
+    epicsEventMustWait(finished);
+    testOk(epicsAtomicGetIntT(&growCount) == GROW_MAX,
+        "%d callbacks run", epicsAtomicGetIntT(&growCount));
+
+    callbackQueueStatus(0, &stats);
+    testOk1(stats.numUsed[priorityLow] == 0);
+
+    callbackStop();
+    callbackCleanup();
+    callbackSetQueueSize(oldSize);
+    for (i = 0; i < GROW_THREADS; i++) {
+        epicsEventDestroy(block[i].started);
+        epicsEventDestroy(block[i].release);
+    }
+    free(pcb);
+}
+
 MAIN(callbackParallelTest)
 {
     myPvt *pcbt[NCALLBACKS];
@@ -111,7 +212,7 @@ MAIN(callbackParallelTest)
         for (j = 0; j < 5; j++)
             setupError[i][j] = timeError[i][j] = defaultError[j];
 
-    testPlan(2);
+    testPlan(8);
 
     testDiag("Starting %d parallel callback threads", noCpus);
 
@@ -206,5 +307,7 @@ MAIN(callbackParallelTest)
     callbackStop();
     callbackCleanup();
 
+    testQueueGrowth();
+
     return testDone();
 }
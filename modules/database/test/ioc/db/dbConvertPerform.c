@@ -0,0 +1,223 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Check the array conversions of dbGetConvertRoutine and
+ * dbPutConvertRoutine between the numeric types against converting one
+ * element at a time, including a circular array which wraps around, then
+ * measure their speed for some common pairs.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+#include "cantProceed.h"
+#include "dbAddr.h"
+#include "dbConvert.h"
+#include "dbDefs.h"
+#include "epicsStdio.h"
+#include "epicsTime.h"
+#include "epicsTypes.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+static const char * const typeNames[] = {
+    "STRING", "CHAR", "UCHAR", "SHORT", "USHORT", "LONG", "ULONG",
+    "INT64", "UINT64", "FLOAT", "DOUBLE", "ENUM"
+};
+
+static const size_t typeSizes[] = {
+    0, sizeof(epicsInt8), sizeof(epicsUInt8), sizeof(epicsInt16),
+    sizeof(epicsUInt16), sizeof(epicsInt32), sizeof(epicsUInt32),
+    sizeof(epicsInt64), sizeof(epicsUInt64), sizeof(epicsFloat32),
+    sizeof(epicsFloat64), sizeof(epicsEnum16)
+};
+
+/* Values which every numeric type can hold */
+static void fillArray(void *parray, short type, long n)
+{
+    long i;
+
+    for (i = 0; i < n; i++) {
+        int value = (int)(i % 101);
+
+        switch (type) {
+        case DBF_CHAR:   ((epicsInt8 *) parray)[i] = value; break;
+        case DBF_UCHAR:  ((epicsUInt8 *) parray)[i] = value; break;
+        case DBF_SHORT:  ((epicsInt16 *) parray)[i] = value; break;
+        case DBF_USHORT: ((epicsUInt16 *) parray)[i] = value; break;
+        case DBF_LONG:   ((epicsInt32 *) parray)[i] = value; break;
+        case DBF_ULONG:  ((epicsUInt32 *) parray)[i] = value; break;
+        case DBF_INT64:  ((epicsInt64 *) parray)[i] = value; break;
+        case DBF_UINT64: ((epicsUInt64 *) parray)[i] = value; break;
+        case DBF_FLOAT:  ((epicsFloat32 *) parray)[i] = value + 0.25f; break;
+        case DBF_DOUBLE: ((epicsFloat64 *) parray)[i] = value + 0.25; break;
+        case DBF_ENUM:   ((epicsEnum16 *) parray)[i] = value; break;
+        }
+    }
+}
+
+static void setAddr(DBADDR *paddr, short type, void *pfield, long n)
+{
+    memset(paddr, 0, sizeof(*paddr));
+    paddr->field_type = type;
+    paddr->field_size = (short) typeSizes[type];
+    paddr->no_elements = n;
+    paddr->pfield = pfield;
+}
+
+/* Read nRequest elements starting at offset one at a time */
+static void getReference(short from, short to, char *pfield, char *pto,
+    long nRequest, long no_elements, long offset)
+{
+    GETCONVERTFUNC getter = dbGetConvertRoutine[from][to];
+    DBADDR addr;
+    long i;
+
+    for (i = 0; i < nRequest; i++) {
+        long j = (offset + i) % no_elements;
+
+        setAddr(&addr, from, pfield + j * typeSizes[from], 1);
+        getter(&addr, pto + i * typeSizes[to], 1, 1, 0);
+    }
+}
+
+/* Write nRequest elements starting at offset one at a time */
+static void putReference(short from, short to, const char *pfrom,
+    char *pfield, long nRequest, long no_elements, long offset)
+{
+    PUTCONVERTFUNC putter = dbPutConvertRoutine[from][to];
+    DBADDR addr;
+    long i;
+
+    for (i = 0; i < nRequest; i++) {
+        long j = (offset + i) % no_elements;
+
+        setAddr(&addr, to, pfield + j * typeSizes[to], 1);
+        putter(&addr, pfrom + i * typeSizes[from], 1, 1, 0);
+    }
+}
+
+static void checkPair(short from, short to, long n, long offset)
+{
+    char *psrc = callocMustSucceed(n, typeSizes[from], "checkPair");
+    char *pdst = callocMustSucceed(n, typeSizes[to], "checkPair");
+    char *pref = callocMustSucceed(n, typeSizes[to], "checkPair");
+    DBADDR addr;
+
+    fillArray(psrc, from, n);
+
+    setAddr(&addr, from, psrc, n);
+    dbGetConvertRoutine[from][to](&addr, pdst, n, n, offset);
+    getReference(from, to, psrc, pref, n, n, offset);
+    testOk(memcmp(pdst, pref, n * typeSizes[to]) == 0,
+        "get DBF_%s -> DBR_%s, offset %ld",
+        typeNames[from], typeNames[to], offset);
+
+    memset(pdst, 0, n * typeSizes[to]);
+    memset(pref, 0, n * typeSizes[to]);
+    setAddr(&addr, to, pdst, n);
+    dbPutConvertRoutine[from][to](&addr, psrc, n, n, offset);
+    putReference(from, to, psrc, pref, n, n, offset);
+    testOk(memcmp(pdst, pref, n * typeSizes[to]) == 0,
+        "put DBR_%s -> DBF_%s, offset %ld",
+        typeNames[from], typeNames[to], offset);
+
+    free(psrc);
+    free(pdst);
+    free(pref);
+}
+
+/* Elements per second converting an array for about a quarter second */
+static double rate(short from, short to, int put, int bulk, long n)
+{
+    char *psrc = callocMustSucceed(n, typeSizes[from], "rate");
+    char *pdst = callocMustSucceed(n, typeSizes[to], "rate");
+    epicsTimeStamp start, now;
+    unsigned long passes = 0;
+    double elapsed;
+    DBADDR addr;
+
+    fillArray(psrc, from, n);
+    if (put)
+        setAddr(&addr, to, pdst, n);
+    else
+        setAddr(&addr, from, psrc, n);
+
+    epicsTimeGetCurrent(&start);
+    do {
+        if (!bulk && put)
+            putReference(from, to, psrc, pdst, n, n, 0);
+        else if (!bulk)
+            getReference(from, to, psrc, pdst, n, n, 0);
+        else if (put)
+            dbPutConvertRoutine[from][to](&addr, psrc, n, n, 0);
+        else
+            dbGetConvertRoutine[from][to](&addr, pdst, n, n, 0);
+        passes++;
+        epicsTimeGetCurrent(&now);
+        elapsed = epicsTimeDiffInSeconds(&now, &start);
+    } while (elapsed < 0.25);
+
+    free(psrc);
+    free(pdst);
+    return passes * n / elapsed;
+}
+
+static const struct {
+    short from, to;
+} timedPairs[] = {
+    {DBF_DOUBLE, DBR_DOUBLE},
+    {DBF_DOUBLE, DBR_FLOAT},
+    {DBF_FLOAT, DBR_DOUBLE},
+    {DBF_LONG, DBR_DOUBLE},
+    {DBF_DOUBLE, DBR_LONG},
+    {DBF_SHORT, DBR_DOUBLE},
+    {DBF_USHORT, DBR_LONG},
+    {DBF_CHAR, DBR_SHORT},
+    {DBF_INT64, DBR_DOUBLE},
+};
+
+static void runBench(long n)
+{
+    size_t i;
+
+    testDiag("%ld element arrays, million elements/s", n);
+    testDiag("%-18s %12s %12s %12s %12s", "", "get", "get",
+        "put", "put");
+    testDiag("%-18s %12s %12s %12s %12s", "", "per element",
+        "array", "per element", "array");
+
+    for (i = 0; i < NELEMENTS(timedPairs); i++) {
+        short from = timedPairs[i].from;
+        short to = timedPairs[i].to;
+        char name[40];
+
+        epicsSnprintf(name, sizeof(name), "%s -> %s",
+            typeNames[from], typeNames[to]);
+        testDiag("%-18s %12.1f %12.1f %12.1f %12.1f", name,
+            rate(from, to, 0, 0, n) / 1e6, rate(from, to, 0, 1, n) / 1e6,
+            rate(to, from, 1, 0, n) / 1e6, rate(to, from, 1, 1, n) / 1e6);
+    }
+}
+
+MAIN(dbConvertPerform)
+{
+    short from, to;
+
+    testPlan(0);
+
+    for (from = DBF_CHAR; from <= DBF_ENUM; from++) {
+        for (to = DBR_CHAR; to <= DBR_ENUM; to++) {
+            checkPair(from, to, 1000, 0);
+            checkPair(from, to, 1001, 337);
+        }
+    }
+
+    runBench(1000);
+    runBench(1000000);
+
+    return testDone();
+}
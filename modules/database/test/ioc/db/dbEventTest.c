@@ -0,0 +1,704 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+#define EPICS_PRIVATE_API
+
+#include <string.h>
+#include <limits.h>
+
+#include "dbAccess.h"
+#include "dbChannel.h"
+#include "dbEvent.h"
+#include "db_field_log.h"
+#include "dbLock.h"
+#include "dbUnitTest.h"
+#include "caeventmask.h"
+#include "epicsEvent.h"
+#include "epicsMutex.h"
+#include "epicsThread.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+#include "xRecord.h"
+#include "arrRecord.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define MAXUPDATES 10
+
+typedef struct {
+    epicsEventId done;
+    epicsInt32 last;
+    unsigned count;
+    epicsInt32 values[MAXUPDATES];
+} monitor;
+
+static epicsMutexId lock;
+
+static void update(void *user_arg, struct dbChannel *chan,
+                   int eventsRemaining, struct db_field_log *pfl)
+{
+    monitor *mon = user_arg;
+    epicsInt32 val = pfl->u.v.field.dbf_long;
+
+    epicsMutexMustLock(lock);
+    if (mon->count < MAXUPDATES)
+        mon->values[mon->count] = val;
+    mon->count++;
+    epicsMutexUnlock(lock);
+    if (val == mon->last)
+        epicsEventMustTrigger(mon->done);
+}
+
+static void post(xRecord *prec, epicsInt32 val)
+{
+    dbScanLock((dbCommon*)prec);
+    prec->val = val;
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    dbScanUnlock((dbCommon*)prec);
+}
+
+static void testDepth(xRecord *prec)
+{
+    dbEventCtx ctx;
+    dbChannel *chan;
+    dbEventSubscription limited, unlimited;
+    monitor mlim, munlim;
+    epicsInt32 i;
+
+    testDiag("Per-subscription queue depth");
+
+    memset(&mlim, 0, sizeof(mlim));
+    memset(&munlim, 0, sizeof(munlim));
+    mlim.done = epicsEventMustCreate(epicsEventEmpty);
+    munlim.done = epicsEventMustCreate(epicsEventEmpty);
+    mlim.last = munlim.last = 5;
+
+    ctx = db_init_events();
+    testOk1(ctx!=NULL);
+    testOk1(db_event_queue_geometry(ctx, 0, 8)==DB_EVENT_ERROR);
+    testOk1(db_event_queue_geometry(ctx, 4, 8)==DB_EVENT_OK);
+
+    chan = dbChannelCreate("x.VAL");
+    testOk1(chan && !dbChannelOpen(chan));
+
+    limited = db_add_event_depth(ctx, chan, update, &mlim, DBE_VALUE, 2);
+    unlimited = db_add_event(ctx, chan, update, &munlim, DBE_VALUE);
+    testOk1(limited && unlimited);
+    db_event_enable(limited);
+    db_event_enable(unlimited);
+
+    /* queue up events before the event task runs */
+    for (i = 1; i <= 5; i++)
+        post(prec, i);
+
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+                            epicsThreadPriorityLow)==DB_EVENT_OK);
+    testOk(db_event_queue_geometry(ctx, 4, 8)==DB_EVENT_ERROR,
+           "Geometry can't change after db_start_events()");
+
+    testOk1(epicsEventWaitWithTimeout(mlim.done, 10.0)==epicsEventOK);
+    testOk1(epicsEventWaitWithTimeout(munlim.done, 10.0)==epicsEventOK);
+
+    epicsMutexMustLock(lock);
+    testOk(mlim.count==2, "depth 2 delivered %u updates", mlim.count);
+    testOk(mlim.values[0]==1 && mlim.values[1]==5,
+           "first and last values delivered (%d, %d)",
+           (int)mlim.values[0], (int)mlim.values[1]);
+    testOk(munlim.count==5, "no depth delivered %u updates", munlim.count);
+    epicsMutexUnlock(lock);
+
+    db_cancel_event(limited);
+    db_cancel_event(unlimited);
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+    epicsEventDestroy(mlim.done);
+    epicsEventDestroy(munlim.done);
+}
+
+static void testHugeDepth(xRecord *prec)
+{
+    dbEventCtx ctx;
+    dbChannel *chan;
+    dbEventSubscription sub[2];
+    monitor mon[2];
+    int i;
+
+    testDiag("Depths beyond the queue size limit");
+
+    ctx = db_init_events();
+    testOk1(ctx!=NULL);
+    testOk1(db_event_queue_geometry(ctx, 4, 100000)==DB_EVENT_OK);
+
+    chan = dbChannelCreate("x.VAL");
+    testOk1(chan && !dbChannelOpen(chan));
+
+    for (i = 0; i < 2; i++) {
+        memset(&mon[i], 0, sizeof(mon[i]));
+        mon[i].done = epicsEventMustCreate(epicsEventEmpty);
+        mon[i].last = 7;
+    }
+    sub[0] = db_add_event_depth(ctx, chan, update, &mon[0], DBE_VALUE, 65536);
+    sub[1] = db_add_event_depth(ctx, chan, update, &mon[1], DBE_VALUE,
+                                UINT_MAX);
+    testOk(sub[0] && sub[1], "Subscriptions with depths 65536 and UINT_MAX");
+
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+                            epicsThreadPriorityLow)==DB_EVENT_OK);
+    for (i = 0; i < 2; i++)
+        if (sub[i])
+            db_event_enable(sub[i]);
+    post(prec, 7);
+    for (i = 0; i < 2; i++)
+        testOk(sub[i] &&
+               epicsEventWaitWithTimeout(mon[i].done, 10.0)==epicsEventOK,
+               "Update delivered to subscription %d", i);
+
+    for (i = 0; i < 2; i++) {
+        if (sub[i])
+            db_cancel_event(sub[i]);
+        epicsEventDestroy(mon[i].done);
+    }
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+}
+
+static void testChained(xRecord *prec)
+{
+    dbEventCtx ctx;
+    dbChannel *chan;
+    dbEventSubscription subs[20];
+    monitor mons[20];
+    unsigned i, nok = 0;
+
+    testDiag("Subscriptions spread over chained queues");
+
+    memset(mons, 0, sizeof(mons));
+
+    ctx = db_init_events();
+    testOk1(ctx!=NULL);
+    /* room for a single subscription in the first queue */
+    testOk1(db_event_queue_geometry(ctx, 2, 4)==DB_EVENT_OK);
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+                            epicsThreadPriorityLow)==DB_EVENT_OK);
+
+    chan = dbChannelCreate("x.VAL");
+    testOk1(chan && !dbChannelOpen(chan));
+
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        mons[i].done = epicsEventMustCreate(epicsEventEmpty);
+        mons[i].last = 42;
+        subs[i] = db_add_event(ctx, chan, update, &mons[i], DBE_VALUE);
+        if (subs[i])
+            db_event_enable(subs[i]);
+    }
+
+    post(prec, 42);
+
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        if (subs[i] &&
+                epicsEventWaitWithTimeout(mons[i].done, 10.0)==epicsEventOK)
+            nok++;
+    }
+    testOk(nok==NELEMENTS(subs), "%u of %u subscriptions updated",
+           nok, (unsigned)NELEMENTS(subs));
+
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        if (subs[i])
+            db_cancel_event(subs[i]);
+    }
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+    for (i = 0; i < NELEMENTS(subs); i++)
+        epicsEventDestroy(mons[i].done);
+}
+
+static void testNeverStarted(void)
+{
+    dbEventCtx ctx;
+    dbChannel *chan;
+    dbEventSubscription subs[4];
+    monitor mon;
+    unsigned i, nsubs = 0;
+
+    testDiag("Close a context whose event task never ran");
+
+    memset(&mon, 0, sizeof(mon));
+
+    ctx = db_init_events();
+    testOk1(ctx!=NULL);
+    testOk1(db_event_queue_geometry(ctx, 2, 4)==DB_EVENT_OK);
+
+    chan = dbChannelCreate("x.VAL");
+    testOk1(chan && !dbChannelOpen(chan));
+
+    /* chain queues which only db_close_events() can free */
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        subs[i] = db_add_event(ctx, chan, update, &mon, DBE_VALUE);
+        if (subs[i])
+            nsubs++;
+    }
+    testOk(nsubs==NELEMENTS(subs), "%u of %u subscriptions added",
+           nsubs, (unsigned)NELEMENTS(subs));
+
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        if (subs[i])
+            db_cancel_event(subs[i]);
+    }
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+}
+
+typedef struct {
+    monitor mon;
+    epicsThreadId tid;
+} shardMonitor;
+
+static void shardUpdate(void *user_arg, struct dbChannel *chan,
+                        int eventsRemaining, struct db_field_log *pfl)
+{
+    shardMonitor *smon = user_arg;
+
+    smon->tid = epicsThreadGetIdSelf();
+    update(&smon->mon, chan, eventsRemaining, pfl);
+}
+
+static void testShards(xRecord *prec)
+{
+    dbEventCtx ctx;
+    dbChannel *chan;
+    dbEventSubscription subs[9];
+    shardMonitor mons[9];
+    epicsThreadId tids[3];
+    unsigned i, j, ntids = 0, nok = 0, nordered = 0;
+    epicsInt32 val;
+
+    testDiag("Subscriptions spread over several event tasks");
+
+    memset(mons, 0, sizeof(mons));
+
+    ctx = db_init_events();
+    testOk1(ctx!=NULL);
+    testOk1(db_event_shard_count(ctx)==1);
+    testOk1(db_event_shards(ctx, 0)==DB_EVENT_ERROR);
+    testOk1(db_event_shards(ctx, 3)==DB_EVENT_OK);
+    testOk1(db_event_shard_count(ctx)==3);
+    /* several queues per task */
+    testOk1(db_event_queue_geometry(ctx, 2, 4)==DB_EVENT_OK);
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+                            epicsThreadPriorityLow)==DB_EVENT_OK);
+    testOk(db_event_shards(ctx, 2)==DB_EVENT_ERROR,
+           "Task count can't change after db_start_events()");
+
+    chan = dbChannelCreate("x.VAL");
+    testOk1(chan && !dbChannelOpen(chan));
+
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        mons[i].mon.done = epicsEventMustCreate(epicsEventEmpty);
+        mons[i].mon.last = 5;
+        subs[i] = db_add_event(ctx, chan, shardUpdate, &mons[i], DBE_VALUE);
+        if (subs[i])
+            db_event_enable(subs[i]);
+    }
+
+    for (val = 1; val <= 5; val++)
+        post(prec, val);
+
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        if (subs[i] &&
+                epicsEventWaitWithTimeout(mons[i].mon.done, 10.0)==epicsEventOK)
+            nok++;
+    }
+    testOk(nok==NELEMENTS(subs), "%u of %u subscriptions updated",
+           nok, (unsigned)NELEMENTS(subs));
+
+    epicsMutexMustLock(lock);
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        const monitor *mon = &mons[i].mon;
+        unsigned n = mon->count < MAXUPDATES ? mon->count : MAXUPDATES;
+        int ordered = n > 0 && mon->values[n - 1] == 5;
+
+        for (j = 1; j < n; j++)
+            ordered &= mon->values[j - 1] < mon->values[j];
+        if (ordered)
+            nordered++;
+
+        for (j = 0; j < ntids && tids[j] != mons[i].tid; j++)
+            ;
+        if (j == ntids && ntids < NELEMENTS(tids))
+            tids[ntids++] = mons[i].tid;
+    }
+    epicsMutexUnlock(lock);
+    testOk(nordered==NELEMENTS(subs), "%u of %u subscriptions in order",
+           nordered, (unsigned)NELEMENTS(subs));
+    testOk(ntids==3, "callbacks from %u tasks", ntids);
+
+    for (i = 0; i < NELEMENTS(subs); i++) {
+        if (subs[i])
+            db_cancel_event(subs[i]);
+    }
+    db_close_events(ctx);
+    dbChannelDelete(chan);
+    for (i = 0; i < NELEMENTS(subs); i++)
+        epicsEventDestroy(mons[i].mon.done);
+}
+
+typedef struct {
+    epicsEventId done;
+    unsigned count;
+    unsigned mask;
+} fieldMonitor;
+
+static void fieldUpdate(void *user_arg, struct dbChannel *chan,
+                        int eventsRemaining, struct db_field_log *pfl)
+{
+    fieldMonitor *mon = user_arg;
+
+    epicsMutexMustLock(lock);
+    mon->count++;
+    mon->mask |= pfl->mask;
+    epicsMutexUnlock(lock);
+    epicsEventMustTrigger(mon->done);
+}
+
+static void testPostMany(xRecord *prec)
+{
+    static const char * const names[3] = {"x.VAL", "x.I32", "x.U32"};
+    static const unsigned selects[3] = {
+        DBE_VALUE, DBE_VALUE | DBE_LOG, DBE_LOG
+    };
+    dbEventCtx ctx;
+    dbChannel *chans[3];
+    dbEventSubscription subs[3];
+    fieldMonitor mons[3];
+    db_post_field posts[4];
+    unsigned i, nposts = 0;
+
+    testDiag("Post several fields with db_post_events_many()");
+
+    memset(mons, 0, sizeof(mons));
+
+    ctx = db_init_events();
+    testOk1(ctx!=NULL);
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+                            epicsThreadPriorityLow)==DB_EVENT_OK);
+
+    for (i = 0; i < 3; i++) {
+        mons[i].done = epicsEventMustCreate(epicsEventEmpty);
+        chans[i] = dbChannelCreate(names[i]);
+        if (!chans[i] || dbChannelOpen(chans[i]))
+            testAbort("Failed to open channel %s", names[i]);
+        subs[i] = db_add_event(ctx, chans[i], fieldUpdate, &mons[i],
+                               selects[i]);
+        if (!subs[i])
+            testAbort("db_add_event(%s) fails", names[i]);
+        db_event_enable(subs[i]);
+    }
+
+    DB_POST_FIELD(posts, nposts, &prec->val, DBE_VALUE);
+    DB_POST_FIELD(posts, nposts, &prec->i32, DBE_LOG);
+    DB_POST_FIELD(posts, nposts, &prec->i32, DBE_VALUE);
+    DB_POST_FIELD(posts, nposts, &prec->u32, DBE_VALUE);
+    testOk1(nposts==4);
+
+    dbScanLock((dbCommon*)prec);
+    db_post_events_many(prec, posts, nposts);
+    dbScanUnlock((dbCommon*)prec);
+
+    testOk1(epicsEventWaitWithTimeout(mons[0].done, 10.0)==epicsEventOK);
+    testOk1(epicsEventWaitWithTimeout(mons[1].done, 10.0)==epicsEventOK);
+
+    /* events are delivered in order, so U32 would have been seen by now */
+    dbScanLock((dbCommon*)prec);
+    db_post_events(prec, &prec->u32, DBE_LOG);
+    dbScanUnlock((dbCommon*)prec);
+    testOk1(epicsEventWaitWithTimeout(mons[2].done, 10.0)==epicsEventOK);
+
+    epicsMutexMustLock(lock);
+    testOk(mons[0].count==1 && mons[0].mask==DBE_VALUE,
+           "VAL: %u updates, mask 0x%x", mons[0].count, mons[0].mask);
+    testOk(mons[1].count==1 && mons[1].mask==(DBE_VALUE|DBE_LOG),
+           "I32: %u updates, mask 0x%x", mons[1].count, mons[1].mask);
+    testOk(mons[2].count==1 && mons[2].mask==DBE_LOG,
+           "U32: %u updates, mask 0x%x", mons[2].count, mons[2].mask);
+    epicsMutexUnlock(lock);
+
+    for (i = 0; i < 3; i++) {
+        db_cancel_event(subs[i]);
+        dbChannelDelete(chans[i]);
+    }
+    db_close_events(ctx);
+    for (i = 0; i < 3; i++)
+        epicsEventDestroy(mons[i].done);
+}
+
+static int waitCount(fieldMonitor *mon, unsigned expect)
+{
+    unsigned count;
+
+    for (;;) {
+        epicsMutexMustLock(lock);
+        count = mon->count;
+        epicsMutexUnlock(lock);
+        if (count >= expect)
+            return count == expect;
+        if (epicsEventWaitWithTimeout(mon->done, 10.0) != epicsEventOK)
+            return 0;
+    }
+}
+
+static void testFieldIndex(xRecord *prec)
+{
+    /* interleaved, so runs of the same field must be regrouped */
+    static const char * const names[6] = {
+        "x.VAL", "x.I32", "x.VAL", "x.F64", "x.VAL", "x.I32"
+    };
+    static const unsigned expect[6] = {2, 0, 0, 1, 2, 2};
+    dbEventCtx ctx;
+    dbChannel *chans[6];
+    dbEventSubscription subs[6];
+    fieldMonitor mons[6];
+    unsigned i;
+
+    testDiag("Subscriptions indexed by field");
+
+    memset(mons, 0, sizeof(mons));
+
+    ctx = db_init_events();
+    testOk1(ctx!=NULL);
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+                            epicsThreadPriorityLow)==DB_EVENT_OK);
+
+    for (i = 0; i < 6; i++) {
+        mons[i].done = epicsEventMustCreate(epicsEventEmpty);
+        chans[i] = dbChannelCreate(names[i]);
+        if (!chans[i] || dbChannelOpen(chans[i]))
+            testAbort("Failed to open channel %s", names[i]);
+        subs[i] = db_add_event(ctx, chans[i], fieldUpdate, &mons[i],
+                               DBE_VALUE | DBE_PROPERTY);
+        if (!subs[i])
+            testAbort("db_add_event(%s) fails", names[i]);
+        db_event_enable(subs[i]);
+    }
+    testOk1(ellCount(&prec->mlis)==6);
+
+    /* subscriptions to a field stay in the order they were added */
+    {
+        int seen[6] = {0, 0, 0, 0, 0, 0};
+        int ordered = 1;
+        ELLNODE *node;
+
+        for (node = ellFirst(&prec->mlis); node; node = ellNext(node)) {
+            unsigned j, k;
+
+            for (j = 0; j < 6 && (ELLNODE *)subs[j] != node; j++)
+                ;
+            if (j == 6) {
+                ordered = 0;
+                break;
+            }
+            for (k = j + 1; k < 6; k++)
+                if (seen[k] && !strcmp(names[k], names[j]))
+                    ordered = 0;
+            seen[j] = 1;
+        }
+        testOk(ordered, "Subscriptions of each field in order");
+    }
+
+    /* the first I32 and a VAL from the middle of its run */
+    db_cancel_event(subs[1]);
+    db_cancel_event(subs[2]);
+    subs[1] = subs[2] = NULL;
+    testOk1(ellCount(&prec->mlis)==4);
+
+    dbScanLock((dbCommon*)prec);
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    db_post_events(prec, &prec->i32, DBE_VALUE);
+    db_post_events(prec, &prec->u32, DBE_VALUE);
+    db_post_events(prec, NULL, DBE_PROPERTY);
+    dbScanUnlock((dbCommon*)prec);
+
+    for (i = 0; i < 6; i++) {
+        if (!subs[i])
+            continue;
+        testOk(waitCount(&mons[i], expect[i]), "%s #%u: %u updates",
+               names[i], i, mons[i].count);
+    }
+
+    for (i = 0; i < 6; i++) {
+        if (subs[i])
+            db_cancel_event(subs[i]);
+        dbChannelDelete(chans[i]);
+    }
+    testOk1(ellCount(&prec->mlis)==0 && prec->midx==NULL);
+    db_close_events(ctx);
+    for (i = 0; i < 6; i++)
+        epicsEventDestroy(mons[i].done);
+}
+
+typedef struct {
+    epicsEventId done;
+    unsigned count;
+    int shared;
+    int hold;
+    void *held;
+    long nelem[MAXUPDATES];
+    epicsInt32 first[MAXUPDATES];
+} arrayMonitor;
+
+static void arrayUpdate(void *user_arg, struct dbChannel *chan,
+                        int eventsRemaining, struct db_field_log *pfl)
+{
+    arrayMonitor *mon = user_arg;
+    epicsInt32 buf[10];
+    long nReq = NELEMENTS(buf);
+
+    memset(buf, 0, sizeof(buf));
+    /* a snapshot doesn't need the record lock */
+    if (dbChannelGet(chan, DBR_LONG, buf, NULL, &nReq, pfl))
+        nReq = -1;
+
+    epicsMutexMustLock(lock);
+    if (mon->count < MAXUPDATES) {
+        mon->nelem[mon->count] = nReq;
+        mon->first[mon->count] = buf[0];
+    }
+    mon->shared |= dbfl_has_copy(pfl);
+    if (mon->hold && !mon->held)
+        mon->held = db_field_log_hold_snapshot(pfl);
+    mon->count++;
+    epicsMutexUnlock(lock);
+    epicsEventMustTrigger(mon->done);
+}
+
+static void postArray(arrRecord *prec, const epicsInt32 *vals, long n)
+{
+    dbScanLock((dbCommon*)prec);
+    memcpy(prec->bptr, vals, n * sizeof(*vals));
+    prec->nord = n;
+    db_post_events(prec, &prec->val, DBE_VALUE);
+    dbScanUnlock((dbCommon*)prec);
+}
+
+static void testSnapshots(arrRecord *prec)
+{
+    static const epicsInt32 first[3] = {1, 2, 3};
+    static const epicsInt32 second[2] = {4, 5};
+    dbEventCtx ctx;
+    dbChannel *chans[3];
+    dbEventSubscription subs[3];
+    arrayMonitor mons[3];
+    size_t count = 0, bytes = 0;
+    unsigned i;
+
+    testDiag("Array snapshots shared between monitors");
+
+    memset(mons, 0, sizeof(mons));
+    mons[0].hold = 1;
+    dbEventArraySnapshots = 1;
+
+    ctx = db_init_events();
+    testOk1(ctx!=NULL);
+
+    for (i = 0; i < 3; i++) {
+        mons[i].done = epicsEventMustCreate(epicsEventEmpty);
+        chans[i] = dbChannelCreate("i32.VAL");
+        if (!chans[i] || dbChannelOpen(chans[i]))
+            testAbort("Failed to open channel i32.VAL");
+        subs[i] = db_add_event(ctx, chans[i], arrayUpdate, &mons[i],
+                               DBE_VALUE);
+        if (!subs[i])
+            testAbort("db_add_event(i32.VAL) fails");
+        db_event_enable(subs[i]);
+    }
+
+    /* queue both updates before the event task runs */
+    postArray(prec, first, 3);
+    postArray(prec, second, 2);
+
+    db_snapshot_usage(&count, &bytes);
+    testOk(count==2 && bytes==5*sizeof(epicsInt32),
+           "%u snapshots of %u bytes for 3 monitors",
+           (unsigned)count, (unsigned)bytes);
+
+    testOk1(db_start_events(ctx, "dbEventTest", NULL, NULL,
+                            epicsThreadPriorityLow)==DB_EVENT_OK);
+
+    for (i = 0; i < 3; i++) {
+        int ok;
+
+        while (epicsEventWaitWithTimeout(mons[i].done, 10.0)==epicsEventOK) {
+            epicsMutexMustLock(lock);
+            ok = mons[i].count >= 2;
+            epicsMutexUnlock(lock);
+            if (ok)
+                break;
+        }
+        epicsMutexMustLock(lock);
+        testOk(mons[i].count==2 && mons[i].shared &&
+               mons[i].nelem[0]==3 && mons[i].first[0]==1 &&
+               mons[i].nelem[1]==2 && mons[i].first[1]==4,
+               "monitor %u: %u updates, (%ld, %d) then (%ld, %d)", i,
+               mons[i].count, mons[i].nelem[0], (int)mons[i].first[0],
+               mons[i].nelem[1], (int)mons[i].first[1]);
+        epicsMutexUnlock(lock);
+    }
+
+    for (i = 0; i < 3; i++) {
+        db_cancel_event(subs[i]);
+        dbChannelDelete(chans[i]);
+    }
+    db_close_events(ctx);
+
+    db_snapshot_usage(&count, &bytes);
+    testOk(mons[0].held && count==1 && bytes==3*sizeof(epicsInt32),
+           "held snapshot outlives its field logs (%u, %u bytes)",
+           (unsigned)count, (unsigned)bytes);
+    db_snapshot_release(mons[0].held);
+
+    db_snapshot_usage(&count, &bytes);
+    testOk(count==0 && bytes==0, "snapshots released (%u, %u bytes)",
+           (unsigned)count, (unsigned)bytes);
+
+    dbEventArraySnapshots = 0;
+    for (i = 0; i < 3; i++)
+        epicsEventDestroy(mons[i].done);
+}
+
+MAIN(dbEventTest)
+{
+    xRecord *prec;
+
+    testPlan(67);
+
+    lock = epicsMutexMustCreate();
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("xRecord.db", NULL, NULL);
+    testdbReadDatabase("dbChArrTest.db", NULL, NULL);
+    testIocInitOk();
+
+    prec = (xRecord*)testdbRecordPtr("x");
+
+    testDepth(prec);
+    testHugeDepth(prec);
+    testChained(prec);
+    testNeverStarted();
+    testShards(prec);
+    testPostMany(prec);
+    testFieldIndex(prec);
+    testSnapshots((arrRecord*)testdbRecordPtr("i32"));
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    epicsMutexDestroy(lock);
+
+    return testDone();
+}
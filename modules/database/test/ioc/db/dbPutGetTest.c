@@ -315,6 +315,61 @@ void testPutArr(void)
     testdbGetArrFieldEqual("arr", DBR_LONG, 4, 3, buf);
 }
 
+static
+void testPreparedGet(void)
+{
+    dbChannel *chan = dbChannelCreate("arr");
+    dbChannelGetPrep prep;
+    struct {
+        DBRstatus
+        DBRtime
+        epicsFloat64 value[10];
+    } buf;
+    epicsInt32 lval[10];
+    long options, nReq;
+    long status;
+
+    testDiag("testPreparedGet()");
+
+    if (!chan || dbChannelOpen(chan))
+        testAbort("Can't open channel for 'arr'");
+
+    status = dbChannelGetPrepare(chan, DBR_STRING + 1000, 0, &prep);
+    testOk(status == S_db_badDbrtype, "Prepare bad type: %ld", status);
+
+    status = dbChannelGetPrepare(chan, DBR_DOUBLE, DBR_STATUS | DBR_TIME,
+        &prep);
+    testOk(status == 0, "Prepare DBR_DOUBLE: %ld", status);
+    testOk(dbChannelGetPrepSize(&prep) == sizeof(buf),
+        "Buffer size %ld == %u", dbChannelGetPrepSize(&prep),
+        (unsigned)sizeof(buf));
+
+    dbScanLock(dbChannelRecord(chan));
+    options = DBR_STATUS | DBR_TIME;
+    nReq = 10;
+    status = dbChannelGetPrepared(&prep, &buf, &options, &nReq, NULL);
+    testOk(status == 0 && nReq == 3, "Prepared get: %ld, nReq=%ld",
+        status, nReq);
+    testOk(buf.value[0] == 1.0 && buf.value[1] == 2.0 &&
+        buf.value[2] == 3.0, "Values %g %g %g",
+        buf.value[0], buf.value[1], buf.value[2]);
+
+    /* dbChannelGet() switches its cached type */
+    nReq = 10;
+    status = dbChannelGet(chan, DBR_LONG, lval, NULL, &nReq, NULL);
+    testOk(status == 0 && nReq == 3 && lval[2] == 3,
+        "Get DBR_LONG: %ld, nReq=%ld", status, nReq);
+    testOk1(chan->getPrep.dbrType == DBR_LONG);
+    nReq = 10;
+    status = dbChannelGet(chan, DBR_DOUBLE, buf.value, NULL, &nReq, NULL);
+    testOk(status == 0 && nReq == 3 && buf.value[1] == 2.0,
+        "Get DBR_DOUBLE: %ld, nReq=%ld", status, nReq);
+    testOk1(chan->getPrep.dbrType == DBR_DOUBLE);
+    dbScanUnlock(dbChannelRecord(chan));
+
+    dbChannelDelete(chan);
+}
+
 static
 void testPutSpecial(void)
 {
@@ -347,7 +402,7 @@ void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
 MAIN(dbPutGet)
 {
-    testPlan(124);
+    testPlan(133);
     testdbPrepare();
 
     testdbMetaDoubleSizes();
@@ -372,6 +427,7 @@ MAIN(dbPutGet)
     testLongField();
 
     testPutArr();
+    testPreparedGet();
 
     testPutSpecial();
 
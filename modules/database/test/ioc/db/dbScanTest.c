@@ -14,12 +14,17 @@
 
 #include "dbScan.h"
 #include "epicsEvent.h"
+#include "epicsMath.h"
+#include "epicsMutex.h"
+#include "epicsThread.h"
 
 #include "dbUnitTest.h"
 #include "testMain.h"
 
 #include "dbAccess.h"
+#include "dbLock.h"
 #include "errlog.h"
+#include "xRecord.h"
 
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
@@ -66,9 +71,245 @@ static void testOnce(void)
     epicsEventDestroy(waiter);
 }
 
+static const char * const parNames[] = {
+    "par1", "par2", "chain1", "chain2", "chain3"
+};
+#define NPAR NELEMENTS(parNames)
+
+static epicsMutexId parLock;
+static int parCount[NPAR];
+static int parBadOrder;
+
+static void parProcess(xRecord *prec)
+{
+    int i;
+
+    epicsMutexMustLock(parLock);
+    for (i = 0; i < NPAR; i++) {
+        if (strcmp(prec->name, parNames[i]) == 0)
+            break;
+    }
+    /* chain3 (PHAS 0) before chain2 (PHAS 1) before chain1 (PHAS 2) */
+    if (i == 2 && parCount[3] != parCount[2] + 1)
+        parBadOrder++;
+    if (i == 3 && parCount[4] != parCount[3] + 1)
+        parBadOrder++;
+    if (i < NPAR)
+        parCount[i]++;
+    epicsMutexUnlock(parLock);
+}
+
+static void testParallel(void)
+{
+    scanPeriodicStats stats;
+    int scan, i, wait;
+
+    testDiag("check parallel periodic scanning");
+    parLock = epicsMutexMustCreate();
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbScanTest.db", NULL, NULL);
+
+    testOk1(scanParallelThreads(3, ".1 second") == 0);
+    testOk1(scanParallelThreads(3, "7 fortnights") != 0);
+
+    for (i = 0; i < NPAR; i++) {
+        xRecord *prec = (xRecord *) testdbRecordPtr(parNames[i]);
+
+        prec->clbk = parProcess;
+    }
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    scan = testdbRecordPtr("par1")->scan;
+    testOk(dbLockGetLockId(testdbRecordPtr("chain1")) ==
+        dbLockGetLockId(testdbRecordPtr("chain3")),
+        "chain records share a lock set");
+    testOk1(scanParallelThreads(1, NULL) != 0);
+
+    for (wait = 0; wait < 100; wait++) {
+        if (scanPeriodicStatus(scan, 0, &stats) == 0 && stats.passes >= 3)
+            break;
+        epicsThreadSleep(0.1);
+    }
+    testOk(stats.passes >= 3, "%lu passes", stats.passes);
+    testOk(stats.nThreads == 3, "%d threads", stats.nThreads);
+    testOk(stats.nLockSets == 3, "%d lock sets", stats.nLockSets);
+    testOk(stats.nRecords == NPAR, "%d records per pass", stats.nRecords);
+    testOk(stats.timeMin <= stats.timeMean && stats.timeMean <= stats.timeMax,
+        "times %g <= %g <= %g", stats.timeMin, stats.timeMean, stats.timeMax);
+
+    testIocShutdownOk();
+
+    epicsMutexMustLock(parLock);
+    for (i = 0; i < NPAR; i++)
+        testOk(parCount[i] >= 3, "%s processed %d times",
+            parNames[i], parCount[i]);
+    testOk(!parBadOrder, "PHAS order kept within the lock set (%d errors)",
+        parBadOrder);
+    epicsMutexUnlock(parLock);
+
+    testdbCleanup();
+    testOk1(scanParallelThreads(1, NULL) == 0);
+    epicsMutexDestroy(parLock);
+}
+
+/* Records processed, as indices into parNames */
+#define NLOG 256
+static int procLog[NLOG];
+static int nLog;
+
+static void logProcess(xRecord *prec)
+{
+    int i;
+
+    for (i = 0; i < NPAR; i++) {
+        if (strcmp(prec->name, parNames[i]) == 0)
+            break;
+    }
+    epicsMutexMustLock(parLock);
+    if (nLog < NLOG)
+        procLog[nLog++] = i;
+    epicsMutexUnlock(parLock);
+}
+
+/* Log some passes, and check they all processed the records in order */
+static void checkPasses(int scan, const int *order, int n)
+{
+    scanPeriodicStats stats;
+    int i, first, bad = 0, wait;
+
+    epicsMutexMustLock(parLock);
+    nLog = 0;
+    epicsMutexUnlock(parLock);
+    scanPeriodicStatus(scan, 1, NULL);
+    for (wait = 0; wait < 100; wait++) {
+        if (scanPeriodicStatus(scan, 0, &stats) == 0 && stats.passes >= 3)
+            break;
+        epicsThreadSleep(0.1);
+    }
+
+    epicsMutexMustLock(parLock);
+    /* The log may start part way through a pass */
+    for (first = 0; first < nLog && procLog[first] != order[0]; first++)
+        ;
+    for (i = first; i < nLog; i++) {
+        if (procLog[i] != order[(i - first) % n])
+            bad++;
+    }
+    testOk(nLog - first >= 2 * n && !bad,
+        "%d records processed in order, %d out of order", nLog - first, bad);
+    epicsMutexUnlock(parLock);
+    testOk(stats.nRecords == n, "%d records per pass", stats.nRecords);
+}
+
+static void testListChanges(void)
+{
+    static const int before[] = {0, 1, 4, 3, 2};
+    static const int moved[] = {0, 3, 2, 4};
+    static const int added[] = {0, 1, 3, 2, 4};
+    int scan, i;
+
+    testDiag("check scan list changes while scanning");
+    parLock = epicsMutexMustCreate();
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbScanTest.db", NULL, NULL);
+
+    for (i = 0; i < NPAR; i++) {
+        xRecord *prec = (xRecord *) testdbRecordPtr(parNames[i]);
+
+        prec->clbk = logProcess;
+    }
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+    scan = testdbRecordPtr("par1")->scan;
+
+    testDiag("PHAS order, then database order");
+    checkPasses(scan, before, NELEMENTS(before));
+
+    testdbPutFieldOk("par2.SCAN", DBF_STRING, "Passive");
+    testdbPutFieldOk("chain3.PHAS", DBF_LONG, 3);
+    checkPasses(scan, moved, NELEMENTS(moved));
+
+    testdbPutFieldOk("par2.SCAN", DBF_STRING, ".1 second");
+    checkPasses(scan, added, NELEMENTS(added));
+
+    testIocShutdownOk();
+    testdbCleanup();
+    epicsMutexDestroy(parLock);
+}
+
+static void testSpread(void)
+{
+    static const int order[] = {0, 1, 4, 3, 2};
+    scanPeriodicStats stats;
+    scanPeriodicHist hist;
+    unsigned long starts = 0, passes = 0;
+    int scan, i;
+
+    testDiag("check passes spread over the period");
+    parLock = epicsMutexMustCreate();
+
+    testdbPrepare();
+
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("dbScanTest.db", NULL, NULL);
+
+    testOk1(scanSpreadSlices(4, ".1 second") == 0);
+
+    for (i = 0; i < NPAR; i++) {
+        xRecord *prec = (xRecord *) testdbRecordPtr(parNames[i]);
+
+        prec->clbk = logProcess;
+    }
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+    scan = testdbRecordPtr("par1")->scan;
+    testOk1(scanSpreadSlices(1, NULL) != 0);
+
+    checkPasses(scan, order, NELEMENTS(order));
+
+    scanPeriodicStatus(scan, 0, &stats);
+    testOk(stats.nSlices > 1, "%d slices", stats.nSlices);
+    testOk(stats.jitterMean <= stats.jitterMax,
+        "jitter mean %g <= max %g", stats.jitterMean, stats.jitterMax);
+
+    testOk1(scanPeriodicHistogram(scan, &hist) == 0);
+    for (i = 0; i < SCAN_HIST_BINS; i++) {
+        starts += hist.jitter[i];
+        passes += hist.time[i];
+    }
+    testOk(starts > passes && passes > 0,
+        "%lu slices started in %lu passes", starts, passes);
+    testOk(hist.upper[SCAN_HIST_BINS - 2] == 1.0 &&
+        isinf(hist.upper[SCAN_HIST_BINS - 1]), "histogram bin limits");
+
+    testIocShutdownOk();
+    testdbCleanup();
+    testOk1(scanSpreadSlices(1, NULL) == 0);
+    epicsMutexDestroy(parLock);
+}
+
 MAIN(dbScanTest)
 {
-    testPlan(3);
+    testPlan(38);
     testOnce();
+    testParallel();
+    testListChanges();
+    testSpread();
     return testDone();
 }
@@ -4,11 +4,13 @@
 * in file LICENSE that is included with this distribution.
  \*************************************************************************/
 
+#include <stdio.h>
 #include <string.h>
 
 #include <errlog.h>
 #include <osiFileName.h>
 #include <dbAccess.h>
+#include <dbChannel.h>
 #include <dbStaticLib.h>
 #include <dbStaticPvt.h>
 #include <dbUnitTest.h>
@@ -303,6 +305,93 @@ static void testWrongAliasRecord(const char *filename)
            "Wrong alias record in %s is expected to fail", filename);
 }
 
+/* Enough records to grow the process variable directory several times */
+static void testPvdGrow(void)
+{
+    const unsigned nrec = 3000;
+    unsigned i, nfound = 0, nmissing = 0;
+    DBENTRY entry;
+    char name[32];
+
+    testDiag("testPvdGrow() with %u records", nrec);
+
+    dbInitEntry(pdbbase, &entry);
+    for (i = 0; i < nrec; i++) {
+        sprintf(name, "pvd%u", i);
+        if (dbFindRecordType(&entry, "x") || dbCreateRecord(&entry, name))
+            break;
+    }
+    testOk(i == nrec, "Created %u records", i);
+
+    for (i = 0; i < nrec; i++) {
+        sprintf(name, "pvd%u", i);
+        if (dbFindRecord(&entry, name) == 0 &&
+            strcmp(entry.precnode->recordname, name) == 0)
+            nfound++;
+    }
+    testOk(nfound == nrec, "Found %u of %u records", nfound, nrec);
+
+    nfound = nmissing = 0;
+    for (i = 0; i < nrec; i++) {
+        sprintf(name, "pvd%u.VAL", i);
+        if (dbChannelMayExist(name))
+            nfound++;
+        sprintf(name, "nopvd%u", i);
+        if (dbChannelMayExist(name))
+            nmissing++;
+    }
+    testOk(nfound == nrec, "Name filter passes %u of %u records",
+        nfound, nrec);
+    testOk(nmissing < nrec / 20, "Name filter passes %u of %u missing names",
+        nmissing, nrec);
+    nmissing = 0;
+
+    for (i = 0; i < nrec; i += 2) {
+        sprintf(name, "pvd%u", i);
+        if (dbFindRecord(&entry, name) == 0)
+            dbDeleteRecord(&entry);
+    }
+    nfound = 0;
+    for (i = 0; i < nrec; i++) {
+        sprintf(name, "pvd%u", i);
+        if (dbFindRecord(&entry, name) != 0)
+            nmissing++;
+        else if (i & 1)
+            nfound++;
+    }
+    testOk(nfound == nrec / 2 && nmissing == nrec / 2,
+        "Found %u remaining records, %u deleted records missing",
+        nfound, nmissing);
+
+    /* reuse the deleted slots */
+    for (i = 0; i < nrec; i += 2) {
+        sprintf(name, "pvd%u", i);
+        if (dbFindRecordType(&entry, "x") || dbCreateRecord(&entry, name))
+            break;
+    }
+    nfound = 0;
+    for (i = 0; i < nrec; i++) {
+        sprintf(name, "pvd%u", i);
+        if (dbFindRecord(&entry, name) == 0 &&
+            strcmp(entry.precnode->recordname, name) == 0)
+            nfound++;
+    }
+    testOk(nfound == nrec, "Found %u of %u records after adding again",
+        nfound, nrec);
+    testOk1(dbFindRecordType(&entry, "x") == 0 &&
+        dbCreateRecord(&entry, "pvd1") == S_dbLib_recExists);
+
+    for (i = 0; i < nrec; i++) {
+        sprintf(name, "pvd%u", i);
+        if (dbFindRecord(&entry, name) == 0)
+            dbDeleteRecord(&entry);
+    }
+    testOk1(dbFindRecord(&entry, "pvd1") != 0);
+    testOk1(dbFindRecord(&entry, "testrec") == 0);
+
+    dbFinishEntry(&entry);
+}
+
 void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
 
 MAIN(dbStaticTest)
@@ -310,7 +399,7 @@ MAIN(dbStaticTest)
     const char *ldir;
     FILE *fp = NULL;
 
-    testPlan(312);
+    testPlan(321);
     testdbPrepare();
 
     testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
@@ -328,6 +417,8 @@ MAIN(dbStaticTest)
     testWrongAliasRecord("dbStaticTestAlias1.db");
     testWrongAliasRecord("dbStaticTestAlias2.db");
 
+    testPvdGrow();
+
     testEntry("testrec.VAL");
     testEntry("testalias.VAL");
     testEntry("testalias2.VAL");
@@ -31,6 +31,7 @@ int dbPutLinkTest(void);
 int dbStaticTest(void);
 int dbCaLinkTest(void);
 int dbDbLinkTest(void);
+int dbEventTest(void);
 int testDbChannel(void);
 int chfPluginTest(void);
 int arrShorthandTest(void);
@@ -54,6 +55,7 @@ void epicsRunDbTests(void)
     runTest(dbStaticTest);
     runTest(dbCaLinkTest);
     runTest(dbDbLinkTest);
+    runTest(dbEventTest);
     runTest(testDbChannel);
     runTest(arrShorthandTest);
     runTest(recGblCheckDeadbandTest);
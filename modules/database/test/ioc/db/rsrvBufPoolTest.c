@@ -0,0 +1,325 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/* Check that RSRV keeps large message buffers while large transfers
+ * continue and returns them after, using raw socket CA clients.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "dbUnitTest.h"
+#include "envDefs.h"
+#include "iocInit.h"
+#include "epicsEndian.h"
+#include "epicsThread.h"
+#include "epicsTime.h"
+#include "osiSock.h"
+#include "caProto.h"
+#include "caerr.h"
+#include "db_access.h"
+#include "db_access_routines.h"
+#include "rsrv.h"
+
+#include "epicsUnitTest.h"
+#include "testMain.h"
+
+void dbTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+#define MINOR_VERSION 13u
+#define BIG_NELM 262144u
+/* CAS_SHRINK_DELAY in the RSRV server.h */
+#define SHRINK_DELAY 5.0
+
+static osiSockAddr serverAddr;
+
+static int sendAll(SOCKET sock, const char *buf, size_t len)
+{
+    while (len) {
+        int n = send(sock, buf, (int) len, 0);
+        if (n <= 0)
+            return -1;
+        buf += n;
+        len -= (size_t) n;
+    }
+    return 0;
+}
+
+static int recvAll(SOCKET sock, char *buf, size_t len)
+{
+    while (len) {
+        int n = recv(sock, buf, (int) len, 0);
+        if (n <= 0)
+            return -1;
+        buf += n;
+        len -= (size_t) n;
+    }
+    return 0;
+}
+
+/* Send a message, with the extended header if needed */
+static int sendMsg(SOCKET sock, ca_uint16_t cmmd, ca_uint16_t type,
+                   ca_uint32_t count, ca_uint32_t cid, ca_uint32_t avail,
+                   const void *payload, ca_uint32_t size)
+{
+    ca_uint32_t aligned = CA_MESSAGE_ALIGN(size);
+    size_t hdrSize = sizeof(caHdr);
+    char *buf;
+    caHdr *hdr;
+    int status;
+
+    if (aligned >= 0xffff || count >= 0xffff)
+        hdrSize += 2 * sizeof(ca_uint32_t);
+    buf = calloc(1, hdrSize + aligned);
+    if (!buf)
+        return -1;
+    hdr = (caHdr *) buf;
+    hdr->m_cmmd = htons(cmmd);
+    hdr->m_dataType = htons(type);
+    hdr->m_cid = htonl(cid);
+    hdr->m_available = htonl(avail);
+    if (hdrSize > sizeof(caHdr)) {
+        ca_uint32_t *pW32 = (ca_uint32_t *) (hdr + 1);
+        hdr->m_postsize = htons(0xffff);
+        pW32[0] = htonl(aligned);
+        pW32[1] = htonl(count);
+    }
+    else {
+        hdr->m_postsize = htons((ca_uint16_t) aligned);
+        hdr->m_count = htons((ca_uint16_t) count);
+    }
+    if (size)
+        memcpy(buf + hdrSize, payload, size);
+
+    status = sendAll(sock, buf, hdrSize + aligned);
+    free(buf);
+    return status;
+}
+
+/* Skip messages until one with the given command.  Its payload, if any,
+ * is returned in *ppPayload and must be freed. */
+static int recvMsg(SOCKET sock, ca_uint16_t cmmd, caHdr *hdr,
+                   ca_uint32_t *pCount, char **ppPayload)
+{
+    while (1) {
+        ca_uint32_t size, count;
+        char *payload;
+
+        if (recvAll(sock, (char *) hdr, sizeof(*hdr)))
+            return -1;
+        size = ntohs(hdr->m_postsize);
+        count = ntohs(hdr->m_count);
+        if (size == 0xffff) {
+            ca_uint32_t ext[2];
+            if (recvAll(sock, (char *) ext, sizeof(ext)))
+                return -1;
+            size = ntohl(ext[0]);
+            count = ntohl(ext[1]);
+        }
+        payload = malloc(size ? size : 1u);
+        if (!payload || recvAll(sock, payload, size)) {
+            free(payload);
+            return -1;
+        }
+        if (ntohs(hdr->m_cmmd) == cmmd) {
+            if (pCount)
+                *pCount = count;
+            if (ppPayload)
+                *ppPayload = payload;
+            else
+                free(payload);
+            return 0;
+        }
+        free(payload);
+    }
+}
+
+static SOCKET clientConnect(ca_uint32_t *pSid)
+{
+    int yes = 1;
+    caHdr hdr;
+    SOCKET sock = epicsSocketCreate(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+    if (sock == INVALID_SOCKET)
+        return sock;
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (char *) &yes, sizeof(yes));
+    if (connect(sock, &serverAddr.sa, sizeof(serverAddr.ia)) ||
+            sendMsg(sock, CA_PROTO_VERSION, 0, MINOR_VERSION, 0, 0, NULL, 0) ||
+            sendMsg(sock, CA_PROTO_CLIENT_NAME, 0, 0, 0, 0, "test", 5) ||
+            sendMsg(sock, CA_PROTO_HOST_NAME, 0, 0, 0, 0, "localhost", 10) ||
+            sendMsg(sock, CA_PROTO_CREATE_CHAN, 0, 0, 1, MINOR_VERSION,
+                    "big", 4) ||
+            recvMsg(sock, CA_PROTO_CREATE_CHAN, &hdr, NULL, NULL)) {
+        epicsSocketDestroy(sock);
+        return INVALID_SOCKET;
+    }
+    *pSid = ntohl(hdr.m_available);
+    return sock;
+}
+
+/* doubles in network byte order */
+static char * makeArray(ca_uint32_t nelm)
+{
+    char *buf = malloc(nelm * sizeof(epicsFloat64));
+    ca_uint32_t i;
+
+    if (!buf)
+        testAbort("Out of memory");
+    for (i = 0; i < nelm; i++) {
+        epicsFloat64 val = i;
+        epicsUInt8 bytes[8];
+        unsigned j;
+
+        memcpy(bytes, &val, sizeof(val));
+        for (j = 0; j < 8u; j++) {
+#if EPICS_FLOAT_WORD_ORDER == EPICS_ENDIAN_BIG
+            buf[i * 8u + j] = bytes[j];
+#else
+            buf[i * 8u + j] = bytes[7u - j];
+#endif
+        }
+    }
+    return buf;
+}
+
+static int putArray(SOCKET sock, ca_uint32_t sid, ca_uint32_t nelm,
+                    ca_uint32_t ioid)
+{
+    char *buf = makeArray(nelm);
+    int status = sendMsg(sock, CA_PROTO_WRITE_NOTIFY, DBR_DOUBLE, nelm,
+                         sid, ioid, buf, nelm * sizeof(epicsFloat64));
+
+    free(buf);
+    return status;
+}
+
+static int putReply(SOCKET sock)
+{
+    caHdr hdr;
+
+    if (recvMsg(sock, CA_PROTO_WRITE_NOTIFY, &hdr, NULL, NULL))
+        return ECA_DISCONN;
+    return (int) ntohl(hdr.m_cid);
+}
+
+/* wait for the server to return its buffers */
+static size_t inUseAfter(size_t expect, size_t *pIdle)
+{
+    size_t inUse = 0;
+    unsigned i;
+
+    for (i = 0; i < 100; i++) {
+        casBufStatsFetch(&inUse, pIdle);
+        if (inUse == expect)
+            break;
+        epicsThreadSleep(0.05);
+    }
+    return inUse;
+}
+
+MAIN(rsrvBufPoolTest)
+{
+    const char *port;
+    SOCKET sock[2];
+    ca_uint32_t sid[2];
+    size_t baseline, idle, inUse, used;
+    ca_uint32_t count = 0;
+    char *payload = NULL;
+    char *expect;
+    caHdr hdr;
+
+    testPlan(13);
+
+    epicsEnvSet("EPICS_CAS_INTF_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_BEACON_ADDR_LIST", "127.0.0.1");
+    epicsEnvSet("EPICS_CAS_AUTO_BEACON_ADDR_LIST", "NO");
+    epicsEnvSet("EPICS_CA_AUTO_ARRAY_BYTES", "YES");
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+    testdbReadDatabase("rsrvBufPoolTest.db", NULL, NULL);
+    rsrv_register_server();
+    /* not isolated, so that RSRV starts */
+    if (iocInit())
+        testAbort("Failed to start up test database");
+
+    port = getenv("RSRV_SERVER_PORT");
+    if (!port)
+        testAbort("RSRV not running");
+    memset(&serverAddr, 0, sizeof(serverAddr));
+    serverAddr.ia.sin_family = AF_INET;
+    serverAddr.ia.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    serverAddr.ia.sin_port = htons((unsigned short) atoi(port));
+
+    sock[0] = clientConnect(&sid[0]);
+    sock[1] = clientConnect(&sid[1]);
+    if (sock[0] == INVALID_SOCKET || sock[1] == INVALID_SOCKET)
+        testAbort("Failed to connect to RSRV");
+
+    casBufStatsFetch(&baseline, &idle);
+    testOk(baseline == 0, "No large buffers in use at first (%lu bytes)",
+           (unsigned long) baseline);
+
+    testDiag("Put of %u elements", BIG_NELM);
+    testOk1(putArray(sock[0], sid[0], BIG_NELM, 1) == 0 &&
+            putReply(sock[0]) == ECA_NORMAL);
+    casBufStatsFetch(&inUse, &idle);
+    testOk(inUse > baseline, "Receive buffer kept for more large puts "
+           "(%lu bytes in use)", (unsigned long) inUse);
+
+    testDiag("Put of 8192 elements");
+    testOk1(putArray(sock[0], sid[0], 8192, 2) == 0 &&
+            putReply(sock[0]) == ECA_NORMAL);
+    casBufStatsFetch(&used, &idle);
+    testOk(used == inUse, "Same receive buffer used (%lu bytes in use)",
+           (unsigned long) used);
+
+    testDiag("Autosized read");
+    expect = makeArray(8192);
+    if (sendMsg(sock[1], CA_PROTO_READ_NOTIFY, DBR_DOUBLE, 0, sid[1], 3,
+                NULL, 0) ||
+            recvMsg(sock[1], CA_PROTO_READ_NOTIFY, &hdr, &count, &payload))
+        testAbort("Read failed");
+    testOk(ntohl(hdr.m_cid) == ECA_NORMAL && count == 8192 &&
+           memcmp(payload, expect, 8192 * sizeof(epicsFloat64)) == 0,
+           "Read back %u elements", (unsigned) count);
+    free(payload);
+    free(expect);
+    casBufStatsFetch(&used, &idle);
+    testOk(used == inUse, "Reply sent without a large send buffer "
+           "(%lu bytes in use)", (unsigned long) used);
+
+    testDiag("Two clients put %u elements together", BIG_NELM);
+    testOk1(putArray(sock[0], sid[0], BIG_NELM, 4) == 0 &&
+            putArray(sock[1], sid[1], BIG_NELM, 5) == 0);
+    testOk1(putReply(sock[0]) == ECA_NORMAL &&
+            putReply(sock[1]) == ECA_NORMAL);
+
+    testDiag("Small puts after %g seconds without large messages",
+             SHRINK_DELAY);
+    epicsThreadSleep(SHRINK_DELAY + 0.5);
+    testOk1(putArray(sock[0], sid[0], 1, 6) == 0 &&
+            putArray(sock[1], sid[1], 1, 7) == 0);
+    testOk1(putReply(sock[0]) == ECA_NORMAL &&
+            putReply(sock[1]) == ECA_NORMAL);
+    inUse = inUseAfter(baseline, &idle);
+    testOk(inUse == baseline, "Buffers returned (%lu bytes in use)",
+           (unsigned long) inUse);
+    testOk(idle >= 4 * 1024 * 1024,
+           "One buffer of the largest class kept idle (%lu bytes idle)",
+           (unsigned long) idle);
+
+    casr(2);
+
+    epicsSocketDestroy(sock[0]);
+    epicsSocketDestroy(sock[1]);
+
+    /* RSRV can't be stopped, so no cleanup */
+    iocShutdown();
+
+    return testDone();
+}
@@ -16,10 +16,12 @@
 #include <stdio.h>
 #include <string.h>
 
+#include "epicsAtomic.h"
 #include "epicsEvent.h"
 #include "epicsMessageQueue.h"
 #include "epicsPrint.h"
 #include "epicsMath.h"
+#include "epicsThread.h"
 #include "alarm.h"
 #include "menuPriority.h"
 #include "dbChannel.h"
@@ -296,14 +298,122 @@ static void testMultiThreading(void)
     }
 }
 
+typedef struct {
+    int processed; /* use atomic */
+    int passes; /* use atomic */
+    epicsEventId started;
+    epicsEventId release;
+    epicsEventId done;
+} testcoalesce;
+
+static void testcbcoalesce(xpriv *priv, void *raw)
+{
+    testcoalesce *td = raw;
+
+    if (epicsAtomicIncrIntT(&td->processed) == 1 && td->release) {
+        epicsEventMustTrigger(td->started);
+        epicsEventMustWait(td->release);
+    }
+}
+
+static void testcompcoalesce(void *raw, IOSCANPVT scan, int prio)
+{
+    testcoalesce *td = raw;
+
+    epicsAtomicIncrIntT(&td->passes);
+    epicsEventMustTrigger(td->done);
+}
+
+static void testCoalesce(int batch)
+{
+    testcoalesce data;
+    scanIoStats stats;
+    xdrv *drv;
+    int i;
+
+    memset(&data, 0, sizeof(data));
+    data.started = epicsEventMustCreate(epicsEventEmpty);
+    data.done = epicsEventMustCreate(epicsEventEmpty);
+    if (!batch)
+        data.release = epicsEventMustCreate(epicsEventEmpty);
+
+    testDiag("Test %s of I/O Intr scan requests",
+        batch ? "batching" : "coalescing");
+
+    testdbPrepare();
+    testdbReadDatabase("dbTestIoc.dbd", NULL, NULL);
+    dbTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    loadRecord(0, 0, "LOW");
+
+    drv = xdrv_add(0, &testcbcoalesce, &data);
+    scanIoSetComplete(drv->scan, &testcompcoalesce, &data);
+    if (batch)
+        scanIoSetBatch(drv->scan, 0.5);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    testOk1(scanIoRequest(drv->scan)==0x1);
+
+    if (!batch) {
+        testDiag("Request while the first pass is processing");
+        epicsEventMustWait(data.started);
+        for (i = 0; i < 3; i++)
+            testOk1(scanIoRequest(drv->scan)==0x1);
+        epicsEventMustTrigger(data.release);
+    }
+    else {
+        epicsEventMustWait(data.done);
+        testDiag("Request again soon after the first pass");
+        for (i = 0; i < 3; i++)
+            testOk1(scanIoRequest(drv->scan)==0x1);
+        epicsThreadSleep(0.1);
+        testOk(epicsAtomicGetIntT(&data.processed)==1,
+            "Held for the batch delay, processed %d",
+            epicsAtomicGetIntT(&data.processed));
+    }
+
+    while (epicsAtomicGetIntT(&data.passes) < 2)
+        epicsEventMustWait(data.done);
+    epicsThreadSleep(0.1);
+
+    testOk(epicsAtomicGetIntT(&data.processed)==2, "processed %d",
+        epicsAtomicGetIntT(&data.processed));
+    testOk(epicsAtomicGetIntT(&data.passes)==2, "%d passes",
+        epicsAtomicGetIntT(&data.passes));
+
+    testOk1(scanIoStatus(drv->scan, 0, 1, &stats)==0);
+    testOk(stats.requested==4, "requested %lu", stats.requested);
+    testOk(stats.coalesced==2, "coalesced %lu", stats.coalesced);
+    testOk(stats.passes==2, "passes %lu", stats.passes);
+    testOk(stats.deferred==(batch ? 1 : 0), "deferred %lu", stats.deferred);
+    testOk(stats.overflows==0, "overflows %lu", stats.overflows);
+    testOk(stats.nRecords==1, "%d records", stats.nRecords);
+    scanIoStatus(drv->scan, 0, 0, &stats);
+    testOk(stats.requested==0 && stats.passes==0, "reset");
+
+    testIocShutdownOk();
+    testdbCleanup();
+    xdrv_reset();
+
+    epicsEventDestroy(data.started);
+    epicsEventDestroy(data.done);
+    if (data.release)
+        epicsEventDestroy(data.release);
+}
+
 MAIN(scanIoTest)
 {
-    testPlan(152);
+    testPlan(152+14+15);
     testSingleThreading();
     testDiag("run a second time to verify shutdown and restart works");
     testSingleThreading();
     testMultiThreading();
     testDiag("run a second time to verify shutdown and restart works");
     testMultiThreading();
+    testCoalesce(0);
+    testCoalesce(1);
     return testDone();
 }
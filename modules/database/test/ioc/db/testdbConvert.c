@@ -146,12 +146,23 @@ static void testBasicPut(void)
         memset(scratch, 0x42, sizeof(s_input));
     }
 
+    {
+        testDiag("Copy in w/ offset and wrap");
+
+        putter(&addr, s_input, s_input_len, s_input_len, 5);
+
+        testOk1(memcmp(scratch+5, s_input, sizeof(short)*(s_input_len-5))==0 &&
+                memcmp(scratch, s_input+s_input_len-5, sizeof(short)*5)==0);
+
+        memset(scratch, 0x42, sizeof(s_input));
+    }
+
     free(scratch);
 }
 
 MAIN(testdbConvert)
 {
-    testPlan(15);
+    testPlan(16);
     testBasicGet();
     testBasicPut();
     return testDone();
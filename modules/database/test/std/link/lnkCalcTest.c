@@ -13,6 +13,7 @@
 #include "errlog.h"
 #include "epicsThread.h"
 #include "dbLink.h"
+#include "dbJLink.h"
 #include "dbState.h"
 #include "recGbl.h"
 #include "testMain.h"
@@ -154,12 +155,155 @@ static void testCalc()
     testdbCleanup();
 }
 
+static void testArrayValue(DBLINK *plink, const char *name, short dbrType,
+    long nReq, long nExpected, const double *pexpected, long nElements)
+{
+    epicsFloat64 f64[32];
+    epicsInt32 i32[32];
+    long status, nelm = 0;
+    int i, ok = 1;
+
+    status = dbGetLink(plink, dbrType,
+        dbrType == DBR_LONG ? (void *) i32 : (void *) f64, NULL, &nReq);
+    testOk(!status && nReq == nExpected,
+        "%s: dbGetLink status = %ld, %ld elements", name, status, nReq);
+    for (i = 0; i < nReq && i < nExpected; i++) {
+        double val = dbrType == DBR_LONG ? i32[i] : f64[i];
+
+        if (val != pexpected[i]) {
+            testDiag("Element %d is %g, expected %g", i, val, pexpected[i]);
+            ok = 0;
+        }
+    }
+    testOk(ok, "%s: element values", name);
+
+    status = dbGetNelements(plink, &nelm);
+    testOk(!status && nelm == nElements,
+        "%s: dbGetNelements = %ld", name, nelm);
+}
+
+static void testParseFail(const char *json, short dbfType)
+{
+    jlink *pjlink = NULL;
+    long status;
+
+    eltc(0);
+    status = dbJLinkParse(json, strlen(json), dbfType, &pjlink);
+    eltc(1);
+    testOk(status, "Rejected %s", json);
+    if (!status)
+        dbJLinkFree(pjlink);
+}
+
+static void testArrayCalc()
+{
+    ioRecord *pio;
+    DBLINK *pinp;
+
+    startTestIoc("ioRecord.db");
+
+    pio = (ioRecord *) testdbRecordPtr("io");
+    pinp = &pio->input;
+
+    testDiag("testing lnkACalc");
+
+    {
+        static const double expect[] = {3, 5, 7};
+
+        testPutLongStr("io.INPUT", "{acalc:{"
+            "expr:'A*2+B',"
+            "args:[{const:[1,2,3]},1]"
+            "}}");
+        testArrayValue(pinp, "Scalar argument", DBR_DOUBLE, 10, 3, expect, 3);
+        testArrayValue(pinp, "Truncated", DBR_DOUBLE, 2, 2, expect, 3);
+        testArrayValue(pinp, "Converted", DBR_LONG, 10, 3, expect, 3);
+    }
+
+    {
+        static const double expect[] = {11, 22};
+
+        testPutLongStr("io.INPUT", "{acalc:{"
+            "expr:'A+B',"
+            "args:[{const:[1,2,3,4]},{const:[10,20]}]"
+            "}}");
+        testArrayValue(pinp, "Shortest input", DBR_DOUBLE, 10, 2, expect, 2);
+    }
+
+    {
+        static const double expect[] = {0, 3, 8, 15, 24};
+
+        testPutLongStr("io.INPUT", "{acalc:{"
+            "expr:'A-1',"
+            "args:[{acalc:{expr:'A*A',args:[{const:[1,2,3,4,5]}]}}]"
+            "}}");
+        testArrayValue(pinp, "Nested link", DBR_DOUBLE, 10, 5, expect, 5);
+    }
+
+    {
+        static const double expect[] = {-1, -2, 3, 4};
+
+        testPutLongStr("io.INPUT", "{acalc:{"
+            "expr:'A>2?A:-A',"
+            "args:[{const:[1,2,3,4]}]"
+            "}}");
+        testArrayValue(pinp, "Conditional", DBR_DOUBLE, 10, 4, expect, 4);
+    }
+
+    {
+        static const double expect[] = {3};
+
+        testPutLongStr("io.INPUT", "{acalc:{"
+            "expr:'A*B+C',"
+            "args:[1,2,{calc:{expr:'1'}}]"
+            "}}");
+        testArrayValue(pinp, "All scalars", DBR_DOUBLE, 10, 1, expect, 1);
+    }
+
+    {
+        static const double sum[] = {14};
+        static const double mean[] = {10.5};
+        static const double max[] = {20};
+
+        testPutLongStr("io.INPUT", "{acalc:{"
+            "expr:'A*A',"
+            "args:[{const:[1,2,3]}],"
+            "reduce:'sum'"
+            "}}");
+        testArrayValue(pinp, "Sum", DBR_DOUBLE, 10, 1, sum, 1);
+
+        testPutLongStr("io.INPUT", "{acalc:{"
+            "expr:'A',"
+            "args:[{const:[1,2,3,4,5,6,7,8,9,10,"
+            "11,12,13,14,15,16,17,18,19,20]}],"
+            "reduce:'mean'"
+            "}}");
+        testArrayValue(pinp, "Mean", DBR_DOUBLE, 1, 1, mean, 1);
+
+        testPutLongStr("io.INPUT", "{acalc:{"
+            "expr:'A',"
+            "args:[{const:[1,2,3,4,5,6,7,8,9,10,"
+            "11,12,13,14,15,16,17,18,19,20]}],"
+            "reduce:'max'"
+            "}}");
+        testArrayValue(pinp, "Max", DBR_LONG, 1, 1, max, 1);
+    }
+
+    testParseFail("{acalc:{expr:'A',major:'A'}}", DBF_INLINK);
+    testParseFail("{acalc:{expr:'A',reduce:'median'}}", DBF_INLINK);
+    testParseFail("{acalc:{expr:'A'}}", DBF_OUTLINK);
+
+    testIocShutdownOk();
+
+    testdbCleanup();
+}
+
 
 MAIN(lnkCalcTest)
 {
-    testPlan(30);
+    testPlan(71);
 
     testCalc();
+    testArrayCalc();
 
     return testDone();
 }
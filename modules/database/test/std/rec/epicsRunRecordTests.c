@@ -28,6 +28,7 @@ int boTest(void);
 int biTest(void);
 int printfTest(void);
 int aiTest(void);
+int scanStatsTest(void);
 
 void epicsRunRecordTests(void)
 {
@@ -63,5 +64,7 @@ void epicsRunRecordTests(void)
 
     runTest(aiTest);
 
+    runTest(scanStatsTest);
+
     epicsExit(0);   /* Trigger test harness */
 }
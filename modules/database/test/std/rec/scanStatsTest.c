@@ -0,0 +1,95 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/*
+ *  Tests for the "Scan Stats" device support
+ */
+
+#include "dbUnitTest.h"
+#include "testMain.h"
+#include "errlog.h"
+#include "dbAccess.h"
+#include "dbScan.h"
+#include "epicsThread.h"
+
+void recTestIoc_registerRecordDeviceDriver(struct dbBase *);
+
+static void test_init(void)
+{
+    testDiag("bad INP strings and FTVL leave the record disabled");
+    testdbGetFieldEqual("badItem.PACT", DBF_UCHAR, 1);
+    testdbGetFieldEqual("badRate.PACT", DBF_UCHAR, 1);
+    testdbGetFieldEqual("badFtvl.PACT", DBF_UCHAR, 1);
+    testdbGetFieldEqual("records.PACT", DBF_UCHAR, 0);
+}
+
+static void test_ai(void)
+{
+    epicsFloat64 passes;
+    DBADDR addr;
+
+    testDiag("ai items follow scanPeriodicStatus()");
+    epicsThreadSleep(0.35);
+
+    testdbPutFieldOk("records.PROC", DBF_UCHAR, 1);
+    testdbGetFieldEqual("records.VAL", DBF_DOUBLE, 1.0);
+    testdbGetFieldEqual("records.UDF", DBF_UCHAR, 0);
+
+    testdbPutFieldOk("passes.PROC", DBF_UCHAR, 1);
+    if (dbNameToAddr("passes.VAL", &addr) ||
+        dbGetField(&addr, DBR_DOUBLE, &passes, NULL, NULL, NULL))
+        passes = 0;
+    testOk(passes >= 2, "%g passes", passes);
+
+    testdbPutFieldOk("jitterMax.PROC", DBF_UCHAR, 1);
+    testdbGetFieldEqual("jitterMax.SEVR", DBF_SHORT, 0);
+
+    testDiag("bo RESET clears the counters");
+    testdbPutFieldOk("reset.VAL", DBF_USHORT, 1);
+    testdbPutFieldOk("passes.PROC", DBF_UCHAR, 1);
+    if (dbNameToAddr("passes.VAL", &addr) ||
+        dbGetField(&addr, DBR_DOUBLE, &passes, NULL, NULL, NULL))
+        passes = -1;
+    testOk(passes >= 0 && passes <= 1, "%g passes after reset", passes);
+}
+
+static void test_waveform(void)
+{
+    static const epicsFloat64 bounds[] = {
+        10e-6, 20e-6, 50e-6, 100e-6, 200e-6, 500e-6
+    };
+
+    testDiag("waveform items follow scanPeriodicHistogram()");
+    testdbPutFieldOk("bounds.PROC", DBF_UCHAR, 1);
+    testdbGetArrFieldEqual("bounds.VAL", DBF_DOUBLE, 6, 6, bounds);
+
+    testdbPutFieldOk("timeHist.PROC", DBF_UCHAR, 1);
+    testdbGetFieldEqual("timeHist.NORD", DBF_ULONG, SCAN_HIST_BINS);
+}
+
+MAIN(scanStatsTest)
+{
+    testPlan(4+10+4);
+
+    testdbPrepare();
+    testdbReadDatabase("recTestIoc.dbd", NULL, NULL);
+    recTestIoc_registerRecordDeviceDriver(pdbbase);
+
+    testdbReadDatabase("scanStatsTest.db", NULL, NULL);
+
+    eltc(0);
+    testIocInitOk();
+    eltc(1);
+
+    test_init();
+    test_ai();
+    test_waveform();
+
+    testIocShutdownOk();
+    testdbCleanup();
+
+    return testDone();
+}
@@ -0,0 +1,383 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+/*
+ * Evaluate a compiled calc expression over whole arrays
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dbDefs.h"
+#include "epicsMath.h"
+#include "epicsTypes.h"
+#include "postfix.h"
+#include "postfixPvt.h"
+
+/* Elements evaluated together. Every stack entry holds this many values,
+ * so each instruction is one short loop the compiler can vectorize.
+ */
+#define CHUNK 128
+
+/* Lanes used by the reductions, so their loops vectorize without
+ * reassociating floating point additions.
+ */
+#define LANES 8
+
+static void fill(double *pdst, double val, long n)
+{
+    long i;
+
+    for (i = 0; i < n; i++)
+        pdst[i] = val;
+}
+
+static void copy(double *pdst, const double *psrc, long n)
+{
+    if (pdst != psrc)
+        memcpy(pdst, psrc, n * sizeof(double));
+}
+
+/* Evaluate one element at a time, needed for conditionals and RANDOM */
+static long performElements(const calcArrayArg *pargs, double *presult,
+    long nelm, const calcProgram *pprog)
+{
+    double sval[CALCPERFORM_NARGS];
+    double arg[CALCPERFORM_NARGS];
+    int vary[CALCPERFORM_NARGS];
+    int nvary = 0;
+    int stores = 0;
+    long i;
+    int k;
+
+    /* Only the inputs that are arrays or that the program stores into
+     * change between elements. The others are never fetched, or are
+     * stored before every fetch.
+     */
+    for (k = 0; k < CALCPERFORM_NARGS; k++) {
+        sval[k] = pargs[k].pval && pargs[k].nelm > 0 ? pargs[k].pval[0] : 0.0;
+        arg[k] = sval[k];
+    }
+    for (i = 0; i < pprog->ninst; i++) {
+        const calcInst *pi = &pprog->inst[i];
+
+        if (pi->op == STORE_A)
+            stores |= 1 << pi->arg;
+    }
+    for (k = 0; k < CALCPERFORM_NARGS; k++) {
+        if (!(pprog->inputs & (1ul << k)))
+            continue;
+        if (pargs[k].nelm > 1 || (stores & (1 << k)))
+            vary[nvary++] = k;
+    }
+
+    for (i = 0; i < nelm; i++) {
+        for (k = 0; k < nvary; k++) {
+            const calcArrayArg *pa = &pargs[vary[k]];
+
+            arg[vary[k]] = pa->pval && i < pa->nelm ?
+                pa->pval[i] : sval[vary[k]];
+        }
+        if (calcPerformProgram(arg, &presult[i], pprog))
+            return -1;
+    }
+    return 0;
+}
+
+LIBCOM_API long
+    calcPerformArray(const calcArrayArg *pargs, double *presult, long *pnelm,
+        const calcProgram *pprog)
+{
+    const double *cur[CALCPERFORM_NARGS];   /* Argument chunk, or NULL */
+    double sval[CALCPERFORM_NARGS];         /* Scalar argument values */
+    double *scratch[CALCPERFORM_NARGS];     /* Stored argument values */
+    double *buf[CALCPERFORM_STACK];         /* Stack entry storage */
+    const double *val[CALCPERFORM_STACK];   /* Stack entry values */
+    double *work;
+    long nelm = *pnelm;
+    long base;
+    int arrays = 0;
+    int nstores = 0;
+    int i, k;
+
+    /* The result is as long as the shortest array input */
+    for (k = 0; k < CALCPERFORM_NARGS; k++) {
+        if (!(pprog->inputs & (1ul << k)) || pargs[k].nelm == 1)
+            continue;
+        arrays = 1;
+        if (pargs[k].nelm < nelm)
+            nelm = pargs[k].nelm;
+    }
+    if (!arrays && nelm > 1)
+        nelm = 1;
+    if (nelm < 0)
+        nelm = 0;
+    *pnelm = nelm;
+
+    if (pprog->branches)
+        return performElements(pargs, presult, nelm, pprog);
+
+    for (i = 0; i < pprog->ninst; i++) {
+        const calcInst *pi = &pprog->inst[i];
+
+        if (pi->op == STORE_A)
+            nstores |= 1 << pi->arg;
+    }
+    for (i = 0, k = 0; k < CALCPERFORM_NARGS; k++)
+        i += !!(nstores & (1 << k));
+
+    work = malloc((pprog->depth + i) * CHUNK * sizeof(double));
+    if (!work && pprog->depth + i)
+        return -1;
+    for (i = 0; i < pprog->depth; i++)
+        buf[i] = work + i * CHUNK;
+    for (k = 0; k < CALCPERFORM_NARGS; k++) {
+        scratch[k] = NULL;
+        if (nstores & (1 << k))
+            scratch[k] = work + i++ * CHUNK;
+        sval[k] = pargs[k].pval && pargs[k].nelm > 0 ? pargs[k].pval[0] : 0.0;
+    }
+
+    for (base = 0; base < nelm; base += CHUNK) {
+        const long n = nelm - base < CHUNK ? nelm - base : CHUNK;
+        const calcInst *pi;
+        int sp = -1;
+        long j;
+
+        for (k = 0; k < CALCPERFORM_NARGS; k++)
+            cur[k] = (pprog->inputs & (1ul << k)) && pargs[k].nelm > 1 ?
+                pargs[k].pval + base : NULL;
+
+        for (pi = pprog->inst; pi->op != END_EXPRESSION; pi++) {
+            double *po;
+            const double *pa, *pb;
+            double x, a, b;
+            int r;
+
+            switch (pi->op) {
+
+            case LITERAL_DOUBLE:
+                ++sp;
+                fill(buf[sp], pi->lit, n);
+                val[sp] = buf[sp];
+                break;
+
+            case FETCH_VAL:
+                ++sp;
+                val[sp] = presult + base;
+                break;
+
+            case FETCH_A:
+                ++sp;
+                if (cur[pi->arg]) {
+                    val[sp] = cur[pi->arg];
+                } else {
+                    fill(buf[sp], sval[pi->arg], n);
+                    val[sp] = buf[sp];
+                }
+                break;
+
+            case STORE_A:
+                /* Keep any older value of the argument on the stack */
+                po = scratch[pi->arg];
+                for (r = 0; r < sp; r++) {
+                    if (val[r] == po) {
+                        copy(buf[r], po, n);
+                        val[r] = buf[r];
+                    }
+                }
+                copy(po, val[sp--], n);
+                cur[pi->arg] = po;
+                break;
+
+#define UNARY_CASE(OP, EXPR) \
+            case OP: \
+                pa = val[sp]; \
+                po = buf[sp]; \
+                for (j = 0; j < n; j++) { \
+                    x = pa[j]; \
+                    po[j] = EXPR; \
+                } \
+                val[sp] = po; \
+                break;
+            UNARY_OPS(UNARY_CASE)
+#undef UNARY_CASE
+
+#define BINARY_LOOP(EXPR) \
+                for (j = 0; j < n; j++) { \
+                    a = pa[j]; \
+                    b = pb[j]; \
+                    po[j] = EXPR; \
+                }
+#define BINARY_SCALAR_LOOP(EXPR) \
+                for (j = 0; j < n; j++) { \
+                    a = pa[j]; \
+                    po[j] = EXPR; \
+                }
+#define BINARY_CASE(OP, EXPR) \
+            case OP: \
+                pa = val[sp - 1]; \
+                pb = val[sp]; \
+                po = buf[--sp]; \
+                BINARY_LOOP(EXPR) \
+                val[sp] = po; \
+                break; \
+            case OP + FORM_LIT: \
+                pa = val[sp]; \
+                po = buf[sp]; \
+                b = pi->lit; \
+                BINARY_SCALAR_LOOP(EXPR) \
+                val[sp] = po; \
+                break; \
+            case OP + FORM_ARG: \
+                pa = val[sp]; \
+                po = buf[sp]; \
+                pb = cur[pi->arg]; \
+                if (pb) { \
+                    BINARY_LOOP(EXPR) \
+                } else { \
+                    b = sval[pi->arg]; \
+                    BINARY_SCALAR_LOOP(EXPR) \
+                } \
+                val[sp] = po; \
+                break;
+            BINARY_OPS(BINARY_CASE)
+#undef BINARY_CASE
+#undef BINARY_SCALAR_LOOP
+#undef BINARY_LOOP
+
+            /* The vararg functions combine the values from the top down,
+             * like calcPerform(). The result is built in the top entry's
+             * storage, which is then swapped with the bottom entry's.
+             */
+            case MAX:
+            case MIN:
+            case FINITE:
+            case ISNAN:
+                r = sp - pi->arg + 1;
+                po = buf[sp];
+                pa = val[sp];
+                if (pi->op == FINITE) {
+                    for (j = 0; j < n; j++)
+                        po[j] = finite(pa[j]);
+                } else if (pi->op == ISNAN) {
+                    for (j = 0; j < n; j++)
+                        po[j] = isnan(pa[j]);
+                } else
+                    copy(po, pa, n);
+                while (--sp >= r) {
+                    pa = val[sp];
+                    switch (pi->op) {
+                    case MAX:
+                        for (j = 0; j < n; j++) {
+                            a = pa[j];
+                            b = po[j];
+                            po[j] = (a < b || isnan(b)) ? b : a;
+                        }
+                        break;
+                    case MIN:
+                        for (j = 0; j < n; j++) {
+                            a = pa[j];
+                            b = po[j];
+                            po[j] = (a > b || isnan(b)) ? b : a;
+                        }
+                        break;
+                    case FINITE:
+                        for (j = 0; j < n; j++)
+                            po[j] = po[j] && finite(pa[j]);
+                        break;
+                    case ISNAN:
+                        for (j = 0; j < n; j++)
+                            po[j] = po[j] || isnan(pa[j]);
+                        break;
+                    }
+                }
+                sp = r;
+                buf[sp + pi->arg - 1] = buf[r];
+                buf[r] = po;
+                val[r] = po;
+                break;
+
+            default:
+                free(work);
+                return -1;
+            }
+        }
+        copy(presult + base, val[0], n);
+    }
+    free(work);
+    return 0;
+}
+
+LIBCOM_API double
+    calcReduceArray(const double *pval, long nelm, int reduce)
+{
+    double acc[LANES];
+    double bad[LANES];
+    double result;
+    long i, n = nelm - nelm % LANES;
+    int l;
+
+    if (nelm < 1)
+        return reduce == CALC_REDUCE_SUM ? 0.0 : epicsNAN;
+
+    switch (reduce) {
+    case CALC_REDUCE_SUM:
+    case CALC_REDUCE_MEAN:
+        for (l = 0; l < LANES; l++)
+            acc[l] = 0.0;
+        for (i = 0; i < n; i += LANES)
+            for (l = 0; l < LANES; l++)
+                acc[l] += pval[i + l];
+        result = 0.0;
+        for (l = 0; l < LANES; l++)
+            result += acc[l];
+        for (; i < nelm; i++)
+            result += pval[i];
+        if (reduce == CALC_REDUCE_MEAN)
+            result /= nelm;
+        return result;
+
+    case CALC_REDUCE_MIN:
+    case CALC_REDUCE_MAX:
+        /* Any NaN makes the result NaN, as for MIN() and MAX() */
+        for (l = 0; l < LANES; l++) {
+            acc[l] = pval[0];
+            bad[l] = 0.0;
+        }
+        if (reduce == CALC_REDUCE_MIN) {
+            for (i = 0; i < n; i += LANES)
+                for (l = 0; l < LANES; l++) {
+                    double v = pval[i + l];
+
+                    acc[l] = v < acc[l] ? v : acc[l];
+                    bad[l] += v != v;
+                }
+        } else {
+            for (i = 0; i < n; i += LANES)
+                for (l = 0; l < LANES; l++) {
+                    double v = pval[i + l];
+
+                    acc[l] = v > acc[l] ? v : acc[l];
+                    bad[l] += v != v;
+                }
+        }
+        result = acc[0];
+        for (l = 0; l < LANES; l++) {
+            if (bad[l] != 0.0 || isnan(acc[l]))
+                return epicsNAN;
+            if (reduce == CALC_REDUCE_MIN ? acc[l] < result : acc[l] > result)
+                result = acc[l];
+        }
+        for (; i < nelm; i++) {
+            if (isnan(pval[i]))
+                return epicsNAN;
+            if (reduce == CALC_REDUCE_MIN ? pval[i] < result : pval[i] > result)
+                result = pval[i];
+        }
+        return result;
+    }
+    return epicsNAN;
+}
@@ -29,6 +29,7 @@
 static double calcRandom(void);
 static int cond_search(const char **ppinst, int match);
 
+
 #ifndef PI
 #define PI 3.14159265358979323
 #endif
@@ -303,8 +304,7 @@ LIBCOM_API long
          * signed integer. Maybe the conversion functions should handle
          * overflows better.)
          */
-        #define d2i(x) ((x)<0?(epicsInt32)(x):(epicsInt32)(epicsUInt32)(x))
-        #define d2ui(x) ((x)<0?(epicsUInt32)(epicsInt32)(x):(epicsUInt32)(x))
+        /* d2i() and d2ui() are defined in postfixPvt.h */
 
         case BIT_OR:
             top = *ptop--;
@@ -403,6 +403,131 @@ LIBCOM_API long
     return 0;
 }
 
+/* calcPerformProgram
+ *
+ * Evaluate a program made by calcCompile()
+ */
+LIBCOM_API long
+    calcPerformProgram(double *parg, double *presult, const calcProgram *pprog)
+{
+    double stack[CALCPERFORM_STACK+1];  /* zero'th entry not used */
+    double *ptop = stack;               /* stack pointer */
+    const calcInst *pinst = pprog->inst;
+    double x, a, b;
+    int nargs;
+
+    for (;;) {
+        const calcInst *pi = pinst++;
+
+        switch (pi->op) {
+
+        case END_EXPRESSION:
+            /* calcCompile() checked the stack has one item now */
+            *presult = *ptop;
+            return 0;
+
+        case LITERAL_DOUBLE:
+            *++ptop = pi->lit;
+            break;
+
+        case FETCH_VAL:
+            *++ptop = *presult;
+            break;
+
+        case FETCH_A:
+            *++ptop = parg[pi->arg];
+            break;
+
+        case STORE_A:
+            parg[pi->arg] = *ptop--;
+            break;
+
+        case RANDOM:
+            *++ptop = calcRandom();
+            break;
+
+#define UNARY_CASE(OP, EXPR) \
+        case OP: \
+            x = *ptop; \
+            *ptop = EXPR; \
+            break;
+        UNARY_OPS(UNARY_CASE)
+#undef UNARY_CASE
+
+#define BINARY_CASE(OP, EXPR) \
+        case OP: \
+            b = *ptop--; \
+            a = *ptop; \
+            *ptop = EXPR; \
+            break; \
+        case OP + FORM_LIT: \
+            b = pi->lit; \
+            a = *ptop; \
+            *ptop = EXPR; \
+            break; \
+        case OP + FORM_ARG: \
+            b = parg[pi->arg]; \
+            a = *ptop; \
+            *ptop = EXPR; \
+            break;
+        BINARY_OPS(BINARY_CASE)
+#undef BINARY_CASE
+
+        case MAX:
+            nargs = pi->arg;
+            while (--nargs) {
+                b = *ptop--;
+                if (*ptop < b || isnan(b))
+                    *ptop = b;
+            }
+            break;
+
+        case MIN:
+            nargs = pi->arg;
+            while (--nargs) {
+                b = *ptop--;
+                if (*ptop > b || isnan(b))
+                    *ptop = b;
+            }
+            break;
+
+        case FINITE:
+            nargs = pi->arg;
+            x = finite(*ptop);
+            while (--nargs) {
+                --ptop;
+                x = x && finite(*ptop);
+            }
+            *ptop = x;
+            break;
+
+        case ISNAN:
+            nargs = pi->arg;
+            x = isnan(*ptop);
+            while (--nargs) {
+                --ptop;
+                x = x || isnan(*ptop);
+            }
+            *ptop = x;
+            break;
+
+        case COND_IF:
+            if (*ptop-- == 0.0)
+                pinst = pprog->inst + pi->arg;
+            break;
+
+        case COND_ELSE:
+            pinst = pprog->inst + pi->arg;
+            break;
+
+        default:
+            errlogPrintf("calcPerformProgram: Bad Opcode %d at %p\n",
+                pi->op, pi);
+            return -1;
+        }
+    }
+}
+
 #if defined(_WIN32) && defined(_M_X64) && !defined(_MINGW)
 #  pragma optimize("", on)
 #endif
@@ -469,6 +594,357 @@ calcArgUsage(const char *pinst, unsigned long *pinputs, unsigned long *pstores)
     return 0;
 }
 
+/* Length in bytes of an RPN instruction, 0 for a bad opcode */
+static int instLength(int op)
+{
+    switch (op) {
+    case LITERAL_DOUBLE:
+        return 1 + sizeof(double);
+    case LITERAL_INT:
+        return 1 + sizeof(epicsInt32);
+    case MIN:
+    case MAX:
+    case FINITE:
+    case ISNAN:
+        return 2;
+    default:
+        return op >= END_EXPRESSION && op < NOT_GENERATED;
+    }
+}
+
+/* Number of values taken by a unary or binary operator, otherwise 0 */
+static int operandCount(int op)
+{
+    switch (op) {
+#define UNARY_CASE(OP, EXPR) case OP: return 1;
+    UNARY_OPS(UNARY_CASE)
+#undef UNARY_CASE
+#define BINARY_CASE(OP, EXPR) case OP: return 2;
+    BINARY_OPS(BINARY_CASE)
+#undef BINARY_CASE
+    }
+    return 0;
+}
+
+static double unaryOp(int op, double x)
+{
+    switch (op) {
+#define UNARY_CASE(OP, EXPR) case OP: return EXPR;
+    UNARY_OPS(UNARY_CASE)
+#undef UNARY_CASE
+    }
+    return epicsNAN;
+}
+
+static double binaryOp(int op, double a, double b)
+{
+    switch (op) {
+#define BINARY_CASE(OP, EXPR) case OP: return EXPR;
+    BINARY_OPS(BINARY_CASE)
+#undef BINARY_CASE
+    }
+    return epicsNAN;
+}
+
+/* calcCompile
+ *
+ * Decode a postfix expression into a calcProgram
+ */
+LIBCOM_API calcProgram *
+    calcCompile(const char *pinst, short *perror)
+{
+    const char *pnext;
+    calcInst *raw = NULL;       /* Decoded postfix, one per RPN opcode */
+    calcInst *out = NULL;       /* Optimized instructions */
+    int *rawAt = NULL;          /* Byte offset => raw index */
+    int *depth = NULL;          /* Stack depth before each raw instruction */
+    char *target = NULL;        /* Raw instruction is a jump target */
+    char *outTarget = NULL;     /* Out instruction is a jump target */
+    int *outAt = NULL;          /* Raw index => out index */
+    calcProgram *pprog = NULL;
+    short error = CALC_ERR_NONE;
+    unsigned long inputs = 0, stores = 0, fetches = 0;
+    int len, nraw, nout, pending, maxDepth, branches, i;
+
+    if (!pinst) {
+        error = CALC_ERR_NULL_ARG;
+        goto done;
+    }
+
+    /* Measure */
+    len = 0;
+    nraw = 0;
+    for (;;) {
+        int n = instLength(pinst[len]);
+
+        if (!n) {
+            error = CALC_ERR_INTERNAL;
+            goto done;
+        }
+        nraw++;
+        if (pinst[len] == END_EXPRESSION)
+            break;
+        len += n;
+    }
+
+    raw = calloc(nraw, sizeof(calcInst));
+    out = calloc(nraw, sizeof(calcInst));
+    rawAt = calloc(len + 1, sizeof(int));
+    depth = calloc(nraw, sizeof(int));
+    target = calloc(nraw, 1);
+    outTarget = calloc(nraw, 1);
+    outAt = calloc(nraw, sizeof(int));
+    if (!raw || !out || !rawAt || !depth || !target || !outTarget || !outAt) {
+        error = CALC_ERR_INTERNAL;
+        goto done;
+    }
+
+    /* Decode */
+    pnext = pinst;
+    for (i = 0; i < nraw; i++) {
+        rawAt[pnext - pinst] = i;
+        pnext += instLength(*pnext);
+    }
+    pnext = pinst;
+    for (i = 0; i < nraw; i++) {
+        calcInst *pi = &raw[i];
+        int op = *pnext++;
+        epicsInt32 lit_i;
+
+        pi->op = op;
+        switch (op) {
+        case LITERAL_DOUBLE:
+            memcpy(&pi->lit, pnext, sizeof(double));
+            pnext += sizeof(double);
+            break;
+
+        case LITERAL_INT:
+            memcpy(&lit_i, pnext, sizeof(epicsInt32));
+            pnext += sizeof(epicsInt32);
+            pi->op = LITERAL_DOUBLE;
+            pi->lit = lit_i;
+            break;
+
+        case CONST_PI:
+            pi->op = LITERAL_DOUBLE;
+            pi->lit = PI;
+            break;
+
+        case CONST_D2R:
+            pi->op = LITERAL_DOUBLE;
+            pi->lit = PI/180.;
+            break;
+
+        case CONST_R2D:
+            pi->op = LITERAL_DOUBLE;
+            pi->lit = 180./PI;
+            break;
+
+        case MIN:
+        case MAX:
+        case FINITE:
+        case ISNAN:
+            pi->arg = *pnext++;
+            if (pi->arg < 1) {
+                error = CALC_ERR_INTERNAL;
+                goto done;
+            }
+            break;
+
+        case COND_IF:
+        case COND_ELSE:
+            /* Resolve the jump as calcPerform() would */
+            {
+                const char *pjump = pnext;
+
+                if (cond_search(&pjump, op == COND_IF ? COND_ELSE : COND_END)) {
+                    error = CALC_ERR_CONDITIONAL;
+                    goto done;
+                }
+                pi->arg = rawAt[pjump - pinst];
+                target[pi->arg] = 1;
+            }
+            break;
+
+        default:
+            if (op >= FETCH_A && op <= FETCH_L) {
+                pi->op = FETCH_A;
+                pi->arg = op - FETCH_A;
+                inputs |= (1 << pi->arg) & ~stores;
+                fetches |= 1 << pi->arg;
+            }
+            else if (op >= STORE_A && op <= STORE_L) {
+                pi->op = STORE_A;
+                pi->arg = op - STORE_A;
+                stores |= 1 << pi->arg;
+            }
+        }
+    }
+
+    /* Check the stack depth on every path, all jumps are forward */
+    for (i = 0; i < nraw; i++)
+        depth[i] = -1;
+    depth[0] = 0;
+    maxDepth = 0;
+    branches = 0;
+    for (i = 0; i < nraw; i++) {
+        const calcInst *pi = &raw[i];
+        int need, next;
+
+        if (depth[i] < 0)
+            continue;           /* Not reachable */
+
+        switch (pi->op) {
+        case END_EXPRESSION:
+            if (depth[i] != 1) {
+                error = depth[i] ? CALC_ERR_TOOMANY : CALC_ERR_INCOMPLETE;
+                goto done;
+            }
+            continue;
+        case RANDOM:
+            branches = 1;
+            /* fall through */
+        case LITERAL_DOUBLE:
+        case FETCH_VAL:
+        case FETCH_A:
+            need = 0;
+            next = depth[i] + 1;
+            break;
+        case COND_IF:
+            branches = 1;
+            /* fall through */
+        case STORE_A:
+            need = 1;
+            next = depth[i] - 1;
+            break;
+        case MIN:
+        case MAX:
+        case FINITE:
+        case ISNAN:
+            need = pi->arg;
+            next = depth[i] + 1 - pi->arg;
+            break;
+        case COND_ELSE:
+        case COND_END:
+            need = 0;
+            next = depth[i];
+            break;
+        default:
+            need = operandCount(pi->op);
+            if (!need) {
+                error = CALC_ERR_INTERNAL;
+                goto done;
+            }
+            next = depth[i] + 1 - need;
+        }
+        if (depth[i] < need) {
+            error = CALC_ERR_UNDERFLOW;
+            goto done;
+        }
+        if (next > CALCPERFORM_STACK) {
+            error = CALC_ERR_OVERFLOW;
+            goto done;
+        }
+        if (next > maxDepth)
+            maxDepth = next;
+
+        if (pi->op == COND_IF || pi->op == COND_ELSE) {
+            int *pd = &depth[pi->arg];
+
+            if (*pd >= 0 && *pd != next) {
+                error = CALC_ERR_CONDITIONAL;
+                goto done;
+            }
+            *pd = next;
+            if (pi->op == COND_ELSE)
+                continue;
+        }
+        if (depth[i + 1] >= 0 && depth[i + 1] != next) {
+            error = CALC_ERR_CONDITIONAL;
+            goto done;
+        }
+        depth[i + 1] = next;
+    }
+
+    /* Fold constants and fuse operands. Nothing is merged into an
+     * instruction that a jump lands on, other than the jump target itself.
+     */
+    nout = 0;
+    pending = 0;
+    for (i = 0; i < nraw; i++) {
+        const calcInst *pi = &raw[i];
+        int barrier = target[i] || pending;
+        calcInst *plast = nout ? &out[nout - 1] : NULL;
+
+        outAt[i] = nout;
+        pending = 0;
+
+        if (pi->op == COND_END) {
+            pending = barrier;
+            continue;
+        }
+        if (!barrier && plast) {
+            int nops = operandCount(pi->op);
+
+            if (nops == 1 && plast->op == LITERAL_DOUBLE) {
+                plast->lit = unaryOp(pi->op, plast->lit);
+                continue;
+            }
+            if (nops == 2 && plast->op == LITERAL_DOUBLE && nout >= 2 &&
+                plast[-1].op == LITERAL_DOUBLE && !outTarget[nout - 1]) {
+                plast[-1].lit = binaryOp(pi->op, plast[-1].lit, plast->lit);
+                nout--;
+                continue;
+            }
+            if (nops == 2 && plast->op == LITERAL_DOUBLE) {
+                plast->op = pi->op + FORM_LIT;
+                continue;
+            }
+            if (nops == 2 && plast->op == FETCH_A) {
+                plast->op = pi->op + FORM_ARG;
+                continue;
+            }
+        }
+        outTarget[nout] = barrier;
+        out[nout++] = *pi;
+    }
+
+    for (i = 0; i < nout; i++) {
+        if (out[i].op == COND_IF || out[i].op == COND_ELSE)
+            out[i].arg = outAt[out[i].arg];
+    }
+
+    pprog = malloc(offsetof(calcProgram, inst) + nout * sizeof(calcInst));
+    if (!pprog) {
+        error = CALC_ERR_INTERNAL;
+        goto done;
+    }
+    pprog->ninst = nout;
+    pprog->depth = maxDepth;
+    /* A store skipped by a conditional doesn't hide later fetches */
+    pprog->inputs = branches ? fetches : inputs;
+    pprog->branches = branches;
+    memcpy(pprog->inst, out, nout * sizeof(calcInst));
+
+done:
+    free(raw);
+    free(out);
+    free(rawAt);
+    free(depth);
+    free(target);
+    free(outTarget);
+    free(outAt);
+    if (perror)
+        *perror = error;
+    return pprog;
+}
+
+LIBCOM_API void
+    calcProgramFree(calcProgram *pprog)
+{
+    free(pprog);
+}
+
 /* Generate a random number between 0 and 1 using the algorithm
  * seed = (multy * seed) + addy         Random Number Generator by Knuth
  *                                              SemiNumerical Algorithms
@@ -321,6 +321,117 @@ LIBCOM_API long
 LIBCOM_API long
     calcPerform(double *parg, double *presult, const char *ppostfix);
 
+/** \brief A postfix expression decoded for faster evaluation
+ *
+ * Made from the output of postfix() by calcCompile(), and evaluated by
+ * calcPerformProgram(). The contents are private.
+ */
+typedef struct calcProgram calcProgram;
+
+/** \brief Decode a postfix expression for repeated evaluation
+ *
+ * Translates the byte-code from postfix() into a program that
+ * calcPerformProgram() runs faster than calcPerform() runs the byte-code.
+ * Literals are decoded once, the targets of the conditional operators are
+ * found ahead of time, operations on literal values are folded, and
+ * binary operators are combined with a literal or argument operand.
+ * The stack depth is checked on every path through the expression, so
+ * this also rejects byte-code that calcPerform() would fail to evaluate.
+ *
+ * The postfix buffer is not referenced after this returns, and is still
+ * the form to store and pass to calcPerform() or calcArgUsage().
+ *
+ * \param ppostfix The postfix expression created by postfix().
+ * \param perror Place to return an error code, may be NULL.
+ * \return The program, or NULL on error. Release it with calcProgramFree().
+ */
+LIBCOM_API calcProgram *
+    calcCompile(const char *ppostfix, short *perror);
+
+/** \brief Run the calculation engine on a decoded expression
+ *
+ * Gives the same results as calcPerform() does with the postfix expression
+ * that the program was made from.
+ *
+ * \param parg Pointer to an array of double values for the arguments A-L
+ * that can appear in the expression. Note that the argument values may be
+ * modified if the expression uses the assignment operator.
+ * \param presult Where to put the calculated result, which may be a NaN or Infinity.
+ * \param pprog The program created by calcCompile().
+ * \return Status value 0 for OK, or non-zero if an error is discovered
+ * during the evaluation process.
+ */
+LIBCOM_API long
+    calcPerformProgram(double *parg, double *presult, const calcProgram *pprog);
+
+/** \brief One argument of calcPerformArray() */
+typedef struct calcArrayArg {
+    /** \brief The element values */
+    const double *pval;
+    /** \brief Number of elements, 1 for a scalar used with every element */
+    long nelm;
+} calcArrayArg;
+
+/** \name Reductions for calcReduceArray()
+ * @{
+ */
+/** \brief Sum of the elements */
+#define CALC_REDUCE_SUM  1
+/** \brief Arithmetic mean of the elements */
+#define CALC_REDUCE_MEAN 2
+/** \brief Smallest element */
+#define CALC_REDUCE_MIN  3
+/** \brief Largest element */
+#define CALC_REDUCE_MAX  4
+/** @} */
+
+/** \brief Evaluate a decoded expression for every element of some arrays
+ *
+ * Element \c i of the result is the expression evaluated with each argument
+ * set to its element \c i, or to its value for a scalar argument. Each
+ * element's result is also its \c VAL. Assignments to an argument only last
+ * for the element being evaluated. The result has as many elements as the
+ * shortest array argument read by the expression, but no more than
+ * \c *pnelm. If all the arguments are scalars there is one element.
+ *
+ * Expressions without conditionals or \c RNDM are evaluated in blocks of
+ * elements, one operation at a time over each block. The loops for the
+ * arithmetic and comparison operators are vectorized by the compiler.
+ * Other expressions are evaluated one element at a time.
+ *
+ * \param pargs Array of ::CALCPERFORM_NARGS arguments for A-L. Arguments
+ * the expression doesn't use may have a NULL \c pval.
+ * \param presult The result array, which also holds the \c VAL values.
+ * \param pnelm Capacity of \c presult in, number of results out.
+ * \param pprog The program created by calcCompile().
+ * \return Status value 0 for OK, or non-zero if an error is discovered
+ * during the evaluation process.
+ */
+LIBCOM_API long
+    calcPerformArray(const calcArrayArg *pargs, double *presult, long *pnelm,
+        const calcProgram *pprog);
+
+/** \brief Reduce an array to a single value
+ *
+ * The elements are accumulated in several lanes so the loops vectorize,
+ * so a sum may be rounded differently than adding the elements in order.
+ * If any element is a NaN the minimum and maximum are NaN.
+ *
+ * \param pval The elements.
+ * \param nelm Number of elements. For none the sum is 0, the others NaN.
+ * \param reduce One of the \c CALC_REDUCE_ values.
+ * \return The result.
+ */
+LIBCOM_API double
+    calcReduceArray(const double *pval, long nelm, int reduce);
+
+/** \brief Release a program made by calcCompile()
+ *
+ * \param pprog The program, may be NULL.
+ */
+LIBCOM_API void
+    calcProgramFree(calcProgram *pprog);
+
 /** \brief Find the inputs and outputs of an expression
  *
  * Software using the calc subsystem may need to know what expression
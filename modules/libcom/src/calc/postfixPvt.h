@@ -104,4 +104,89 @@ typedef enum {
     NOT_GENERATED
 } rpn_opcode;
 
+/* Instructions of a calcProgram use the RPN opcodes, with these changes:
+ *  - All literals and constants are LITERAL_DOUBLE with their value in lit.
+ *  - FETCH_A and STORE_A take the argument index in arg.
+ *  - The vararg functions take the argument count in arg.
+ *  - COND_IF and COND_ELSE take the index of their jump target in arg.
+ *  - COND_END is left out.
+ *  - A binary operator whose right operand is a literal or an argument is
+ *    fused with the instruction that pushes it. FORM_LIT or FORM_ARG is
+ *    added to the opcode, and lit or arg holds the operand.
+ */
+#define FORM_LIT NOT_GENERATED
+#define FORM_ARG (2 * NOT_GENERATED)
+
+typedef struct calcInst {
+    int op;         /* Opcode */
+    int arg;        /* Argument index, argument count or jump target */
+    double lit;     /* Literal value */
+} calcInst;
+
+struct calcProgram {
+    int ninst;
+    int depth;              /* Largest stack depth */
+    unsigned long inputs;   /* Arguments read, as from calcArgUsage(), or
+                             * every argument fetched if it branches */
+    int branches;           /* Has conditionals or RANDOM */
+    calcInst inst[1];
+};
+
+/* Convert double to int for the bitwise operators, see calcPerform() */
+#define d2i(x) ((x)<0?(epicsInt32)(x):(epicsInt32)(epicsUInt32)(x))
+#define d2ui(x) ((x)<0?(epicsUInt32)(epicsInt32)(x):(epicsUInt32)(x))
+
+/* The operators that take one or two values from the stack and replace them
+ * with one result. Everything that evaluates a calcProgram expands these,
+ * so all give the same results as calcPerform(). x is the only value, a and
+ * b are the lower and the top value.
+ */
+#define UNARY_OPS(OP) \
+    OP(UNARY_NEG, - x) \
+    OP(ABS_VAL, fabs(x)) \
+    OP(EXP, exp(x)) \
+    OP(LOG_10, log10(x)) \
+    OP(LOG_E, log(x)) \
+    OP(SQU_RT, sqrt(x)) \
+    OP(ACOS, acos(x)) \
+    OP(ASIN, asin(x)) \
+    OP(ATAN, atan(x)) \
+    OP(COS, cos(x)) \
+    OP(SIN, sin(x)) \
+    OP(TAN, tan(x)) \
+    OP(COSH, cosh(x)) \
+    OP(SINH, sinh(x)) \
+    OP(TANH, tanh(x)) \
+    OP(CEIL, ceil(x)) \
+    OP(FLOOR, floor(x)) \
+    OP(ISINF, isinf(x)) \
+    OP(NINT, (epicsInt32) (x >= 0 ? x + 0.5 : x - 0.5)) \
+    OP(REL_NOT, ! x) \
+    OP(BIT_NOT, (double)~d2i(x))
+
+#define BINARY_OPS(OP) \
+    OP(ADD, a + b) \
+    OP(SUB, a - b) \
+    OP(MULT, a * b) \
+    OP(DIV, a / b) \
+    OP(MODULO, (epicsInt32) b ? \
+        (double)((epicsInt32) a % (epicsInt32) b) : epicsNAN) \
+    OP(POWER, pow(a, b)) \
+    OP(ATAN2, atan2(b, a))  /* Args backwards, as in calcPerform() */ \
+    OP(FMOD, fmod(a, b)) \
+    OP(REL_OR, a || b) \
+    OP(REL_AND, a && b) \
+    OP(BIT_OR, (double)(d2i(a) | d2i(b))) \
+    OP(BIT_AND, (double)(d2i(a) & d2i(b))) \
+    OP(BIT_EXCL_OR, (double)(d2i(a) ^ d2i(b))) \
+    OP(RIGHT_SHIFT_ARITH, (double)(d2i(a) >> (d2i(b) & 31))) \
+    OP(LEFT_SHIFT_ARITH, (double)(d2i(a) << (d2i(b) & 31))) \
+    OP(RIGHT_SHIFT_LOGIC, (double)(d2ui(a) >> (d2ui(b) & 31u))) \
+    OP(NOT_EQ, a != b) \
+    OP(LESS_THAN, a < b) \
+    OP(LESS_OR_EQ, a <= b) \
+    OP(EQUAL, a == b) \
+    OP(GR_OR_EQ, a >= b) \
+    OP(GR_THAN, a > b)
+
 #endif /* INCpostfixPvth */
@@ -0,0 +1,8 @@
+/* THIS IS A GENERATED FILE. DO NOT EDIT! */
+
+#ifndef INC_epicsInstallDir_H
+#define INC_epicsInstallDir_H
+
+#define EPICS_BASE "../../../.."
+
+#endif /* INC_epicsInstallDir_H */
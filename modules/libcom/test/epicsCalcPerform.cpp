@@ -0,0 +1,209 @@
+/*************************************************************************\
+* SPDX-License-Identifier: EPICS
+* EPICS BASE is distributed subject to a Software License Agreement found
+* in file LICENSE that is included with this distribution.
+\*************************************************************************/
+
+/* Compare the speed of calcPerform() and calcPerformProgram(), and of
+ * calcPerformArray() with evaluating each element of an array in turn.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "epicsUnitTest.h"
+#include "epicsMath.h"
+#include "epicsTime.h"
+#include "postfix.h"
+#include "testMain.h"
+
+static const char * const exprs[] = {
+    "A+B",
+    "A*2+B/4-1",
+    "(A+B)/2",
+    "A<B?A:B",
+    "A>5?(B>2?C:D):E",
+    "SIN(A*D2R)*COS(B*D2R)",
+    "ABS(A-B)>0.5&&C",
+    "MAX(A,B,C,D)-MIN(A,B,C,D)",
+    "A&0xff|(B<<8)",
+    "E:=A*B+C;F:=E/2;E+F",
+    "A*(1+2*3)+SQRT(16)*B",
+    "(A+B+C+D+E+F+G+H+I+J+K+L)/12",
+};
+
+static const int nEvals = 1000000;
+
+static double timeInterp(const char *rpn, double *presult)
+{
+    double args[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    epicsUInt64 start = epicsMonotonicGet();
+
+    for (int i = 0; i < nEvals; i++) {
+        args[0] = i & 15;
+        calcPerform(args, presult, rpn);
+    }
+    return (double)(epicsMonotonicGet() - start) / nEvals;
+}
+
+static double timeProgram(const calcProgram *prog, double *presult)
+{
+    double args[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    epicsUInt64 start = epicsMonotonicGet();
+
+    for (int i = 0; i < nEvals; i++) {
+        args[0] = i & 15;
+        calcPerformProgram(args, presult, prog);
+    }
+    return (double)(epicsMonotonicGet() - start) / nEvals;
+}
+
+static void measure(const char *expr)
+{
+    char rpn[INFIX_TO_POSTFIX_SIZE(MAX_INFIX_SIZE)];
+    calcProgram *prog;
+    double r1 = 0.0, r2 = 0.0;
+    double t1, t2;
+    short err;
+
+    if (postfix(expr, rpn, &err)) {
+        testFail("postfix: %s in '%s'", calcErrorStr(err), expr);
+        return;
+    }
+    prog = calcCompile(rpn, &err);
+    if (!prog) {
+        testFail("calcCompile: %s in '%s'", calcErrorStr(err), expr);
+        return;
+    }
+
+    /* Warm up, then alternate */
+    timeInterp(rpn, &r1);
+    t1 = timeInterp(rpn, &r1);
+    t2 = timeProgram(prog, &r2);
+    calcProgramFree(prog);
+
+    testOk(r1 == r2 || (isnan(r1) && isnan(r2)),
+        "%-30s %6.1f ns -> %6.1f ns (x%.2f)", expr, t1, t2, t1 / t2);
+}
+
+static const char * const arrayExprs[] = {
+    "A*C+B",
+    "(A-B)*C",
+    "ABS(A-B)>C",
+    "MAX(A,B)",
+    "A<B?A:B",
+};
+
+static const long nElements = 100000;
+static const int nPasses = 20;
+
+static void measureArray(const char *expr, double *a, double *b)
+{
+    char rpn[INFIX_TO_POSTFIX_SIZE(MAX_INFIX_SIZE)];
+    double scalars[CALCPERFORM_NARGS] = {0.0, 0.0, 0.5};
+    calcArrayArg args[CALCPERFORM_NARGS];
+    double *r1 = (double *) calloc(2 * nElements, sizeof(double));
+    double *r2 = r1 + nElements;
+    calcProgram *prog;
+    epicsUInt64 start;
+    double t1, t2;
+    long nelm = 0;
+    bool same = true;
+    short err;
+
+    if (postfix(expr, rpn, &err) || !(prog = calcCompile(rpn, &err))) {
+        testFail("%s in '%s'", calcErrorStr(err), expr);
+        free(r1);
+        return;
+    }
+    for (int k = 0; k < CALCPERFORM_NARGS; k++) {
+        args[k].pval = &scalars[k];
+        args[k].nelm = 1;
+    }
+    args[0].pval = a;
+    args[0].nelm = nElements;
+    args[1].pval = b;
+    args[1].nelm = nElements;
+
+    start = epicsMonotonicGet();
+    for (int p = 0; p < nPasses; p++) {
+        for (long i = 0; i < nElements; i++) {
+            scalars[0] = a[i];
+            scalars[1] = b[i];
+            calcPerformProgram(scalars, &r1[i], prog);
+        }
+    }
+    t1 = (double)(epicsMonotonicGet() - start) / nPasses / 1000.0;
+
+    start = epicsMonotonicGet();
+    for (int p = 0; p < nPasses; p++) {
+        nelm = nElements;
+        calcPerformArray(args, r2, &nelm, prog);
+    }
+    t2 = (double)(epicsMonotonicGet() - start) / nPasses / 1000.0;
+    calcProgramFree(prog);
+
+    for (long i = 0; i < nElements; i++)
+        same = same && (r1[i] == r2[i] || (isnan(r1[i]) && isnan(r2[i])));
+    testOk(same && nelm == nElements,
+        "%-12s %8.1f us -> %8.1f us (x%.1f)", expr, t1, t2, t1 / t2);
+    free(r1);
+}
+
+static void measureReduce(int reduce, const char *name, const double *a)
+{
+    epicsUInt64 start;
+    double t1, t2, r1 = 0.0, r2 = 0.0;
+
+    start = epicsMonotonicGet();
+    for (int p = 0; p < nPasses; p++) {
+        r1 = a[0];
+        for (long i = 0; i < nElements; i++) {
+            if (reduce == CALC_REDUCE_SUM)
+                r1 = i ? r1 + a[i] : a[0];
+            else if (a[i] > r1)
+                r1 = a[i];
+        }
+    }
+    t1 = (double)(epicsMonotonicGet() - start) / nPasses / 1000.0;
+
+    start = epicsMonotonicGet();
+    for (int p = 0; p < nPasses; p++)
+        r2 = calcReduceArray(a, nElements, reduce);
+    t2 = (double)(epicsMonotonicGet() - start) / nPasses / 1000.0;
+
+    testOk(fabs(r1 - r2) <= 1e-9 * fabs(r1),
+        "%-12s %8.1f us -> %8.1f us (x%.1f)", name, t1, t2, t1 / t2);
+}
+
+MAIN(epicsCalcPerform)
+{
+    const int n = sizeof(exprs) / sizeof(exprs[0]);
+    const int na = sizeof(arrayExprs) / sizeof(arrayExprs[0]);
+    double *a = (double *) malloc(2 * nElements * sizeof(double));
+    double *b = a + nElements;
+
+    testPlan(n + na + 2);
+    testDiag("Time per evaluation, calcPerform -> calcPerformProgram");
+    for (int i = 0; i < n; i++)
+        measure(exprs[i]);
+
+    for (long i = 0; i < nElements; i++) {
+        a[i] = (i % 1000) * 0.001;
+        b[i] = ((i * 7) % 1000) * 0.001;
+    }
+    testDiag("Time per %ld element array, calcPerformProgram for each "
+        "element -> calcPerformArray", nElements);
+    for (int i = 0; i < na; i++)
+        measureArray(arrayExprs[i], a, b);
+    testDiag("Time per %ld element array, simple loop -> calcReduceArray",
+        nElements);
+    measureReduce(CALC_REDUCE_SUM, "sum", a);
+    measureReduce(CALC_REDUCE_MAX, "max", a);
+    free(a);
+    return testDone();
+}
@@ -19,6 +19,33 @@
 
 /* Infrastructure for running tests */
 
+bool checkProgram(const char *expr, const char *rpn, double expected) {
+    /* Evaluate a compiled expression, check it gives the same result */
+    double args[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    short err;
+    calcProgram *prog = calcCompile(rpn, &err);
+    double result = 0.0;
+    result /= result;  /* Start as NaN */
+
+    if (!prog) {
+        testDiag("calcCompile: %s in expression '%s'", calcErrorStr(err), expr);
+        return false;
+    }
+    if (calcPerformProgram(args, &result, prog) && finite(result)) {
+        testDiag("calcPerformProgram: error evaluating '%s'", expr);
+    }
+    calcProgramFree(prog);
+    if (memcmp(&result, &expected, sizeof(double)) &&
+        !(isnan(result) && isnan(expected))) {
+        testDiag("calcPerformProgram result is %g, calcPerform gave %g",
+                 result, expected);
+        return false;
+    }
+    return true;
+}
+
 double doCalc(const char *expr) {
     /* Evaluate expression, return result */
     double args[CALCPERFORM_NARGS] = {
@@ -74,6 +101,8 @@ void testCalc(const char *expr, double expected) {
     } else {
         pass = (result == expected);
     }
+    if (!err)
+        pass = checkProgram(expr, rpn, result) && pass;
     if (!testOk(pass, "%s", expr)) {
         testDiag("Expected result is %g, actually got %g", expected, result);
         calcExprDump(rpn);
@@ -107,6 +136,8 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
 
     uresult = (result < 0.0 ? (epicsUInt32)(epicsInt32)result : (epicsUInt32)result);
     pass = (uresult == expected);
+    if (!err)
+        pass = checkProgram(expr, rpn, result) && pass;
     if (!testOk(pass, "%s", expr)) {
         testDiag("Expected result is 0x%x (%u), actually got 0x%x (%u)",
                  expected, expected, uresult, uresult);
@@ -115,6 +146,107 @@ void testUInt32Calc(const char *expr, epicsUInt32 expected) {
     free(rpn);
 }
 
+void testArrayCalc(const char *expr, long nexpected, long nC = 1) {
+    /* Evaluate over arrays, test against calcPerform() on each element */
+    const long n = 300;     /* More than two blocks */
+    double *arrays = (double*)malloc(5 * n * sizeof(double));
+    double *result = arrays + 2 * n;
+    double *expected = arrays + 3 * n;
+    double *arrayC = arrays + 4 * n;
+    double scalars[CALCPERFORM_NARGS] = {
+        1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0
+    };
+    calcArrayArg args[CALCPERFORM_NARGS];
+    char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
+    calcProgram *prog = NULL;
+    long nelm = n;
+    long i;
+    int k;
+    short err;
+    bool pass = true;
+
+    if (!arrays || !rpn) {
+        testFail("%s no memory", expr);
+        free(arrays);
+        free(rpn);
+        return;
+    }
+
+    /* A and B are arrays, the others scalars. B is one element longer.
+     * C is an array too when nC > 1, and may be the shortest.
+     */
+    for (k = 0; k < CALCPERFORM_NARGS; k++) {
+        args[k].pval = &scalars[k];
+        args[k].nelm = 1;
+    }
+    for (i = 0; i < n; i++) {
+        arrays[i] = i - 100.5;
+        arrays[n + i] = (i % 7) * 0.25 - (i % 3);
+        result[i] = expected[i] = i;    /* VAL */
+        arrayC[i] = i % 5 - 2.0;
+    }
+    args[0].pval = arrays;
+    args[0].nelm = n - 1;
+    args[1].pval = arrays + n;
+    args[1].nelm = n;
+    if (nC > 1) {
+        args[2].pval = arrayC;
+        args[2].nelm = nC;
+    }
+
+    if (postfix(expr, rpn, &err) || !(prog = calcCompile(rpn, &err))) {
+        testFail("%s in expression '%s'", calcErrorStr(err), expr);
+        free(arrays);
+        free(rpn);
+        return;
+    }
+    if (calcPerformArray(args, result, &nelm, prog)) {
+        testDiag("calcPerformArray: error evaluating '%s'", expr);
+        pass = false;
+    }
+    if (nelm != nexpected) {
+        testDiag("calcPerformArray gave %ld elements, not %ld", nelm,
+                 nexpected);
+        pass = false;
+    }
+    for (i = 0; pass && i < nelm; i++) {
+        double arg[CALCPERFORM_NARGS];
+
+        memcpy(arg, scalars, sizeof(arg));
+        arg[0] = arrays[i];
+        arg[1] = arrays[n + i];
+        if (nC > 1)
+            arg[2] = arrayC[i];
+        calcPerform(arg, &expected[i], rpn);
+        if (memcmp(&result[i], &expected[i], sizeof(double)) &&
+            !(isnan(result[i]) && isnan(expected[i]))) {
+            testDiag("Element %ld is %g, expected %g", i, result[i],
+                     expected[i]);
+            pass = false;
+        }
+    }
+    testOk(pass, "Array %s", expr);
+    calcProgramFree(prog);
+    free(arrays);
+    free(rpn);
+}
+
+void testReduce(int reduce, const char *name, long n, double expected) {
+    double *vals = (double*)malloc((n + 1) * sizeof(double));
+    double result;
+    long i;
+
+    for (i = 0; i < n; i++)
+        vals[i] = (i * 37) % 101 - 50;
+    if (n > 0 && isnan(expected))
+        vals[n / 2] = epicsNAN;
+    result = calcReduceArray(vals, n, reduce);
+    if (!testOk(result == expected || (isnan(result) && isnan(expected)),
+                "%s of %ld elements", name, n))
+        testDiag("Expected %g, got %g", expected, result);
+    free(vals);
+}
+
 void testArgs(const char *expr, unsigned long einp, unsigned long eout) {
     char *rpn = (char*)malloc(INFIX_TO_POSTFIX_SIZE(strlen(expr)+1));
     short err = 0;
@@ -298,7 +430,7 @@ MAIN(epicsCalcTest)
     const double a=1.0, b=2.0, c=3.0, d=4.0, e=5.0, f=6.0,
                  g=7.0, h=8.0, i=9.0, j=10.0, k=11.0, l=12.0;
 
-    testPlan(637);
+    testPlan(665);
 
     /* LITERAL_OPERAND elements */
     testExpr(0);
@@ -1012,5 +1144,36 @@ MAIN(epicsCalcTest)
     testUInt32Calc("-1431655766.1 << 0.1", 0xaaaaaaaau);
     testUInt32Calc("2863311530.1 << 0.1", 0xaaaaaaaau);
 
+    testDiag("Array expressions");
+    testArrayCalc("A", 299);
+    testArrayCalc("C", 1);
+    testArrayCalc("A*C+B", 299);
+    testArrayCalc("2*A-B/4", 299);
+    testArrayCalc("1-A", 299);
+    testArrayCalc("-A+ABS(B)*SQRT(C)", 299);
+    testArrayCalc("A>B||B=0", 299);
+    testArrayCalc("A%7+FMOD(A,3)+A**2", 299);
+    testArrayCalc("ATAN2(A,B)", 299);
+    testArrayCalc("A&0xf|B<<2", 299);
+    testArrayCalc("MAX(A,B,0)-MIN(A,B)", 299);
+    testArrayCalc("MAX(A)+MIN(C,A,B,D)", 299);
+    testArrayCalc("FINITE(A,B/0)+ISNAN(B,0/0)", 299);
+    testArrayCalc("VAL+A", 299);
+    testArrayCalc("D:=A*2;E:=D+B;D-E", 299);
+    testArrayCalc("A:=B;C:=A*A;A;A:=C", 300);
+    testArrayCalc("A<0?-A:B", 299);
+    testArrayCalc("A>B?(B>0?C:D):VAL", 299);
+    testArrayCalc("A>0?A:0", 299, 10);
+    testArrayCalc("A+B", 299, 10);
+    testArrayCalc("A>0?C:=A:0;C", 10, 10);
+
+    testReduce(CALC_REDUCE_SUM, "Sum", 0, 0.0);
+    testReduce(CALC_REDUCE_SUM, "Sum", 1000, 10.0);
+    testReduce(CALC_REDUCE_MEAN, "Mean", 1003, epicsNAN);
+    testReduce(CALC_REDUCE_MIN, "Min", 1005, -50.0);
+    testReduce(CALC_REDUCE_MAX, "Max", 1005, 50.0);
+    testReduce(CALC_REDUCE_MAX, "Max", 1005, epicsNAN);
+    testReduce(CALC_REDUCE_MIN, "Min", 0, epicsNAN);
+
     return testDone();
 }